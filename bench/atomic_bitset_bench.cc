@@ -0,0 +1,111 @@
+/**
+ *  \file   atomic_bitset_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bitops/atomic_bitset.h"
+#include "bitops/bitops.h"
+
+namespace {
+
+using jfern::bitops::atomic_bitset;
+
+/** Acquire/release pairs performed by each thread */
+constexpr std::size_t pairs_per_thread = 2000000;
+
+/**
+ * The baseline: plain words guarded by a mutex, as a pool would do with
+ * bitops::set and bitops::clear
+ */
+class locked_bitset final {
+ public:
+    explicit locked_bitset(std::size_t size)
+        : m_words((size + 63) / 64, 0), m_size(size) {}
+
+    std::size_t try_acquire_first_free() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (std::size_t w = 0; w < m_words.size(); w++) {
+            const std::uint64_t free = ~m_words[w];
+            if (free == 0) continue;
+
+            const std::size_t index = 64 * w + jfern::bitops::lsb(free);
+            if (index >= m_size) break;
+
+            m_words[w] |= std::uint64_t(1) << (index % 64);
+            return index;
+        }
+        return jfern::bitops::npos;
+    }
+
+    void release(std::size_t index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        jfern::bitops::clear(static_cast<int>(index % 64),
+                             &m_words[index / 64]);
+    }
+
+ private:
+    std::mutex m_mutex;
+    std::vector<std::uint64_t> m_words;
+    std::size_t m_size;
+};
+
+/* Time every thread doing acquire/release pairs on a shared set */
+template <typename Set>
+void run(const std::string& name, std::size_t size, std::size_t threads) {
+    Set bits(size);
+
+    auto worker = [&bits]() {
+        std::size_t sink = 0;
+        for (std::size_t i = 0; i < pairs_per_thread; i++) {
+            const std::size_t index = bits.try_acquire_first_free();
+            if (index != jfern::bitops::npos) {
+                sink += index;
+                bits.release(index);
+            }
+        }
+        jfern::bench::do_not_optimize(sink);
+    };
+
+    jfern::bench::stopwatch timer;
+
+    std::vector<std::thread> pool;
+    for (std::size_t i = 0; i < threads; i++)
+        pool.emplace_back(worker);
+    for (auto& thread : pool)
+        thread.join();
+
+    jfern::bench::report(name + ", " + std::to_string(threads) + " threads",
+                         threads * pairs_per_thread, timer.seconds());
+}
+
+}  // namespace
+
+int main() {
+    const std::size_t max_threads =
+        std::max(4u, std::thread::hardware_concurrency());
+    constexpr std::size_t size = 4096;
+
+    std::printf("%zu slots, acquire + release pairs\n\n", size);
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        run<atomic_bitset>("atomic_bitset", size, threads);
+        run<locked_bitset>("mutex + bitops", size, threads);
+    }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ *  \file   attacks_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bitops/attacks.h"
+
+namespace {
+
+using jfern::bitops::basic_slider_attacks;
+
+/* A random square and occupancy per lookup */
+struct query {
+    int           square;
+    std::uint64_t occupied;
+};
+
+template <typename Lookup>
+void measure(const std::string& name, const std::vector<query>& queries,
+             Lookup lookup) {
+    constexpr int passes = 20;
+
+    std::uint64_t sink = 0;
+    jfern::bench::stopwatch timer;
+
+    for (int pass = 0; pass < passes; pass++) {
+        for (const query& q : queries) sink ^= lookup(q.square, q.occupied);
+    }
+
+    jfern::bench::report(name, passes * queries.size(), timer.seconds());
+    jfern::bench::do_not_optimize(sink);
+}
+
+template <typename Indexing>
+void run(const std::string& name, const std::vector<query>& queries) {
+    jfern::bench::stopwatch timer;
+    const basic_slider_attacks<Indexing> tables;
+    const double build = timer.seconds();
+
+    std::printf("\n%s: built in %.2f ms, %zu KiB\n", name.c_str(),
+                build * 1e3, tables.table_bytes() / 1024);
+
+    measure(name + " rook", queries,
+            [&tables](int sq, std::uint64_t occ) {
+                return tables.rook(sq, occ);
+            });
+    measure(name + " bishop", queries,
+            [&tables](int sq, std::uint64_t occ) {
+                return tables.bishop(sq, occ);
+            });
+    measure(name + " queen", queries,
+            [&tables](int sq, std::uint64_t occ) {
+                return tables.queen(sq, occ);
+            });
+}
+
+}  // namespace
+
+int main() {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+    std::uniform_int_distribution<int> squares(0, 63);
+
+    std::vector<query> queries(1 << 16);
+    for (query& q : queries) {
+        q.square   = squares(generator);
+        q.occupied = distribution(generator) & distribution(generator);
+    }
+
+    std::printf("ray walking (lsb/msb)\n");
+    measure("rays rook", queries, &jfern::bitops::rook_rays);
+    measure("rays bishop", queries, &jfern::bitops::bishop_rays);
+    measure("rays queen", queries,
+            [](int sq, std::uint64_t occ) {
+                return jfern::bitops::rook_rays(sq, occ) |
+                       jfern::bitops::bishop_rays(sq, occ);
+            });
+
+    run<jfern::bitops::magic_indexing>("magic", queries);
+    run<jfern::bitops::pext_indexing>("pext", queries);
+
+    return 0;
+}
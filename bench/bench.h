@@ -0,0 +1,94 @@
+/**
+ *  \file   bench.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  \brief Minimal timing helpers shared by the benchmark executables. Build
+ *         with -DCMAKE_BUILD_TYPE=Release for meaningful numbers
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_BENCH_BENCH_H_
+#define UTILITY_BENCH_BENCH_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace jfern {
+namespace bench {
+
+/**
+ * Prevent the compiler from optimizing away a computed value
+ *
+ * @param[in] value The value to keep alive
+ */
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * Measures elapsed wall clock time
+ */
+class stopwatch final {
+ public:
+    stopwatch() : m_start(std::chrono::steady_clock::now()) {}
+
+    /**
+     * Restart the measurement
+     */
+    void reset() {
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @return The number of seconds since construction or the last reset
+     */
+    double seconds() const {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - m_start).count();
+    }
+
+ private:
+    /** When the measurement began */
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * Print the throughput of a benchmark run
+ *
+ * @param[in] name    A description of what was measured
+ * @param[in] ops     The number of operations performed
+ * @param[in] seconds The time taken
+ */
+inline void report(const std::string& name, std::size_t ops, double seconds) {
+    std::printf("%-40s %12.2f Mops/s %10.2f ns/op\n", name.c_str(),
+                ops / seconds / 1e6, seconds * 1e9 / ops);
+}
+
+/**
+ * Print the bandwidth of a benchmark run
+ *
+ * @param[in] name    A description of what was measured
+ * @param[in] bytes   The number of bytes processed
+ * @param[in] seconds The time taken
+ */
+inline void report_bytes(const std::string& name, std::size_t bytes,
+                         double seconds) {
+    std::printf("%-40s %12.2f MB/s\n", name.c_str(), bytes / seconds / 1e6);
+}
+
+}  // namespace bench
+}  // namespace jfern
+
+#endif  // UTILITY_BENCH_BENCH_H_
@@ -0,0 +1,87 @@
+/**
+ *  \file   bloom_filter_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bitops/bloom_filter.h"
+
+namespace {
+
+using jfern::bitops::blocked_bloom_filter;
+using jfern::bitops::counting_bloom_filter;
+using jfern::bitops::split_block_bloom_filter;
+
+/** Keys inserted, enough for the filters to outgrow the cache */
+constexpr std::size_t items = 4000000;
+
+/* A well mixed hash of a counter (SplitMix64) */
+std::uint64_t mix(std::uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+/*
+ * Report the false positive rate, then the query rate one key at a time and
+ * in prefetching batches. Queries are all for absent keys, the common case
+ * for a pre-filter
+ */
+template <typename Filter>
+void run(const std::string& name, double bits_per_item,
+         const std::vector<std::uint64_t>& present,
+         const std::vector<std::uint64_t>& absent) {
+    Filter filter(items, bits_per_item);
+    filter.insert(present.data(), present.size());
+
+    std::unique_ptr<bool[]> results(new bool[absent.size()]);
+
+    std::size_t hits = 0;
+
+    jfern::bench::stopwatch timer;
+    for (std::uint64_t hash : absent) hits += filter.contains(hash);
+    const double single = timer.seconds();
+
+    timer.reset();
+    filter.contains(absent.data(), absent.size(), results.get());
+    const double batched = timer.seconds();
+
+    std::printf("%-22s %5.1f bits/key  FPR %7.4f%%  %8.2f Mq/s  %8.2f Mq/s"
+                " batched\n", name.c_str(), bits_per_item,
+                100.0 * hits / absent.size(), absent.size() / single / 1e6,
+                absent.size() / batched / 1e6);
+}
+
+}  // namespace
+
+int main() {
+    std::vector<std::uint64_t> present(items), absent(items);
+    for (std::size_t i = 0; i < items; i++) {
+        present[i] = mix(i);
+        absent[i]  = mix(i + items);
+    }
+
+    std::printf("%zu keys\n\n", items);
+
+    for (double bits : {8.0, 10.0, 12.0, 16.0}) {
+        run<blocked_bloom_filter>("blocked", bits, present, absent);
+        run<split_block_bloom_filter>("split block", bits, present, absent);
+        run<counting_bloom_filter>("counting", bits, present, absent);
+        std::printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ *  \file   csv_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "bench/bench.h"
+#include "superstring/csv.h"
+#include "superstring/search.h"
+#include "superstring/superstring.h"
+
+namespace {
+
+namespace search = jfern::search;
+
+using jfern::superstring;
+
+/** The size of the input */
+constexpr std::size_t text_size = 128 * 1024 * 1024;
+
+/*
+ * Rows of ids, prices, names and free text. One field in eight is quoted,
+ * some with embedded delimiters
+ */
+std::string make_text() {
+    std::mt19937 generator(6);
+    std::uniform_int_distribution<int> length(1, 24);
+    std::uniform_int_distribution<int> letter('a', 'z');
+
+    std::string text;
+    text.reserve(text_size + 256);
+
+    while (text.size() < text_size) {
+        text += std::to_string(generator() % 1000000) + ',';
+        text += std::to_string(generator() % 10000) + '.' +
+                std::to_string(generator() % 100) + ',';
+
+        for (int field = 0; field < 4; field++) {
+            const bool quoted = generator() % 8 == 0;
+            if (quoted) text += '"';
+
+            for (int i = length(generator); i > 0; i--)
+                text += static_cast<char>(letter(generator));
+            if (quoted) text += ", etc.\"";
+
+            text += field == 3 ? '\n' : ',';
+        }
+    }
+
+    return text;
+}
+
+/* Read every field, touching its size so the views are not optimized out */
+std::size_t read_all(jfern::csv_reader* reader) {
+    std::size_t size = 0;
+
+    jfern::csv_record record;
+    while (reader->next(&record)) {
+        for (const jfern::csv_field& field : record)
+            size += field.view().size();
+    }
+
+    return size;
+}
+
+}  // namespace
+
+int main() {
+    const std::string text = make_text();
+    std::printf("%zu MB\n\n", text.size() >> 20);
+
+    {
+        jfern::bench::stopwatch timer;
+
+        std::size_t size = 0;
+        for (const std::string& line : superstring(text).split("\n")) {
+            for (const std::string& field : superstring(line).split(","))
+                size += field.size();
+        }
+
+        jfern::bench::report_bytes("split(\"\\n\"), split(\",\")",
+                                   text.size(), timer.seconds());
+        jfern::bench::do_not_optimize(size);
+    }
+
+    const search::level saved = search::active_level();
+
+    for (search::level isa : {search::level::scalar, search::level::sse2,
+                              search::level::avx2}) {
+        if (isa > search::supported_level()) continue;
+        search::set_active_level(isa);
+
+        const char* const names[] = {"csv_reader, scalar", "csv_reader, sse2",
+                                     "csv_reader, avx2"};
+
+        jfern::bench::stopwatch timer;
+        jfern::csv_reader reader(text);
+        jfern::bench::do_not_optimize(read_all(&reader));
+
+        jfern::bench::report_bytes(names[static_cast<int>(isa)], text.size(),
+                                   timer.seconds());
+    }
+
+    search::set_active_level(saved);
+
+    {
+        std::istringstream stream(text);
+
+        jfern::bench::stopwatch timer;
+        jfern::csv_reader reader(stream);
+        jfern::bench::do_not_optimize(read_all(&reader));
+
+        jfern::bench::report_bytes("csv_reader, std::istream", text.size(),
+                                   timer.seconds());
+    }
+
+    return 0;
+}
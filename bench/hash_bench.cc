@@ -0,0 +1,234 @@
+/**
+ *  \file   hash_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/hash.h"
+#include "superstring/search.h"
+#include "superstring/superstring_view.h"
+
+namespace {
+
+namespace search = jfern::search;
+
+using jfern::hashed_string;
+using jfern::hashed_view;
+using jfern::superstring_view;
+
+/** The number of small keys hashed per size */
+constexpr std::size_t small_keys = 1 << 16;
+
+/** The passes over the small keys */
+constexpr int small_passes = 64;
+
+/** The bytes hashed per large key size */
+constexpr std::size_t large_bytes = std::size_t(1) << 30;
+
+/** The size of the large key buffer, which fits in the L2 cache */
+constexpr std::size_t buffer_size = 256 * 1024;
+
+/** The distinct words in the lookup test */
+constexpr std::size_t words = 50000;
+
+/** The lookups made */
+constexpr std::size_t lookups = 4000000;
+
+std::string random_bytes(std::size_t size, std::mt19937_64* engine) {
+    std::string bytes(size, '\0');
+    for (char& c : bytes) c = static_cast<char>('a' + (*engine)() % 26);
+    return bytes;
+}
+
+/* Hash each key in turn, many times over */
+template <class Hash>
+void run_small(const std::string& name, const std::vector<std::string>& keys,
+               Hash hash) {
+    jfern::bench::stopwatch timer;
+
+    std::uint64_t sum = 0;
+    for (int pass = 0; pass < small_passes; pass++) {
+        for (const std::string& key : keys) sum += hash(key);
+    }
+
+    jfern::bench::do_not_optimize(sum);
+    jfern::bench::report(name, small_passes * keys.size(), timer.seconds());
+}
+
+/* Hash a key of each size over and over, reporting the bytes per second */
+template <class Hash>
+void run_large(const std::string& name, const std::string& buffer,
+               std::size_t size, Hash hash) {
+    const superstring_view key(buffer.data(), size);
+    const std::size_t count = large_bytes / size;
+
+    jfern::bench::stopwatch timer;
+
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < count; i++) sum += hash(key);
+
+    jfern::bench::do_not_optimize(sum);
+    jfern::bench::report_bytes(name, count * size, timer.seconds());
+}
+
+/*
+ * Look up views of tokens in a table of words, as after splitting a line:
+ * with std::hash, each view must first become a std::string
+ */
+void run_lookups(const std::vector<std::string>& table_words,
+                 const std::vector<superstring_view>& tokens) {
+    {
+        std::unordered_map<std::string, int> table;
+        for (const std::string& word : table_words) table[word] = 1;
+
+        jfern::bench::stopwatch timer;
+
+        std::size_t found = 0;
+        for (const superstring_view& token : tokens)
+            found += table.count(std::string(token.data(), token.size()));
+
+        jfern::bench::do_not_optimize(found);
+        jfern::bench::report("unordered_map<std::string>::count",
+                             tokens.size(), timer.seconds());
+    }
+
+    {
+        std::unordered_map<hashed_string, int, jfern::string_hash,
+                           jfern::string_equal> table;
+        for (const std::string& word : table_words) table[word] = 1;
+
+        jfern::bench::stopwatch timer;
+
+        std::size_t found = 0;
+        for (const superstring_view& token : tokens)
+            found += jfern::find_key(table, token) != table.end();
+
+        jfern::bench::do_not_optimize(found);
+        jfern::bench::report("find_key(hashed_string map, view)",
+                             tokens.size(), timer.seconds());
+
+        /* The hashes computed once, up front, and reused */
+        std::vector<hashed_view> hashed(tokens.begin(), tokens.end());
+
+        timer.reset();
+
+        found = 0;
+        for (const hashed_view& token : hashed)
+            found += jfern::find_key(table, token) != table.end();
+
+        jfern::bench::do_not_optimize(found);
+        jfern::bench::report("find_key(hashed_string map, hashed_view)",
+                             tokens.size(), timer.seconds());
+    }
+
+    {
+        std::unordered_map<superstring_view, int, jfern::string_hash,
+                           jfern::string_equal> table;
+        for (const std::string& word : table_words)
+            table[superstring_view(word)] = 1;
+
+        jfern::bench::stopwatch timer;
+
+        std::size_t found = 0;
+        for (const superstring_view& token : tokens)
+            found += table.count(token);
+
+        jfern::bench::do_not_optimize(found);
+        jfern::bench::report("unordered_map<superstring_view>::count",
+                             tokens.size(), timer.seconds());
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937_64 engine(19);
+
+    std::printf("Small keys:\n\n");
+
+    for (std::size_t size : {4, 8, 16, 32, 64, 256}) {
+        std::vector<std::string> keys;
+        for (std::size_t i = 0; i < small_keys; i++)
+            keys.push_back(random_bytes(size, &engine));
+
+        const std::string suffix = ", " + std::to_string(size) + " bytes";
+
+        run_small("std::hash<std::string>" + suffix, keys,
+                  std::hash<std::string>());
+        run_small("jfern::hash64" + suffix, keys,
+                  [](const std::string& key) { return jfern::hash64(key); });
+    }
+
+    std::printf("\nLarge keys:\n\n");
+
+    const std::string buffer = random_bytes(buffer_size, &engine);
+    const search::level saved = search::active_level();
+
+    for (std::size_t size : {std::size_t(1024), std::size_t(4096),
+                             buffer_size}) {
+        const std::string suffix = ", " + std::to_string(size) + " bytes";
+
+        run_large("std::hash<std::string>" + suffix, buffer, size,
+                  [](superstring_view key) {
+                      return std::hash<std::string>()(
+                          std::string(key.data(), key.size()));
+                  });
+
+        for (search::level isa : {search::level::scalar, search::level::sse2,
+                                  search::level::avx2}) {
+            if (isa > search::supported_level()) continue;
+            search::set_active_level(isa);
+
+            const char* const names[] = {"jfern::hash64, scalar",
+                                         "jfern::hash64, sse2",
+                                         "jfern::hash64, avx2"};
+
+            run_large(names[static_cast<int>(isa)] + suffix, buffer, size,
+                      [](superstring_view key) {
+                          return jfern::hash64(key);
+                      });
+        }
+
+        search::set_active_level(saved);
+    }
+
+    std::printf("\nLookups of split tokens:\n\n");
+
+    std::vector<std::string> table_words;
+    for (std::size_t i = 0; i < words; i++)
+        table_words.push_back(random_bytes(3 + engine() % 12, &engine));
+
+    /* Half the tokens are in the table */
+    std::string text;
+    std::vector<std::pair<std::size_t, std::size_t>> spans;
+    for (std::size_t i = 0; i < lookups; i++) {
+        const std::string word = i % 2 == 0
+            ? table_words[engine() % words]
+            : random_bytes(3 + engine() % 12, &engine);
+        spans.emplace_back(text.size(), word.size());
+        text += word + ' ';
+    }
+
+    std::vector<superstring_view> tokens;
+    for (const auto& span : spans)
+        tokens.emplace_back(text.data() + span.first, span.second);
+
+    run_lookups(table_words, tokens);
+
+    return 0;
+}
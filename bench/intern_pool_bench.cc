@@ -0,0 +1,184 @@
+/**
+ *  \file   intern_pool_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/intern_pool.h"
+#include "superstring/superstring.h"
+#include "superstring/tokenizer.h"
+
+namespace {
+
+using jfern::intern_pool;
+using jfern::superstring_view;
+
+/** Approximate size of the generated records, in bytes */
+constexpr std::size_t record_bytes = std::size_t(1) << 24;
+
+/** Bytes requested from the global heap by the current thread */
+thread_local std::size_t t_heap_bytes = 0;
+
+/*
+ * Space separated records drawn from a few thousand distinct tokens, as in
+ * parsed access logs
+ */
+std::vector<std::string> make_records() {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> host(0, 999);
+    std::uniform_int_distribution<int> path(0, 1999);
+    std::uniform_int_distribution<int> status(0, 5);
+
+    const char* methods[] = {"GET", "POST", "PUT", "DELETE"};
+    const char* codes[] = {"200", "201", "204", "304", "404", "500"};
+
+    std::vector<std::string> records;
+    std::size_t size = 0;
+
+    while (size < record_bytes) {
+        std::string record = "host-" + std::to_string(host(generator)) +
+                             ".internal.example.com ";
+        record += methods[status(generator) % 4];
+        record += " /api/v1/collection/" + std::to_string(path(generator));
+        record += " HTTP/1.1 ";
+        record += codes[status(generator)];
+        record += " application/json";
+
+        size += record.size();
+        records.push_back(std::move(record));
+    }
+
+    return records;
+}
+
+void run_memory(const std::vector<std::string>& records) {
+    jfern::bench::stopwatch timer;
+    std::size_t heap = t_heap_bytes;
+    std::size_t tokens = 0;
+
+    std::vector<std::vector<std::string>> split;
+    split.reserve(records.size());
+    for (const std::string& record : records) {
+        split.push_back(jfern::superstring(record).split());
+        tokens += split.back().size();
+    }
+
+    jfern::bench::report("split into std::strings", tokens,
+                         timer.seconds());
+    std::printf("%-40s %12.2f MB\n", "", (t_heap_bytes - heap) / 1e6);
+
+    timer.reset();
+    heap = t_heap_bytes;
+
+    intern_pool pool;
+    std::vector<std::vector<intern_pool::id_type>> interned;
+    interned.reserve(records.size());
+    for (const std::string& record : records)
+        interned.push_back(jfern::superstring(record).split_interned(pool));
+
+    jfern::bench::report("split_interned", tokens, timer.seconds());
+    std::printf("%-40s %12.2f MB, %zu distinct tokens\n", "",
+                (t_heap_bytes - heap) / 1e6, pool.size());
+
+    /* Count tokens in a map, keyed by string or by ID */
+    timer.reset();
+    std::unordered_map<std::string, std::size_t> by_string;
+    for (const auto& fields : split)
+        for (const std::string& field : fields) by_string[field]++;
+    jfern::bench::report("count by std::string key", tokens,
+                         timer.seconds());
+
+    timer.reset();
+    std::unordered_map<intern_pool::id_type, std::size_t> by_id;
+    for (const auto& ids : interned)
+        for (intern_pool::id_type id : ids) by_id[id]++;
+    jfern::bench::report("count by ID key", tokens, timer.seconds());
+
+    jfern::bench::do_not_optimize(by_string.size() + by_id.size());
+    std::printf("\n");
+}
+
+/* Every thread interns its share of the records into one pool */
+void run_threads(const std::vector<std::string>& records,
+                 std::size_t threads, std::size_t shards) {
+    intern_pool pool(shards);
+
+    auto worker = [&](std::size_t first) {
+        std::size_t sink = 0;
+        for (std::size_t i = first; i < records.size(); i += threads) {
+            for (superstring_view token : jfern::tokenize(records[i]))
+                sink += pool.intern(token);
+        }
+        jfern::bench::do_not_optimize(sink);
+    };
+
+    jfern::bench::stopwatch timer;
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threads; i++)
+        workers.emplace_back(worker, i);
+    for (auto& thread : workers)
+        thread.join();
+
+    std::size_t tokens = 0;
+    for (const std::string& record : records)
+        tokens += std::count(record.begin(), record.end(), ' ') + 1;
+
+    jfern::bench::report("intern, " + std::to_string(shards) + " shards, " +
+                             std::to_string(threads) + " threads",
+                         tokens, timer.seconds());
+}
+
+}  // namespace
+
+/*
+ * Count bytes requested from the global heap. The counter is per thread so
+ * that counting does not itself add contention between threads
+ */
+
+void* operator new(std::size_t size) {
+    t_heap_bytes += size;
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+int main() {
+    const std::vector<std::string> records = make_records();
+    std::printf("%zu records\n\n", records.size());
+
+    run_memory(records);
+
+    const std::size_t max_threads =
+        std::max(4u, std::thread::hardware_concurrency());
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        run_threads(records, threads, 1);
+        run_threads(records, threads, intern_pool::default_shards);
+    }
+
+    return 0;
+}
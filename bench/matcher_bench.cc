@@ -0,0 +1,164 @@
+/**
+ *  \file   matcher_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/matcher.h"
+#include "superstring/tokenizer.h"
+
+namespace {
+
+using jfern::matcher;
+using jfern::prefilter;
+using jfern::superstring_view;
+
+/** Approximate size of the generated log, in bytes */
+constexpr std::size_t log_bytes = std::size_t(1) << 25;
+
+/* Log lines, a few of which mention one of the keywords */
+std::string make_log(const std::vector<std::string>& keywords) {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> number(0, 99999);
+
+    const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+
+    std::string log;
+    log.reserve(log_bytes + 256);
+
+    while (log.size() < log_bytes) {
+        const int n = number(generator);
+        log += "2026-10-16T12:34:56 ";
+        log += levels[n % 4];
+        log += " worker-" + std::to_string(n % 64);
+        log += " handled request id=" + std::to_string(n);
+        log += " path=/api/v1/items/" + std::to_string(n % 977);
+        if (n % 100 == 0) log += " " + keywords[n % keywords.size()];
+        log += " latency_ms=" + std::to_string(n % 250) + "\n";
+    }
+
+    return log;
+}
+
+/* Random lower case words, starting with a variety of letters */
+std::vector<std::string> make_keywords(std::size_t count) {
+    std::default_random_engine generator(7);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::uniform_int_distribution<int> length(6, 14);
+
+    std::vector<std::string> keywords;
+    for (std::size_t i = 0; i < count; i++) {
+        std::string word;
+        for (int n = length(generator); n > 0; n--)
+            word.push_back(static_cast<char>(letter(generator)));
+        keywords.push_back(word);
+    }
+
+    return keywords;
+}
+
+/* Lower case words only, so nearly every byte could begin a keyword */
+std::string make_prose(const std::vector<std::string>& keywords) {
+    std::default_random_engine generator(11);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::uniform_int_distribution<int> length(1, 9);
+
+    std::string prose;
+    prose.reserve(log_bytes + 256);
+
+    while (prose.size() < log_bytes) {
+        for (int n = length(generator); n > 0; n--)
+            prose.push_back(static_cast<char>(letter(generator)));
+
+        prose.push_back(prose.size() % 97 < 10 ? '\n' : ' ');
+        if (prose.size() % 1000 < 10) prose += keywords.front() + " ";
+    }
+
+    return prose;
+}
+
+const char* name(prefilter mode) {
+    switch (mode) {
+      case prefilter::on:
+        return ", prefilter on";
+      case prefilter::automatic:
+        return ", prefilter automatic";
+      default:
+        return ", prefilter off";
+    }
+}
+
+void run(const std::string& corpus, const std::vector<std::string>& keywords,
+         const std::string& log) {
+    std::vector<superstring_view> lines;
+    for (superstring_view line : jfern::tokenize(log, '\n'))
+        lines.push_back(line);
+
+    std::printf("%s, %zu keywords, %zu bytes, %zu lines\n", corpus.c_str(),
+                keywords.size(), log.size(), lines.size());
+
+    const superstring_view text(log);
+    jfern::bench::stopwatch timer;
+    std::size_t sink = 0;
+
+    /* Baseline: one search per keyword per line */
+    for (superstring_view line : lines) {
+        for (const std::string& keyword : keywords) {
+            if (line.find(keyword) != superstring_view::npos) {
+                sink++;
+                break;
+            }
+        }
+    }
+    jfern::bench::report_bytes("baseline: find per keyword per line",
+                               log.size(), timer.seconds());
+
+    timer.reset();
+    const matcher compiled(keywords.begin(), keywords.end());
+    std::printf("%-40s %12zu states %8.2f ms\n", "matcher: compile",
+                compiled.states(), timer.seconds() * 1e3);
+
+    for (prefilter mode : {prefilter::off, prefilter::on,
+                           prefilter::automatic}) {
+        const matcher m(keywords.begin(), keywords.end(), mode);
+
+        timer.reset();
+        for (superstring_view line : lines) sink += m.contains(line);
+        jfern::bench::report_bytes(
+            std::string("contains per line") + name(mode), log.size(),
+            timer.seconds());
+
+        timer.reset();
+        sink += m.find_all(text).size();
+        jfern::bench::report_bytes(std::string("find_all") + name(mode),
+                                   log.size(), timer.seconds());
+    }
+
+    jfern::bench::do_not_optimize(sink);
+    std::printf("\n");
+}
+
+}  // namespace
+
+int main() {
+    for (std::size_t count : {4, 32, 500}) {
+        const std::vector<std::string> keywords = make_keywords(count);
+        run("log", keywords, make_log(keywords));
+    }
+
+    const std::vector<std::string> keywords = make_keywords(500);
+    run("prose", keywords, make_prose(keywords));
+
+    return 0;
+}
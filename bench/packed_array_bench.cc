@@ -0,0 +1,101 @@
+/**
+ *  \file   packed_array_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bitops/packed_array.h"
+
+namespace {
+
+using jfern::bitops::delta_packed_array;
+using jfern::bitops::packed_array;
+
+/** Values per run */
+constexpr std::size_t count = std::size_t(1) << 24;
+
+template <int Bits>
+void run() {
+    const std::string prefix = std::to_string(Bits) + " bits: ";
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint32_t> distribution(
+        0, packed_array<Bits>::max_value);
+
+    std::vector<std::uint32_t> values(count), out(count);
+    for (auto& value : values) value = distribution(generator);
+
+    jfern::bench::stopwatch timer;
+    const packed_array<Bits> packed(values.data(), count);
+    jfern::bench::report_bytes(prefix + "pack", count * 4, timer.seconds());
+
+    std::printf("%-40s %12.2fx smaller\n", (prefix + "memory").c_str(),
+                count * 4.0 / packed.memory_bytes());
+
+    /*
+     * Sequential decode, one 1024-value chunk at a time into a buffer that
+     * stays in cache, summed as a scan would consume it
+     */
+    std::uint32_t chunk[1024];
+    std::uint64_t sink = 0;
+
+    timer.reset();
+    for (int rep = 0; rep < 4; rep++) {
+        for (std::size_t i = 0; i < count; i += 1024) {
+            packed.unpack(i, 1024, chunk);
+            for (std::uint32_t v : chunk) sink += v;
+        }
+    }
+    jfern::bench::report_bytes(prefix + "unpack", 4 * count * 4,
+                               timer.seconds());
+
+    std::uniform_int_distribution<std::size_t> index_dist(0, count - 1);
+    std::vector<std::size_t> indexes(1000000);
+    for (auto& index : indexes) index = index_dist(generator);
+
+    timer.reset();
+    for (std::size_t index : indexes) sink += packed[index];
+    jfern::bench::report(prefix + "random get", indexes.size(),
+                         timer.seconds());
+
+    /* Sorted values whose gaps fit in the width, without overflowing */
+    std::uint32_t value = 0;
+    for (auto& v : values) v = value += distribution(generator) & 0xff;
+
+    const delta_packed_array<Bits> deltas(values.data(), count);
+
+    timer.reset();
+    for (int rep = 0; rep < 4; rep++)
+        deltas.decode(out.data());
+    jfern::bench::report_bytes(prefix + "delta decode", 4 * count * 4,
+                               timer.seconds());
+
+    jfern::bench::do_not_optimize(sink);
+    jfern::bench::do_not_optimize(out.data()[count / 2]);
+    std::printf("\n");
+}
+
+}  // namespace
+
+int main() {
+    std::printf("%zu values\n\n", count);
+
+    run<3>();
+    run<7>();
+    run<12>();
+    run<20>();
+
+    return 0;
+}
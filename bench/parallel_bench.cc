@@ -0,0 +1,119 @@
+/**
+ *  \file   parallel_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "bench/bench.h"
+#include "superstring/parallel.h"
+
+namespace {
+
+using jfern::superstring;
+using jfern::thread_pool;
+
+/** The size of the input */
+constexpr std::size_t text_size = 128 * 1024 * 1024;
+
+/* Comma-separated fields of 1 to 16 characters, some padded with spaces */
+superstring make_text() {
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<int> length(1, 16);
+    std::uniform_int_distribution<int> letter('A', 'z');
+
+    std::string text;
+    text.reserve(text_size + 32);
+    while (text.size() < text_size) {
+        if (generator() % 4 == 0) text += ' ';
+        for (int i = length(generator); i > 0; i--)
+            text += static_cast<char>(letter(generator));
+        text += ',';
+    }
+
+    return superstring(std::move(text));
+}
+
+/*
+ * Time an operation sequentially and then on pools of increasing size, and
+ * print the speedup over the sequential version
+ */
+template <class Sequential, class Parallel>
+void run(const char* name, const superstring& text, Sequential sequential,
+         Parallel parallel, std::size_t max_threads) {
+    jfern::bench::stopwatch timer;
+    jfern::bench::do_not_optimize(sequential(text));
+    const double baseline = timer.seconds();
+
+    jfern::bench::report_bytes(std::string(name) + ", sequential",
+                               text.view().size(), baseline);
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        thread_pool pool(threads);
+
+        timer.reset();
+        jfern::bench::do_not_optimize(parallel(pool, text));
+        const double seconds = timer.seconds();
+
+        jfern::bench::report_bytes(std::string(name) + ", " +
+                                       std::to_string(threads) + " threads",
+                                   text.view().size(), seconds);
+        std::printf("%-40s %12.2fx\n", "", baseline / seconds);
+    }
+
+    std::printf("\n");
+}
+
+}  // namespace
+
+int main() {
+    const superstring text = make_text();
+
+    const std::size_t max_threads =
+        std::max<std::size_t>(4, thread_pool::default_threads());
+
+    std::printf("%zu MB, %zu hardware threads\n\n", text.view().size() >> 20,
+                thread_pool::default_threads());
+
+    run("split(\",\")", text,
+        [](const superstring& str) { return str.split(",").size(); },
+        [](thread_pool& pool, const superstring& str) {
+            return jfern::parallel::split(pool, str, ",").size();
+        }, max_threads);
+
+    run("split(64)", text,
+        [](const superstring& str) { return str.split(64).size(); },
+        [](thread_pool& pool, const superstring& str) {
+            return jfern::parallel::split(pool, str, 64).size();
+        }, max_threads);
+
+    run("split_trimmed(\",\")", text,
+        [](const superstring& str) {
+            std::size_t size = 0;
+            for (const std::string& token : str.split(","))
+                size += superstring(token).trim_inplace().view().size();
+            return size;
+        },
+        [](thread_pool& pool, const superstring& str) {
+            return jfern::parallel::split_trimmed(pool, str, ",").size();
+        }, max_threads);
+
+    run("to_lower", text,
+        [](const superstring& str) { return str.to_lower().view().size(); },
+        [](thread_pool& pool, const superstring& str) {
+            return jfern::parallel::to_lower(pool, str).view().size();
+        }, max_threads);
+
+    return 0;
+}
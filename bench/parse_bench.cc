@@ -0,0 +1,130 @@
+/**
+ *  \file   parse_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/parse.h"
+
+namespace {
+
+/** The number of fields in each column */
+constexpr std::size_t fields = 2000000;
+
+/* Integers of every width, as they appear in e.g. a CSV id column */
+std::vector<std::string> make_integers() {
+    std::mt19937_64 generator(3);
+    std::vector<std::string> column;
+
+    for (std::size_t i = 0; i < fields; i++) {
+        const std::int64_t value =
+            static_cast<std::int64_t>(generator()) >> (generator() % 63);
+        column.push_back(std::to_string(value));
+    }
+
+    return column;
+}
+
+/* Prices, measurements and coordinates of mixed precision */
+std::vector<std::string> make_doubles() {
+    std::mt19937_64 generator(4);
+    std::uniform_real_distribution<double> magnitude(-8, 8);
+    char buffer[64];
+
+    std::vector<std::string> column;
+    for (std::size_t i = 0; i < fields; i++) {
+        const double value = std::pow(10.0, magnitude(generator)) *
+                             (generator() % 2 ? 1 : -1);
+        std::snprintf(buffer, sizeof(buffer), "%.*g",
+                      static_cast<int>(generator() % 17) + 1, value);
+        column.push_back(buffer);
+    }
+
+    return column;
+}
+
+template <class Parse>
+void run(const char* name, const std::vector<std::string>& column,
+         Parse parse) {
+    jfern::bench::stopwatch timer;
+
+    double sum = 0;
+    for (const std::string& field : column)
+        sum += parse(field);
+
+    jfern::bench::report(name, column.size(), timer.seconds());
+    jfern::bench::do_not_optimize(sum);
+}
+
+}  // namespace
+
+int main() {
+    const std::vector<std::string> integers = make_integers();
+    const std::vector<std::string> doubles = make_doubles();
+
+    run("std::stoll", integers, [](const std::string& field) {
+        return static_cast<double>(std::stoll(field));
+    });
+
+    run("std::strtoll", integers, [](const std::string& field) {
+        return static_cast<double>(std::strtoll(field.c_str(), nullptr, 10));
+    });
+
+    run("parse(int64_t)", integers, [](const std::string& field) {
+        std::int64_t value;
+        jfern::parse(field, &value);
+        return static_cast<double>(value);
+    });
+
+    {
+        jfern::bench::stopwatch timer;
+        std::vector<std::int64_t> values(integers.size());
+        jfern::parse_column(integers.begin(), integers.end(), values.data());
+
+        jfern::bench::report("parse_column(int64_t)", integers.size(),
+                             timer.seconds());
+        jfern::bench::do_not_optimize(values.back());
+    }
+
+    std::printf("\n");
+
+    run("std::stod", doubles, [](const std::string& field) {
+        return std::stod(field);
+    });
+
+    run("std::strtod", doubles, [](const std::string& field) {
+        return std::strtod(field.c_str(), nullptr);
+    });
+
+    run("parse(double)", doubles, [](const std::string& field) {
+        double value;
+        jfern::parse(field, &value);
+        return value;
+    });
+
+    {
+        jfern::bench::stopwatch timer;
+        std::vector<double> values(doubles.size());
+        jfern::parse_column(doubles.begin(), doubles.end(), values.data());
+
+        jfern::bench::report("parse_column(double)", doubles.size(),
+                             timer.seconds());
+        jfern::bench::do_not_optimize(values.back());
+    }
+
+    return 0;
+}
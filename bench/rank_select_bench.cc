@@ -0,0 +1,118 @@
+/**
+ *  \file   rank_select_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bitops/bitops.h"
+#include "bitops/rank_select.h"
+
+namespace {
+
+using jfern::bitops::bitvector;
+using jfern::bitops::rank_select;
+
+/* Count the set bits before an index with a linear sweep */
+std::size_t naive_rank(const bitvector& bits, std::size_t index) {
+    std::size_t result = 0;
+    for (std::size_t w = 0; w < index / 64; w++)
+        result += jfern::bitops::count(bits.data()[w]);
+
+    if (index % 64 != 0) {
+        result += jfern::bitops::count(bits.data()[index / 64] &
+                                       ~(~std::uint64_t(0) << (index % 64)));
+    }
+
+    return result;
+}
+
+/* Find the k-th set bit with a linear sweep */
+std::size_t naive_select(const bitvector& bits, std::size_t k) {
+    for (std::size_t w = 0; w < bits.num_words(); w++) {
+        std::uint64_t word = bits.data()[w];
+        const std::size_t c = jfern::bitops::count(word);
+
+        if (k < c) {
+            for (; k > 0; k--) word &= word - 1;
+            return w * 64 + jfern::bitops::lsb(word);
+        }
+
+        k -= c;
+    }
+
+    return jfern::bitops::npos;
+}
+
+void run(std::size_t size, int density) {
+    std::printf("\n%zu bits, 1 in %d set\n", size, density);
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> bit_dist(0, density - 1);
+
+    bitvector bits(size);
+    for (std::size_t i = 0; i < size; i++) {
+        if (bit_dist(generator) == 0) bits.set(i);
+    }
+
+    jfern::bench::stopwatch timer;
+    const rank_select index(bits);
+    const double build = timer.seconds();
+
+    std::printf("build: %.2f ms, overhead %.2f%%\n", build * 1e3,
+                100.0 * index.space_bytes() / (bits.num_words() * 8));
+
+    const std::size_t total = index.count();
+    if (total == 0) return;
+
+    std::uniform_int_distribution<std::size_t> pos_dist(0, size);
+    std::uniform_int_distribution<std::size_t> rank_dist(0, total - 1);
+
+    constexpr std::size_t queries = 1000000;
+    constexpr std::size_t naive_queries = 200;
+
+    std::vector<std::size_t> positions(queries), ranks(queries);
+    for (auto& p : positions) p = pos_dist(generator);
+    for (auto& r : ranks)     r = rank_dist(generator);
+
+    std::size_t sink = 0;
+
+    timer.reset();
+    for (std::size_t p : positions) sink += index.rank(p);
+    jfern::bench::report("rank_select::rank", queries, timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0; i < naive_queries; i++)
+        sink += naive_rank(bits, positions[i]);
+    jfern::bench::report("naive rank", naive_queries, timer.seconds());
+
+    timer.reset();
+    for (std::size_t r : ranks) sink += index.select(r);
+    jfern::bench::report("rank_select::select", queries, timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0; i < naive_queries; i++)
+        sink += naive_select(bits, ranks[i]);
+    jfern::bench::report("naive select", naive_queries, timer.seconds());
+
+    jfern::bench::do_not_optimize(sink);
+}
+
+}  // namespace
+
+int main() {
+    run(std::size_t(1) << 26, 2);
+    run(std::size_t(1) << 26, 100);
+    run(std::size_t(1) << 28, 2);
+    return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ *  \file   rope_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/rope.h"
+#include "superstring/superstring.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using jfern::rope;
+using jfern::superstring_view;
+
+/** The size of each assembled payload */
+constexpr std::size_t payload_size = 64 * 1024 * 1024;
+
+/** The size of the document edited in place */
+constexpr std::size_t document_size = 16 * 1024 * 1024;
+
+/* Short pieces of 8 to 200 characters, like serialized fields */
+std::vector<std::string> make_pieces() {
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<std::size_t> length(8, 200);
+    std::uniform_int_distribution<int> letter('a', 'z');
+
+    std::vector<std::string> pieces;
+    std::size_t size = 0;
+    while (size < payload_size) {
+        std::string piece(length(generator), ' ');
+        for (char& c : piece) c = static_cast<char>(letter(generator));
+
+        size += piece.size();
+        pieces.push_back(std::move(piece));
+    }
+
+    return pieces;
+}
+
+/* Many short appends */
+void run_append_short(const std::vector<std::string>& pieces) {
+    jfern::bench::stopwatch timer;
+    std::string flat;
+    for (const std::string& piece : pieces) flat += piece;
+    jfern::bench::report_bytes("append short, std::string", flat.size(),
+                               timer.seconds());
+
+    timer.reset();
+    const std::string built =
+        jfern::superstring::build("", pieces.begin(), pieces.end());
+    jfern::bench::report_bytes("append short, superstring::build",
+                               built.size(), timer.seconds());
+
+    timer.reset();
+    rope text;
+    for (const std::string& piece : pieces) text += piece;
+    jfern::bench::report_bytes("append short, rope", text.size(),
+                               timer.seconds());
+
+    jfern::bench::do_not_optimize(flat.size() + built.size() + text.size());
+}
+
+/* Appending buffers that are already filled in, 1 MiB at a time */
+void run_append_long() {
+    constexpr std::size_t block_size = 1024 * 1024;
+
+    std::vector<std::string> blocks(payload_size / block_size,
+                                    std::string(block_size, 'x'));
+
+    jfern::bench::stopwatch timer;
+    std::string flat;
+    for (const std::string& block : blocks) flat += block;
+    jfern::bench::report_bytes("append 1 MiB blocks, std::string",
+                               flat.size(), timer.seconds());
+
+    timer.reset();
+    rope text;
+    for (std::string& block : blocks) text.append(std::move(block));
+    jfern::bench::report_bytes("append 1 MiB blocks, rope (moved)",
+                               text.size(), timer.seconds());
+
+    jfern::bench::do_not_optimize(flat.size() + text.size());
+}
+
+/* Random small insertions and erasures all over a large document */
+void run_edits() {
+    constexpr std::size_t edits = 20000;
+
+    const std::string document(document_size, 'd');
+
+    std::mt19937 generator(2);
+    std::vector<std::size_t> positions(edits), lengths(edits);
+    for (std::size_t i = 0; i < edits; i++) {
+        positions[i] = generator();
+        lengths[i] = 1 + generator() % 64;
+    }
+    const std::string insertion(64, 'i');
+
+    jfern::bench::stopwatch timer;
+    std::string flat(document);
+    for (std::size_t i = 0; i < edits; i++) {
+        const std::size_t pos = positions[i] % (flat.size() - 64);
+        if (i % 2 == 0) {
+            flat.insert(pos, insertion, 0, lengths[i]);
+        } else {
+            flat.erase(pos, lengths[i]);
+        }
+    }
+    jfern::bench::report("edit 16 MiB, std::string", edits,
+                         timer.seconds());
+
+    timer.reset();
+    rope text(document);
+    for (std::size_t i = 0; i < edits; i++) {
+        const std::size_t pos = positions[i] % (text.size() - 64);
+        if (i % 2 == 0) {
+            text.insert(pos, superstring_view(insertion.data(), lengths[i]));
+        } else {
+            text.erase(pos, lengths[i]);
+        }
+    }
+    jfern::bench::report("edit 16 MiB, rope", edits, timer.seconds());
+
+    std::printf("%-40s %12zu chunks, depth %zu\n", "",
+                static_cast<std::size_t>(std::distance(
+                    text.chunks().begin(), text.chunks().end())),
+                text.depth());
+
+    if (text != flat) std::printf("rope and std::string differ!\n");
+}
+
+/* Slices of 64 KiB to 1 MiB out of a large document */
+void run_substr(const std::vector<std::string>& pieces) {
+    constexpr std::size_t slices = 2000;
+
+    rope text;
+    for (const std::string& piece : pieces) text += piece;
+    const std::string flat = text.str();
+
+    std::mt19937 generator(3);
+    std::vector<std::size_t> positions(slices), lengths(slices);
+    for (std::size_t i = 0; i < slices; i++) {
+        lengths[i] = 64 * 1024 + generator() % (960 * 1024);
+        positions[i] = generator() % (flat.size() - lengths[i]);
+    }
+
+    jfern::bench::stopwatch timer;
+    std::size_t sink = 0;
+    for (std::size_t i = 0; i < slices; i++)
+        sink += flat.substr(positions[i], lengths[i]).size();
+    jfern::bench::report("substr, std::string", slices, timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0; i < slices; i++)
+        sink += text.substr(positions[i], lengths[i]).size();
+    jfern::bench::report("substr, rope", slices, timer.seconds());
+
+    jfern::bench::do_not_optimize(sink);
+}
+
+#ifndef _WIN32
+/* Writing a payload out: flattened first, or chunk by chunk with writev */
+void run_output(const std::vector<std::string>& pieces) {
+    const int fd = ::open("/dev/null", O_WRONLY);
+    if (fd < 0) return;
+
+    rope text;
+    for (const std::string& piece : pieces) text += piece;
+
+    jfern::bench::stopwatch timer;
+    const std::string flat = text.str();
+    for (std::size_t done = 0; done < flat.size();) {
+        const ssize_t written =
+            ::write(fd, flat.data() + done, flat.size() - done);
+        if (written <= 0) break;
+        done += static_cast<std::size_t>(written);
+    }
+    jfern::bench::report_bytes("output, str() then write", text.size(),
+                               timer.seconds());
+
+    timer.reset();
+    text.writev(fd);
+    jfern::bench::report_bytes("output, writev", text.size(),
+                               timer.seconds());
+
+    ::close(fd);
+}
+#endif
+
+}  // namespace
+
+int main() {
+    const std::vector<std::string> pieces = make_pieces();
+
+    run_append_short(pieces);
+    run_append_long();
+    std::printf("\n");
+
+    run_edits();
+    std::printf("\n");
+
+    run_substr(pieces);
+#ifndef _WIN32
+    std::printf("\n");
+    run_output(pieces);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ *  \file   summary_bitset_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bitops/bitvector.h"
+#include "bitops/summary_bitset.h"
+
+namespace {
+
+using jfern::bitops::bitvector;
+using jfern::bitops::summary_bitset;
+
+void run(std::size_t size, std::size_t set_bits) {
+    std::printf("\n%zu bits, %zu set\n", size, set_bits);
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::size_t> distribution(0, size - 1);
+
+    bitvector flat(size);
+    summary_bitset tree(size);
+
+    jfern::bench::stopwatch timer;
+    for (std::size_t i = 0; i < set_bits; i++)
+        tree.insert(distribution(generator));
+    jfern::bench::report("summary_bitset::insert", set_bits,
+                         timer.seconds());
+
+    for (std::size_t i = tree.find_first(); i != jfern::bitops::npos;
+         i = tree.find_next(i)) {
+        flat.set(i);
+    }
+
+    constexpr std::size_t queries = 200000;
+    constexpr std::size_t flat_queries = 2000;
+
+    std::vector<std::size_t> positions(queries);
+    for (auto& p : positions) p = distribution(generator);
+
+    std::size_t sink = 0;
+
+    timer.reset();
+    for (std::size_t p : positions) sink += tree.find_next(p);
+    jfern::bench::report("summary_bitset::find_next", queries,
+                         timer.seconds());
+
+    timer.reset();
+    for (std::size_t p : positions) sink += tree.find_prev(p);
+    jfern::bench::report("summary_bitset::find_prev", queries,
+                         timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0; i < flat_queries; i++)
+        sink += flat.find_next(positions[i]);
+    jfern::bench::report("bitvector::find_next", flat_queries,
+                         timer.seconds());
+
+    timer.reset();
+    for (std::size_t p : positions) {
+        tree.insert(p);
+        tree.erase(p);
+    }
+    jfern::bench::report("summary_bitset::insert + erase", queries,
+                         timer.seconds());
+
+    jfern::bench::do_not_optimize(sink);
+}
+
+}  // namespace
+
+int main() {
+    run(std::size_t(1) << 24, 1000);
+    run(std::size_t(1) << 24, 100);
+    run(std::size_t(1) << 28, 100);
+    return 0;
+}
@@ -0,0 +1,354 @@
+/**
+ *  \file   superstring_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/join.h"
+#include "superstring/search.h"
+#include "superstring/superstring.h"
+#include "superstring/superstring_view.h"
+#include "superstring/tokenizer.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+namespace search = jfern::search;
+using jfern::superstring_view;
+
+/** Approximate size of the generated log, in bytes */
+constexpr std::size_t log_bytes = std::size_t(1) << 26;
+
+/** The whitespace set the trim functions strip */
+const char whitespace[] = "\t\n\v\f\r ";
+
+/*
+ * Log lines with indentation, several space separated fields and a key that
+ * the substring search looks for near the end
+ */
+std::string make_log() {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> indent(0, 24);
+    std::uniform_int_distribution<int> number(0, 99999);
+
+    const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+
+    std::string log;
+    log.reserve(log_bytes + 256);
+
+    while (log.size() < log_bytes) {
+        const int n = number(generator);
+        log.append(indent(generator), ' ');
+        log += "2026-10-16T12:34:56 ";
+        log += levels[n % 4];
+        log += " worker-" + std::to_string(n % 64);
+        log += " handled request id=" + std::to_string(n);
+        log += " path=/api/v1/items/" + std::to_string(n % 977);
+        log += " latency_ms=" + std::to_string(n % 250) + "  \n";
+    }
+
+    return log;
+}
+
+/* The original superstring::split, kept here as the baseline */
+std::vector<std::string> legacy_split(const std::string& str,
+                                      const std::string& delimiter) {
+    std::vector<std::string> tokens;
+
+    std::size_t ind, start = 0;
+    while ((ind = str.find(delimiter, start)) != std::string::npos) {
+        if (ind > start)
+            tokens.push_back(str.substr(start, ind - start));
+        start = ind + delimiter.size();
+    }
+
+    if (start < str.size()) tokens.push_back(str.substr(start));
+
+    return tokens;
+}
+
+/* The original superstring::trim, kept here as the baseline */
+std::string legacy_trim(const std::string& str) {
+    const std::size_t start = str.find_first_not_of(whitespace);
+    if (start == std::string::npos) return "";
+
+    const std::size_t stop = str.find_last_not_of(whitespace);
+    return str.substr(start, stop - start + 1);
+}
+
+/* The original superstring::to_lower, kept here as the baseline */
+std::string legacy_to_lower(const std::string& str) {
+    std::string internal = str;
+    std::transform(internal.begin(), internal.end(), internal.begin(),
+        [] (unsigned char c) { return std::tolower(c); });
+    return std::string(internal);
+}
+
+/* The original superstring::build, kept here as the baseline */
+template <class InputIterator>
+std::string legacy_build(const std::string& separator, InputIterator first,
+                         InputIterator last) {
+    std::string out = "";
+
+    for (auto iter = first; iter != last; ++iter) {
+        if (iter != first) out += separator;
+        out += (*iter);
+    }
+
+    return out;
+}
+
+/* Hides a vector iterator's category, so join() cannot make a sizing pass */
+class single_pass final {
+ public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = std::string;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const std::string*;
+    using reference         = const std::string&;
+
+    explicit single_pass(std::vector<std::string>::const_iterator iter)
+        : m_iter(iter) {}
+
+    reference    operator*() const { return *m_iter; }
+    single_pass& operator++() { ++m_iter; return *this; }
+
+    bool operator==(const single_pass& other) const {
+        return m_iter == other.m_iter;
+    }
+    bool operator!=(const single_pass& other) const {
+        return m_iter != other.m_iter;
+    }
+
+ private:
+    std::vector<std::string>::const_iterator m_iter;
+};
+
+const char* name(search::level isa) {
+    switch (isa) {
+      case search::level::avx2:
+        return "avx2";
+      case search::level::sse2:
+        return "sse2";
+      default:
+        return "scalar";
+    }
+}
+
+void run_baseline(const std::string& log,
+                  const std::vector<std::string>& lines) {
+    jfern::bench::stopwatch timer;
+    std::size_t sink = 0;
+
+    for (std::size_t i = 0; (i = log.find('\n', i)) != std::string::npos; i++)
+        sink++;
+    jfern::bench::report_bytes("baseline: find byte", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0;
+         (i = log.find("latency_ms=", i)) != std::string::npos; i++)
+        sink++;
+    jfern::bench::report_bytes("baseline: find substring", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0;
+         (i = log.find_first_of(" \n", i)) != std::string::npos; i++)
+        sink++;
+    jfern::bench::report_bytes("baseline: find_first_of", log.size(),
+                               timer.seconds());
+
+    /* A class that never matches, so the whole log is scanned */
+    timer.reset();
+    for (int rep = 0; rep < 4; rep++) sink += log.find_first_of("\"\\{}");
+    jfern::bench::report_bytes("baseline: scan for absent class",
+                               4 * log.size(), timer.seconds());
+
+    timer.reset();
+    sink += legacy_split(log, " ").size();
+    jfern::bench::report_bytes("baseline: split", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (const std::string& line : lines) sink += legacy_trim(line).size();
+    jfern::bench::report_bytes("baseline: trim lines", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (const std::string& line : lines)
+        sink += legacy_to_lower(line).size();
+    jfern::bench::report_bytes("baseline: to_lower lines", log.size(),
+                               timer.seconds());
+
+    jfern::bench::do_not_optimize(sink);
+    std::printf("\n");
+}
+
+void run_engine(search::level isa, const std::string& log,
+                const std::vector<std::string>& lines) {
+    search::set_active_level(isa);
+    const std::string prefix = std::string(name(isa)) + ": ";
+
+    const superstring_view text(log);
+
+    jfern::bench::stopwatch timer;
+    std::size_t sink = 0;
+
+    for (std::size_t i = 0; (i = text.find('\n', i)) != std::string::npos;
+         i++)
+        sink++;
+    jfern::bench::report_bytes(prefix + "find byte", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0;
+         (i = text.find("latency_ms=", i)) != std::string::npos; i++)
+        sink++;
+    jfern::bench::report_bytes(prefix + "find substring", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (std::size_t i = 0;
+         (i = text.find_first_of(" \n", i)) != std::string::npos; i++)
+        sink++;
+    jfern::bench::report_bytes(prefix + "find_first_of", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (int rep = 0; rep < 4; rep++) sink += text.find_first_of("\"\\{}");
+    jfern::bench::report_bytes(prefix + "scan for absent class",
+                               4 * log.size(), timer.seconds());
+
+    timer.reset();
+    sink += jfern::superstring(log).split(" ").size();
+    jfern::bench::report_bytes(prefix + "superstring::split", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    sink += text.split(" ").size();
+    jfern::bench::report_bytes(prefix + "superstring_view::split",
+                               log.size(), timer.seconds());
+
+    timer.reset();
+    for (superstring_view token : jfern::tokenize(
+             text, jfern::delimiter::any_of(whitespace)))
+        sink += token.size();
+    jfern::bench::report_bytes(prefix + "tokenize whitespace", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (const std::string& line : lines)
+        sink += superstring_view(line).trim().size();
+    jfern::bench::report_bytes(prefix + "trim lines", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    for (const std::string& line : lines)
+        sink += jfern::superstring(line).to_lower().get().size();
+    jfern::bench::report_bytes(prefix + "superstring::to_lower lines",
+                               log.size(), timer.seconds());
+
+    /* Case map the whole log in place, as one long run of ASCII */
+    std::string copy = log;
+    timer.reset();
+    jfern::superstring(std::move(copy)).lower_inplace().upper_inplace();
+    jfern::bench::report_bytes(prefix + "lower+upper in place",
+                               2 * log.size(), timer.seconds());
+
+    jfern::bench::do_not_optimize(sink);
+    std::printf("\n");
+}
+
+/* Join every line of the log back together, into each kind of sink */
+void run_join(const std::string& log, const std::vector<std::string>& lines) {
+    jfern::bench::stopwatch timer;
+    std::size_t sink = 0;
+
+    sink += legacy_build("\n", lines.begin(), lines.end()).size();
+    jfern::bench::report_bytes("baseline: build", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    sink += jfern::superstring::build("\n", lines.begin(),
+                                      lines.end()).size();
+    jfern::bench::report_bytes("superstring::build (sized)", log.size(),
+                               timer.seconds());
+
+    timer.reset();
+    sink += jfern::join("\n", single_pass(lines.begin()),
+                        single_pass(lines.end())).size();
+    jfern::bench::report_bytes("join, single pass (doubling)", log.size(),
+                               timer.seconds());
+
+    std::vector<char> buffer(log.size() + 1);
+    timer.reset();
+    jfern::buffer_sink to_buffer(buffer.data(), buffer.size());
+    sink += jfern::join(to_buffer, "\n", lines.begin(), lines.end());
+    jfern::bench::report_bytes("join into buffer_sink", log.size(),
+                               timer.seconds());
+
+    std::ofstream null_stream("/dev/null");
+    timer.reset();
+    jfern::ostream_sink to_stream(null_stream);
+    sink += jfern::join(to_stream, "\n", lines.begin(), lines.end());
+    null_stream.flush();
+    jfern::bench::report_bytes("join into ostream_sink", log.size(),
+                               timer.seconds());
+
+#ifndef _WIN32
+    const int fd = ::open("/dev/null", O_WRONLY);
+    timer.reset();
+    {
+        jfern::fd_sink to_fd(fd);
+        sink += jfern::join(to_fd, "\n", lines.begin(), lines.end());
+    }
+    jfern::bench::report_bytes("join into fd_sink", log.size(),
+                               timer.seconds());
+    ::close(fd);
+#endif
+
+    jfern::bench::do_not_optimize(sink);
+    std::printf("\n");
+}
+
+}  // namespace
+
+int main() {
+    const std::string log = make_log();
+
+    std::vector<std::string> lines;
+    for (superstring_view line : jfern::tokenize(log, '\n'))
+        lines.push_back(line.to_string());
+
+    std::printf("%zu bytes, %zu lines\n\n", log.size(), lines.size());
+
+    run_baseline(log, lines);
+    run_join(log, lines);
+
+    const search::level best = search::supported_level();
+    for (int isa = 0; isa <= static_cast<int>(best); isa++)
+        run_engine(static_cast<search::level>(isa), log, lines);
+
+    return 0;
+}
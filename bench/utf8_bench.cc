@@ -0,0 +1,131 @@
+/**
+ *  \file   utf8_bench.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "superstring/search.h"
+#include "superstring/superstring.h"
+#include "superstring/utf8.h"
+
+namespace {
+
+namespace search = jfern::search;
+namespace utf8 = jfern::utf8;
+
+/** The size of the input */
+constexpr std::size_t text_size = 64 * 1024 * 1024;
+
+/** The number of passes over the input for the faster functions */
+constexpr int passes = 8;
+
+/*
+ * Words of mostly ASCII text; about one word in eight is Latin with
+ * accents, Greek, Cyrillic or CJK, and a few contain emoji
+ */
+std::string make_text() {
+    const std::vector<std::string> words = {
+        "The", "quick", "brown", "fox", "jumps", "over", "the", "lazy",
+        "dog", "and", "RUNS", "away", "into", "a", "Forest", "again"};
+    const std::vector<std::string> others = {
+        "caf\xC3\xA9", "\xC3\x9C" "BER", "\xCE\xA3\xCE\xBF\xCF\x86\xCE\xAF"
+        "\xCE\xB1", "\xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0",
+        "\xE6\x9D\xB1\xE4\xBA\xAC", "\xF0\x9F\x98\x80"};
+
+    std::mt19937 generator(8);
+
+    std::string text;
+    text.reserve(text_size + 64);
+
+    while (text.size() < text_size) {
+        const unsigned int n = generator();
+        text += n % 8 == 0 ? others[(n >> 3) % others.size()]
+                           : words[(n >> 3) % words.size()];
+        text += ' ';
+    }
+
+    return text;
+}
+
+}  // namespace
+
+int main() {
+    const std::string text = make_text();
+    std::printf("%zu MB\n\n", text.size() >> 20);
+
+    const search::level saved = search::active_level();
+
+    for (search::level isa : {search::level::scalar, search::level::sse2,
+                              search::level::avx2}) {
+        if (isa > search::supported_level()) continue;
+        search::set_active_level(isa);
+
+        const char* const valid_names[] = {
+            "utf8::valid, scalar", "utf8::valid, sse2", "utf8::valid, avx2"};
+        const char* const length_names[] = {
+            "utf8::length, scalar", "utf8::length, sse2",
+            "utf8::length, avx2"};
+        const char* const lower_names[] = {
+            "utf8::to_lower, scalar", "utf8::to_lower, sse2",
+            "utf8::to_lower, avx2"};
+
+        {
+            jfern::bench::stopwatch timer;
+            for (int i = 0; i < passes; i++)
+                jfern::bench::do_not_optimize(utf8::valid(text));
+
+            jfern::bench::report_bytes(valid_names[static_cast<int>(isa)],
+                                       passes * text.size(), timer.seconds());
+        }
+
+        {
+            jfern::bench::stopwatch timer;
+            for (int i = 0; i < passes; i++)
+                jfern::bench::do_not_optimize(utf8::length(text));
+
+            jfern::bench::report_bytes(length_names[static_cast<int>(isa)],
+                                       passes * text.size(), timer.seconds());
+        }
+
+        {
+            jfern::bench::stopwatch timer;
+            jfern::bench::do_not_optimize(utf8::to_lower(text).size());
+
+            jfern::bench::report_bytes(lower_names[static_cast<int>(isa)],
+                                       text.size(), timer.seconds());
+        }
+    }
+
+    search::set_active_level(saved);
+
+    {
+        jfern::bench::stopwatch timer;
+        jfern::bench::do_not_optimize(utf8::fold_case(text).size());
+
+        jfern::bench::report_bytes("utf8::fold_case", text.size(),
+                                   timer.seconds());
+    }
+
+    {
+        /* Per-byte and locale dependent, so not an equivalent result */
+        jfern::bench::stopwatch timer;
+        jfern::bench::do_not_optimize(
+            jfern::superstring(text).to_lower().get().size());
+
+        jfern::bench::report_bytes("superstring::to_lower", text.size(),
+                                   timer.seconds());
+    }
+
+    return 0;
+}
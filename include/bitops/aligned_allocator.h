@@ -0,0 +1,108 @@
+/**
+ *  \file   aligned_allocator.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_ALIGNED_ALLOCATOR_H_
+#define UTILITY_INCLUDE_BITOPS_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace jfern {
+namespace bitops {
+
+/**
+ * A standard allocator whose storage always begins on an \a Alignment byte
+ * boundary. C++14 has no over-aligned operator new, so this goes directly to
+ * the platform's aligned malloc
+ *
+ * @tparam T         The type of object to allocate
+ * @tparam Alignment The alignment, in bytes. Must be a power of 2 and a
+ *                   multiple of sizeof(void*)
+ */
+template <typename T, std::size_t Alignment = 64>
+class aligned_allocator {
+    static_assert((Alignment & (Alignment - 1)) == 0,
+                  "Alignment must be a power of 2");
+    static_assert(Alignment % sizeof(void*) == 0,
+                  "Alignment must be a multiple of sizeof(void*)");
+
+ public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template <typename U>
+    aligned_allocator(  // NOLINT(runtime/explicit)
+        const aligned_allocator<U, Alignment>&) noexcept {}
+
+    /**
+     * Allocate storage for \a n objects of type T
+     *
+     * @param[in] n The number of objects
+     *
+     * @return A pointer aligned to \a Alignment bytes
+     *
+     * @throws std::bad_alloc if the allocation fails
+     */
+    T* allocate(std::size_t n) {
+        if (n == 0) return nullptr;
+
+        void* ptr = nullptr;
+#ifdef _WIN32
+        ptr = ::_aligned_malloc(n * sizeof(T), Alignment);
+#else
+        if (::posix_memalign(&ptr, Alignment, n * sizeof(T)) != 0)
+            ptr = nullptr;
+#endif
+        if (ptr == nullptr) throw std::bad_alloc();
+
+        return static_cast<T*>(ptr);
+    }
+
+    /**
+     * Release storage obtained from \ref allocate()
+     *
+     * @param[in] ptr The storage to release
+     */
+    void deallocate(T* ptr, std::size_t) noexcept {
+#ifdef _WIN32
+        ::_aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(const aligned_allocator<T, Alignment>&,
+                const aligned_allocator<U, Alignment>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(const aligned_allocator<T, Alignment>&,
+                const aligned_allocator<U, Alignment>&) noexcept {
+    return false;
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_ALIGNED_ALLOCATOR_H_
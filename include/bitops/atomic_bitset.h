@@ -0,0 +1,220 @@
+/**
+ *  \file   atomic_bitset.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_ATOMIC_BITSET_H_
+#define UTILITY_INCLUDE_BITOPS_ATOMIC_BITSET_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "bitops/bitops.h"
+#include "bitops/bitvector.h"
+
+namespace jfern {
+namespace bitops {
+
+/**
+ * A fixed-size set of bits that many threads may modify at once without
+ * locking. Every operation is a single atomic read-modify-write on one
+ * 64-bit word, except \ref try_acquire_first_free(), which may retry on
+ * contention and so is lock-free rather than wait-free
+ *
+ * A typical use is slot allocation in a pool, where a set bit marks a slot
+ * in use. Acquiring a bit has acquire semantics and releasing it has release
+ * semantics, so writes made by the previous owner of a slot are visible to
+ * the next one
+ */
+class atomic_bitset final {
+ public:
+    explicit atomic_bitset(std::size_t size);
+
+    atomic_bitset(const atomic_bitset& other)            = delete;
+    atomic_bitset(atomic_bitset&& other)                 noexcept = default;
+    atomic_bitset& operator=(const atomic_bitset& other) = delete;
+    atomic_bitset& operator=(atomic_bitset&& other)      noexcept = default;
+    ~atomic_bitset()                                     = default;
+
+    std::size_t try_acquire_first_free() noexcept;
+    std::size_t try_acquire_first_free(std::size_t hint) noexcept;
+
+    bool release(std::size_t index)      noexcept;
+    bool test_and_set(std::size_t index) noexcept;
+    bool test(std::size_t index)         const noexcept;
+
+    std::size_t count() const noexcept;
+    std::size_t size()  const noexcept;
+
+ private:
+    static std::size_t& thread_hint() noexcept;
+
+    std::uint64_t valid_bits(std::size_t word) const noexcept;
+
+    /** The words */
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_words;
+
+    /** The number of words */
+    std::size_t m_num_words;
+
+    /** The number of bits */
+    std::size_t m_size;
+};
+
+/**
+ * Constructor. All bits start clear
+ *
+ * @param [in] size The number of bits
+ */
+inline atomic_bitset::atomic_bitset(std::size_t size)
+    : m_words(new std::atomic<std::uint64_t>[(size + 63) / 64]),
+      m_num_words((size + 63) / 64),
+      m_size(size) {
+    for (std::size_t i = 0; i < m_num_words; i++)
+        m_words[i].store(0, std::memory_order_relaxed);
+}
+
+/**
+ * Find a clear bit and set it. The search starts at a per-thread hint, which
+ * follows each thread's most recent success, so that threads tend to work
+ * in different words rather than all contending for the first one
+ *
+ * @return The index of the bit acquired, or \ref npos if every bit is set
+ */
+inline std::size_t atomic_bitset::try_acquire_first_free() noexcept {
+    std::size_t& hint = thread_hint();
+
+    const std::size_t index = try_acquire_first_free(hint);
+    if (index != npos) hint = index;
+
+    return index;
+}
+
+/**
+ * Find a clear bit and set it, searching from a particular position and
+ * wrapping around at the end
+ *
+ * @param [in] hint Where to begin the search. Only the word it falls in
+ *                  matters, and out-of-range values wrap
+ *
+ * @return The index of the bit acquired, or \ref npos if every bit is set
+ */
+inline std::size_t atomic_bitset::try_acquire_first_free(
+    std::size_t hint) noexcept {
+    if (m_num_words == 0) return npos;
+
+    const std::size_t start = (hint / 64) % m_num_words;
+
+    for (std::size_t i = 0; i < m_num_words; i++) {
+        const std::size_t w = start + i < m_num_words ?
+                                start + i : start + i - m_num_words;
+        std::atomic<std::uint64_t>& word = m_words[w];
+
+        const std::uint64_t valid = valid_bits(w);
+        std::uint64_t current = word.load(std::memory_order_relaxed);
+
+        /*
+         * fetch_or sets only the bit we picked; if another thread got there
+         * first we simply pick again from the value it returned
+         */
+        while (const std::uint64_t free = ~current & valid) {
+            const std::uint64_t bit = free & (~free + 1);
+            current = word.fetch_or(bit, std::memory_order_acquire);
+
+            if (!(current & bit)) return 64 * w + lsb(bit);
+
+            current |= bit;
+        }
+    }
+
+    return npos;
+}
+
+/**
+ * Clear a bit
+ *
+ * @param [in] index The bit to clear. Must be less than size()
+ *
+ * @return True if the bit was set
+ */
+inline bool atomic_bitset::release(std::size_t index) noexcept {
+    const std::uint64_t bit = std::uint64_t(1) << (index % 64);
+    return m_words[index / 64].fetch_and(~bit, std::memory_order_release) &
+           bit;
+}
+
+/**
+ * Set a bit
+ *
+ * @param [in] index The bit to set. Must be less than size()
+ *
+ * @return True if the bit was already set
+ */
+inline bool atomic_bitset::test_and_set(std::size_t index) noexcept {
+    const std::uint64_t bit = std::uint64_t(1) << (index % 64);
+    return m_words[index / 64].fetch_or(bit, std::memory_order_acq_rel) & bit;
+}
+
+/**
+ * Check whether a bit is set
+ *
+ * @param [in] index The bit to check. Must be less than size()
+ *
+ * @return True if set
+ */
+inline bool atomic_bitset::test(std::size_t index) const noexcept {
+    return (m_words[index / 64].load(std::memory_order_acquire) >>
+            (index % 64)) & 1;
+}
+
+/**
+ * Count the bits set. Under concurrent modification this is a sum over
+ * words read at slightly different times, not an atomic snapshot
+ *
+ * @return The number of bits set
+ */
+inline std::size_t atomic_bitset::count() const noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < m_num_words; i++)
+        total += bitops::count(m_words[i].load(std::memory_order_relaxed));
+    return total;
+}
+
+/**
+ * @return The number of bits
+ */
+inline std::size_t atomic_bitset::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The calling thread's search hint, seeded from its thread ID
+ */
+inline std::size_t& atomic_bitset::thread_hint() noexcept {
+    thread_local std::size_t hint =
+        64 * std::hash<std::thread::id>()(std::this_thread::get_id());
+    return hint;
+}
+
+/**
+ * @return A mask of the bits of a word which lie within size()
+ */
+inline std::uint64_t atomic_bitset::valid_bits(std::size_t word) const
+    noexcept {
+    const std::size_t used = m_size - 64 * word;
+    return used >= 64 ? ~std::uint64_t(0) : ~(~std::uint64_t(0) << used);
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_ATOMIC_BITSET_H_
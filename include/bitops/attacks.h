@@ -0,0 +1,433 @@
+/**
+ *  \file   attacks.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  \brief Sliding-piece attack lookups for 64-bit bitboards, where bit
+ *         (8 * rank + file) represents a square of an 8x8 board
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_ATTACKS_H_
+#define UTILITY_INCLUDE_BITOPS_ATTACKS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bitops/bitops.h"
+
+namespace jfern {
+namespace bitops {
+
+/**
+ * The eight ray directions on the board. The first four move toward higher
+ * square indexes, the last four toward lower ones
+ */
+enum class direction : int {
+    north      = 0,
+    east       = 1,
+    north_east = 2,
+    north_west = 3,
+    south      = 4,
+    west       = 5,
+    south_east = 6,
+    south_west = 7
+};
+
+namespace detail {
+
+/**
+ * For every direction and square, the squares strictly along that ray up to
+ * the edge of the board. Generated at compile time
+ */
+struct ray_table {
+    constexpr ray_table() : rays() {
+        constexpr int file_step[8] = { 0, 1,  1, -1,  0, -1,  1, -1 };
+        constexpr int rank_step[8] = { 1, 0,  1,  1, -1,  0, -1, -1 };
+
+        for (int dir = 0; dir < 8; dir++) {
+            for (int square = 0; square < 64; square++) {
+                std::uint64_t ray = 0;
+
+                int file = square % 8 + file_step[dir];
+                int rank = square / 8 + rank_step[dir];
+
+                while (file >= 0 && file < 8 && rank >= 0 && rank < 8) {
+                    ray |= std::uint64_t(1) << (8 * rank + file);
+                    file += file_step[dir];
+                    rank += rank_step[dir];
+                }
+
+                rays[dir][square] = ray;
+            }
+        }
+    }
+
+    /** Indexed by [direction][square] */
+    std::uint64_t rays[8][64];
+};
+
+/**
+ * @return The compile-time ray table
+ */
+inline const ray_table& get_rays() noexcept {
+    static constexpr ray_table table;
+    return table;
+}
+
+/**
+ * Magic multipliers for rooks, by square. These were found by searching
+ * sparse xorshift64* candidates for multipliers that map every relevant
+ * occupancy to a slot holding its attack set, and are verified by the unit
+ * tests
+ */
+constexpr std::uint64_t rook_magics[64] = {
+    0x0a80004000801220ull, 0x8040004010002008ull, 0x2080200010008008ull,
+    0x1100100008210004ull, 0xc200209084020008ull, 0x2100010004000208ull,
+    0x0400081000822421ull, 0x0200010422048844ull, 0x0800800080400024ull,
+    0x0001402000401000ull, 0x3000801000802001ull, 0x4400800800100083ull,
+    0x0904802402480080ull, 0x4040800400020080ull, 0x0018808042000100ull,
+    0x4040800080004100ull, 0x0040048001458024ull, 0x00a0004000205000ull,
+    0x3100808010002000ull, 0x4825010010000820ull, 0x5004808008000401ull,
+    0x2024818004000a00ull, 0x0005808002000100ull, 0x2100060004806104ull,
+    0x0080400880008421ull, 0x4062220600410280ull, 0x010a004a00108022ull,
+    0x0000100080080080ull, 0x0021000500080010ull, 0x0044000202001008ull,
+    0x0000100400080102ull, 0xc020128200040545ull, 0x0080002000400040ull,
+    0x0000804000802004ull, 0x0000120022004080ull, 0x010a386103001001ull,
+    0x9010080080800400ull, 0x8440020080800400ull, 0x0004228824001001ull,
+    0x000000490a000084ull, 0x0080002000504000ull, 0x200020005000c000ull,
+    0x0012088020420010ull, 0x0010010080080800ull, 0x0085001008010004ull,
+    0x0002000204008080ull, 0x0040413002040008ull, 0x0000304081020004ull,
+    0x0080204000800080ull, 0x3008804000290100ull, 0x1010100080200080ull,
+    0x2008100208028080ull, 0x5000850800910100ull, 0x8402019004680200ull,
+    0x0120911028020400ull, 0x0000008044010200ull, 0x0020850200244012ull,
+    0x0020850200244012ull, 0x0000102001040841ull, 0x140900040a100021ull,
+    0x000200282410a102ull, 0x000200282410a102ull, 0x000200282410a102ull,
+    0x4048240043802106ull
+};
+
+/**
+ * Magic multipliers for bishops, by square
+ */
+constexpr std::uint64_t bishop_magics[64] = {
+    0x40106000a1160020ull, 0x0020010250810120ull, 0x2010010220280081ull,
+    0x002806004050c040ull, 0x0002021018000000ull, 0x2001112010000400ull,
+    0x0881010120218080ull, 0x1030820110010500ull, 0x0000120222042400ull,
+    0x2000020404040044ull, 0x8000480094208000ull, 0x0003422a02000001ull,
+    0x000a220210100040ull, 0x8004820202226000ull, 0x0018234854100800ull,
+    0x0100004042101040ull, 0x0004001004082820ull, 0x0010000810010048ull,
+    0x1014004208081300ull, 0x2080818802044202ull, 0x0040880c00a00100ull,
+    0x0080400200522010ull, 0x0001000188180b04ull, 0x0080249202020204ull,
+    0x1004400004100410ull, 0x00013100a0022206ull, 0x2148500001040080ull,
+    0x4241080011004300ull, 0x4020848004002000ull, 0x10101380d1004100ull,
+    0x0008004422020284ull, 0x01010a1041008080ull, 0x0808080400082121ull,
+    0x0808080400082121ull, 0x0091128200100c00ull, 0x0202200802010104ull,
+    0x8c0a020200440085ull, 0x01a0008080b10040ull, 0x0889520080122800ull,
+    0x100902022202010aull, 0x04081a0816002000ull, 0x0000681208005000ull,
+    0x8170840041008802ull, 0x0a00004200810805ull, 0x0830404408210100ull,
+    0x2602208106006102ull, 0x1048300680802628ull, 0x2602208106006102ull,
+    0x0602010120110040ull, 0x0941010801043000ull, 0x000040440a210428ull,
+    0x0008240020880021ull, 0x0400002012048200ull, 0x00ac102001210220ull,
+    0x0220021002009900ull, 0x84440c080a013080ull, 0x0001008044200440ull,
+    0x0004c04410841000ull, 0x2000500104011130ull, 0x1a0c010011c20229ull,
+    0x0044800112202200ull, 0x0434804908100424ull, 0x0300404822c08200ull,
+    0x48081010008a2a80ull
+};
+
+/**
+ * A single lookup table entry for one square
+ */
+struct slider_entry {
+    /** Squares whose occupancy affects the attacks from this square */
+    std::uint64_t mask;
+
+    /** Magic multiplier (used only by \ref magic_indexing) */
+    std::uint64_t magic;
+
+    /** Where this square's attack sets begin within the shared table */
+    std::size_t offset;
+
+    /** Right shift applied after the magic multiplication */
+    unsigned int shift;
+};
+
+}  // namespace detail
+
+/**
+ * Compute the attacks along a single ray by walking to the first blocker.
+ * The blocker is found with \ref lsb() for rays that move toward higher
+ * square indexes and with \ref msb() for the others
+ *
+ * @param [in] dir      The ray direction
+ * @param [in] square   The origin square, 0-63
+ * @param [in] occupied The occupied squares
+ *
+ * @return The attacked squares along the ray, including the blocker
+ */
+inline std::uint64_t ray_attacks(direction dir, int square,
+                                 std::uint64_t occupied) noexcept {
+    const auto& table = detail::get_rays().rays;
+    const int d = static_cast<int>(dir);
+
+    std::uint64_t ray = table[d][square];
+    const std::uint64_t blockers = ray & occupied;
+
+    if (blockers) {
+        const int blocker = d < 4 ? lsb(blockers) : msb(blockers);
+        ray ^= table[d][blocker];
+    }
+
+    return ray;
+}
+
+/**
+ * Compute rook attacks by walking rays. This is the reference implementation
+ * used to build the lookup tables
+ *
+ * @param [in] square   The origin square, 0-63
+ * @param [in] occupied The occupied squares
+ *
+ * @return The attacked squares
+ */
+inline std::uint64_t rook_rays(int square, std::uint64_t occupied) noexcept {
+    return ray_attacks(direction::north, square, occupied) |
+           ray_attacks(direction::east,  square, occupied) |
+           ray_attacks(direction::south, square, occupied) |
+           ray_attacks(direction::west,  square, occupied);
+}
+
+/**
+ * Compute bishop attacks by walking rays. This is the reference
+ * implementation used to build the lookup tables
+ *
+ * @param [in] square   The origin square, 0-63
+ * @param [in] occupied The occupied squares
+ *
+ * @return The attacked squares
+ */
+inline std::uint64_t bishop_rays(int square, std::uint64_t occupied) noexcept {
+    return ray_attacks(direction::north_east, square, occupied) |
+           ray_attacks(direction::north_west, square, occupied) |
+           ray_attacks(direction::south_east, square, occupied) |
+           ray_attacks(direction::south_west, square, occupied);
+}
+
+/**
+ * Table indexing via PEXT: the relevant occupancy bits are packed directly
+ * into an index. Uses the BMI2 instruction when the target has it
+ */
+struct pext_indexing {
+    static std::size_t index(const detail::slider_entry& entry,
+                             std::uint64_t occupied) noexcept {
+        return static_cast<std::size_t>(pext(occupied, entry.mask));
+    }
+};
+
+/**
+ * Table indexing via magic multiplication, hashing the relevant occupancy
+ * bits into an index without collisions between differing attack sets
+ */
+struct magic_indexing {
+    static std::size_t index(const detail::slider_entry& entry,
+                             std::uint64_t occupied) noexcept {
+        return static_cast<std::size_t>(
+            ((occupied & entry.mask) * entry.magic) >> entry.shift);
+    }
+};
+
+/** PEXT indexing where the hardware has it, magic multiplication otherwise */
+#ifdef __BMI2__
+using default_indexing = pext_indexing;
+#else
+using default_indexing = magic_indexing;
+#endif
+
+/**
+ * Precomputed rook and bishop attack tables. Each square's attack sets live
+ * in a shared table and are looked up by an \a Indexing policy, either
+ * \ref pext_indexing or \ref magic_indexing
+ *
+ * @tparam Indexing How to map an occupancy to a table index
+ */
+template <typename Indexing>
+class basic_slider_attacks final {
+ public:
+    basic_slider_attacks();
+
+    basic_slider_attacks(const basic_slider_attacks& other) = default;
+    basic_slider_attacks(basic_slider_attacks&& other)      = default;
+    ~basic_slider_attacks()                                 = default;
+
+    basic_slider_attacks& operator=(const basic_slider_attacks& other)
+        = default;
+    basic_slider_attacks& operator=(basic_slider_attacks&& other)
+        = default;
+
+    std::uint64_t rook(int square, std::uint64_t occupied)   const noexcept;
+    std::uint64_t bishop(int square, std::uint64_t occupied) const noexcept;
+    std::uint64_t queen(int square, std::uint64_t occupied)  const noexcept;
+
+    std::size_t table_bytes() const noexcept;
+
+ private:
+    using attack_fn = std::uint64_t (*)(int, std::uint64_t);
+
+    static std::uint64_t relevant_mask(int square, bool rook) noexcept;
+
+    void build(detail::slider_entry* entries, bool rook);
+
+    /** Per-square rook entries */
+    detail::slider_entry m_rook[64];
+
+    /** Per-square bishop entries */
+    detail::slider_entry m_bishop[64];
+
+    /** Attack sets for all squares of both pieces */
+    std::vector<std::uint64_t> m_table;
+};
+
+/**
+ * Constructor. Builds both tables in a single pass over every relevant
+ * occupancy of every square
+ */
+template <typename Indexing>
+basic_slider_attacks<Indexing>::basic_slider_attacks() {
+    m_table.reserve(102400 + 5248);  // known sizes for rooks + bishops
+
+    build(m_rook,   true);
+    build(m_bishop, false);
+}
+
+/**
+ * Look up the squares attacked by a rook
+ *
+ * @param [in] square   The rook's square, 0-63
+ * @param [in] occupied The occupied squares
+ *
+ * @return The attacked squares, including any blockers
+ */
+template <typename Indexing>
+inline std::uint64_t basic_slider_attacks<Indexing>::rook(
+    int square, std::uint64_t occupied) const noexcept {
+    const detail::slider_entry& entry = m_rook[square];
+    return m_table[entry.offset + Indexing::index(entry, occupied)];
+}
+
+/**
+ * Look up the squares attacked by a bishop
+ *
+ * @param [in] square   The bishop's square, 0-63
+ * @param [in] occupied The occupied squares
+ *
+ * @return The attacked squares, including any blockers
+ */
+template <typename Indexing>
+inline std::uint64_t basic_slider_attacks<Indexing>::bishop(
+    int square, std::uint64_t occupied) const noexcept {
+    const detail::slider_entry& entry = m_bishop[square];
+    return m_table[entry.offset + Indexing::index(entry, occupied)];
+}
+
+/**
+ * Look up the squares attacked by a queen
+ *
+ * @param [in] square   The queen's square, 0-63
+ * @param [in] occupied The occupied squares
+ *
+ * @return The attacked squares, including any blockers
+ */
+template <typename Indexing>
+inline std::uint64_t basic_slider_attacks<Indexing>::queen(
+    int square, std::uint64_t occupied) const noexcept {
+    return rook(square, occupied) | bishop(square, occupied);
+}
+
+/**
+ * @return The memory footprint of the lookup tables, in bytes
+ */
+template <typename Indexing>
+std::size_t basic_slider_attacks<Indexing>::table_bytes() const noexcept {
+    return sizeof(*this) + m_table.capacity() * sizeof(std::uint64_t);
+}
+
+/**
+ * Compute the squares whose occupancy matters to a slider. The final square
+ * of each ray never does, since it is attacked either way
+ *
+ * @param [in] square The origin square
+ * @param [in] rook   True for rooks, false for bishops
+ *
+ * @return The relevant occupancy mask
+ */
+template <typename Indexing>
+std::uint64_t basic_slider_attacks<Indexing>::relevant_mask(
+    int square, bool rook) noexcept {
+    const auto& table = detail::get_rays().rays;
+
+    std::uint64_t mask = 0;
+    for (int d = 0; d < 8; d++) {
+        const bool straight = d % 4 < 2;
+        if (straight != rook) continue;
+
+        std::uint64_t ray = table[d][square];
+        if (ray) ray ^= get_bit<std::uint64_t>(d < 4 ? msb(ray) : lsb(ray));
+
+        mask |= ray;
+    }
+
+    return mask;
+}
+
+/**
+ * Fill in the entries and attack sets for one kind of slider
+ *
+ * @param [out] entries The 64 per-square entries
+ * @param [in]  rook    True for rooks, false for bishops
+ */
+template <typename Indexing>
+void basic_slider_attacks<Indexing>::build(detail::slider_entry* entries,
+                                           bool rook) {
+    const attack_fn reference = rook ? &rook_rays : &bishop_rays;
+
+    for (int square = 0; square < 64; square++) {
+        detail::slider_entry& entry = entries[square];
+
+        entry.mask   = relevant_mask(square, rook);
+        entry.magic  = rook ? detail::rook_magics[square] :
+                              detail::bishop_magics[square];
+        entry.offset = m_table.size();
+        entry.shift  = 64 - count(entry.mask);
+
+        m_table.resize(m_table.size() + (std::size_t(1) << count(entry.mask)));
+
+        /* Enumerate every subset of the mask (Carry-Rippler) */
+        std::uint64_t subset = 0;
+        do {
+            m_table[entry.offset + Indexing::index(entry, subset)] =
+                reference(square, subset);
+            subset = (subset - entry.mask) & entry.mask;
+        } while (subset);
+    }
+}
+
+/** Slider attack tables using the best indexing for this target */
+using slider_attacks = basic_slider_attacks<default_indexing>;
+
+/**
+ * Get the process-wide slider attack tables, building them on first use
+ *
+ * @return The tables
+ */
+inline const slider_attacks& slider_attack_tables() {
+    static const slider_attacks tables;
+    return tables;
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_ATTACKS_H_
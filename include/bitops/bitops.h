@@ -13,25 +13,134 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
 #include <vector>
 
+/*
+ * GCC and Clang expose popcount/ctz/clz builtins which lower to POPCNT/TZCNT/
+ * LZCNT (or BSF/BSR) when the target supports them, and which also fold in
+ * constant expressions. Elsewhere we fall back to the portable loops below
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define UTILITY_BITOPS_HAS_BUILTINS 1
+#endif
+
+/*
+ * PEXT/PDEP have no constexpr form, so the BMI2 versions are only used when
+ * we can tell that we are not being evaluated at compile time
+ */
+#if defined(__BMI2__) && defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define UTILITY_BITOPS_HAS_BMI2 1
+#include <immintrin.h>
+#endif
+#endif
+
 namespace jfern {
 namespace bitops {
+namespace detail {
+
+/** The unsigned counterpart of T, used so that shifts never hit a sign bit */
+template <typename T>
+using unsigned_t = typename std::make_unsigned<T>::type;
+
+/**
+ * True if the compiler builtins can handle a word of type T
+ */
+template <typename T>
+constexpr bool use_builtins() noexcept {
+#ifdef UTILITY_BITOPS_HAS_BUILTINS
+    return sizeof(T) <= sizeof(unsigned long long);  // NOLINT(runtime/int)
+#else
+    return false;
+#endif
+}
+
 /**
- * Count the number of bits set in a word in O(n) time
+ * Count the number of bits set in a word in O(n) time. This is the portable
+ * implementation of \ref bitops::count()
  *
  * @param [in] word An n-bit word
  *
  * @return The number of bits set in the word
  */
-template< typename T > constexpr std::uint8_t count(T word) noexcept {
+template <typename T>
+constexpr std::uint8_t count_portable(T word) noexcept {
     std::uint8_t count = 0;
 
-    for (; word; count++) word &= word - 1;
+    for (auto bits = unsigned_t<T>(word); bits; count++) bits &= bits - 1;
 
     return count;
 }
 
+/**
+ * Get the index of the least significant bit set in O(n) time. This is the
+ * portable implementation of \ref bitops::lsb()
+ *
+ * @param [in] word The word to scan
+ *
+ * @return The LSB, or -1 if no bits are set
+ */
+template <typename T>
+constexpr std::int8_t lsb_portable(T word) noexcept {
+    const auto bits = unsigned_t<T>(word);
+    std::int8_t bit = 0; unsigned_t<T> mask = 1;
+
+    if (bits != 0) {
+        while (!(mask & bits)) {
+            mask <<= 1; bit += 1;
+        }
+        return bit;
+    }
+
+    return -1;
+}
+
+/**
+ * Get the index of the most significant bit set in O(n) time. This is the
+ * portable implementation of \ref bitops::msb()
+ *
+ * @param [in] word The word to scan
+ *
+ * @return The MSB, or -1 if no bits are set
+ */
+template <typename T>
+constexpr std::int8_t msb_portable(T word) noexcept {
+    const auto bits = unsigned_t<T>(word);
+    std::int8_t bit = (8 * sizeof(T) - 1);
+    unsigned_t<T> mask = unsigned_t<T>(1) << bit;
+
+    if (bits != 0) {
+        while (!(mask & bits)) {
+            mask >>= 1; bit -= 1;
+        }
+        return bit;
+    }
+
+    return -1;
+}
+
+}  // namespace detail
+
+/**
+ * Count the number of bits set in a word. This compiles to a single POPCNT
+ * where the target supports it, and to an O(n) loop otherwise
+ *
+ * @param [in] word An n-bit word
+ *
+ * @return The number of bits set in the word
+ */
+template< typename T > constexpr std::uint8_t count(T word) noexcept {
+#ifdef UTILITY_BITOPS_HAS_BUILTINS
+    if (detail::use_builtins<T>()) {
+        return static_cast<std::uint8_t>(__builtin_popcountll(
+            static_cast<detail::unsigned_t<T>>(word)));
+    }
+#endif
+    return detail::count_portable(word);
+}
+
 /**
  * Clear the specified bit within a word
  *
@@ -96,44 +205,42 @@ template<typename T> constexpr T get_bit(int bit) noexcept {
 
 
 /**
- * Get the index of the least significant bit set in O(n) time
+ * Get the index of the least significant bit set. This compiles to a single
+ * TZCNT/BSF where the target supports it, and to an O(n) loop otherwise
  *
  * @param [in] word The word to scan
  *
  * @return The LSB, or -1 if no bits are set
  */
 template<typename T> constexpr std::int8_t lsb(T word) noexcept {
-    std::int8_t bit = 0; T mask = 1;
-
-    if (word != 0) {
-        while (!(mask & word)) {
-            mask <<= 1; bit += 1;
-        }
-        return bit;
+#ifdef UTILITY_BITOPS_HAS_BUILTINS
+    if (detail::use_builtins<T>()) {
+        if (word == 0) return -1;
+        return static_cast<std::int8_t>(__builtin_ctzll(
+            static_cast<detail::unsigned_t<T>>(word)));
     }
-
-    return -1;
+#endif
+    return detail::lsb_portable(word);
 }
 
 /**
- * Get the index of the most significant bit set in O(n) time
+ * Get the index of the most significant bit set. This compiles to a single
+ * LZCNT/BSR where the target supports it, and to an O(n) loop otherwise
  *
  * @param [in] word The word to scan
  *
  * @return The MSB, or -1 if no bits are set
  */
 template<typename T> constexpr std::int8_t msb(T word) noexcept {
-    std::int8_t bit = (8 * sizeof(T) - 1 );
-    T mask = (T(1)) << bit;
-
-    if (word != 0) {
-        while (!(mask & word)) {
-            mask >>= 1; bit -= 1;
-        }
-        return bit;
+#ifdef UTILITY_BITOPS_HAS_BUILTINS
+    if (detail::use_builtins<T>()) {
+        if (word == 0) return -1;
+        constexpr int top = 8 * sizeof(unsigned long long) - 1;  // NOLINT
+        return static_cast<std::int8_t>(top - __builtin_clzll(
+            static_cast<detail::unsigned_t<T>>(word)));
     }
-
-    return -1;
+#endif
+    return detail::msb_portable(word);
 }
 
 /**
@@ -146,6 +253,418 @@ template<typename T> constexpr void multi_clear(T mask, T* word) noexcept {
     *word ^= (*word & mask);
 }
 
+namespace detail {
+
+/**
+ * Deposit the low bits of a word into the positions selected by a mask, from
+ * least to most significant. This is the portable implementation of
+ * \ref pdep()
+ *
+ * @param [in] word The bits to deposit
+ * @param [in] mask Selects where the bits go
+ *
+ * @return The deposited bits
+ */
+template <typename T>
+constexpr T pdep_portable(T word, T mask) noexcept {
+    using U = unsigned_t<T>;
+
+    U result = 0;
+    for (U bits = U(mask), bit = 1; bits; bit = U(bit << 1)) {
+        if (U(word) & bit) result |= U(bits & (~bits + 1));
+        bits = U(bits & (bits - 1));
+    }
+
+    return T(result);
+}
+
+/**
+ * Extract the bits of a word selected by a mask and pack them into the low
+ * bits of the result. This is the portable implementation of \ref pext()
+ *
+ * @param [in] word The bits to extract from
+ * @param [in] mask Selects which bits to extract
+ *
+ * @return The extracted bits
+ */
+template <typename T>
+constexpr T pext_portable(T word, T mask) noexcept {
+    using U = unsigned_t<T>;
+
+    U result = 0;
+    for (U bits = U(mask), bit = 1; bits; bit = U(bit << 1)) {
+        if (U(word) & bits & (~bits + 1)) result |= bit;
+        bits = U(bits & (bits - 1));
+    }
+
+    return T(result);
+}
+
+/**
+ * Reverse the order of the bytes in a word. This is the portable
+ * implementation of \ref byte_swap()
+ *
+ * @param [in] word The word to swap
+ *
+ * @return The swapped word
+ */
+template <typename T>
+constexpr T byte_swap_portable(T word) noexcept {
+    using U = unsigned_t<T>;
+
+    U result = 0;
+    for (U bytes = U(word), i = 0; i < sizeof(T); i++) {
+        result = U((result << 8) | (bytes & 0xff));
+        bytes  = U(bytes >> 8);
+    }
+
+    return T(result);
+}
+
+}  // namespace detail
+
+/**
+ * Deposit the low bits of a word into the positions selected by a mask, from
+ * least to most significant. Compiles to PDEP on BMI2 targets
+ *
+ * @param [in] word The bits to deposit
+ * @param [in] mask Selects where the bits go
+ *
+ * @return The deposited bits
+ */
+template <typename T>
+constexpr T pdep(T word, T mask) noexcept {
+#ifdef UTILITY_BITOPS_HAS_BMI2
+    if (!__builtin_is_constant_evaluated()) {
+        return T(_pdep_u64(detail::unsigned_t<T>(word),
+                           detail::unsigned_t<T>(mask)));
+    }
+#endif
+    return detail::pdep_portable(word, mask);
+}
+
+/**
+ * Extract the bits of a word selected by a mask and pack them into the low
+ * bits of the result. Compiles to PEXT on BMI2 targets
+ *
+ * @param [in] word The bits to extract from
+ * @param [in] mask Selects which bits to extract
+ *
+ * @return The extracted bits
+ */
+template <typename T>
+constexpr T pext(T word, T mask) noexcept {
+#ifdef UTILITY_BITOPS_HAS_BMI2
+    if (!__builtin_is_constant_evaluated()) {
+        return T(_pext_u64(detail::unsigned_t<T>(word),
+                           detail::unsigned_t<T>(mask)));
+    }
+#endif
+    return detail::pext_portable(word, mask);
+}
+
+/**
+ * Reverse the order of the bytes in a word. Compiles to BSWAP/MOVBE (or
+ * ROL for 16 bits) where the target supports it
+ *
+ * @param [in] word The word to swap
+ *
+ * @return The swapped word
+ */
+template <typename T>
+constexpr T byte_swap(T word) noexcept {
+#ifdef UTILITY_BITOPS_HAS_BUILTINS
+    using U = detail::unsigned_t<T>;
+    switch (sizeof(T)) {
+      case 1: return word;
+      case 2: return T(__builtin_bswap16(std::uint16_t(U(word))));
+      case 4: return T(__builtin_bswap32(std::uint32_t(U(word))));
+      case 8: return T(__builtin_bswap64(std::uint64_t(U(word))));
+    }
+#endif
+    return detail::byte_swap_portable(word);
+}
+
+/**
+ * Reverse the order of the bits in a word, so that bit 0 swaps with bit n-1.
+ * Swaps adjacent bits, pairs and nibbles with masks, then the bytes with
+ * \ref byte_swap()
+ *
+ * @param [in] word An n-bit word, n <= 64
+ *
+ * @return The reversed word
+ */
+template <typename T>
+constexpr T reverse_bits(T word) noexcept {
+    constexpr std::uint64_t m1 = 0x5555555555555555ull;
+    constexpr std::uint64_t m2 = 0x3333333333333333ull;
+    constexpr std::uint64_t m4 = 0x0f0f0f0f0f0f0f0full;
+
+    std::uint64_t x = detail::unsigned_t<T>(word);
+
+    x = ((x >> 1) & m1) | ((x & m1) << 1);
+    x = ((x >> 2) & m2) | ((x & m2) << 2);
+    x = ((x >> 4) & m4) | ((x & m4) << 4);
+
+    return T(byte_swap(x) >> (64 - 8 * sizeof(T)));
+}
+
+/**
+ * Compute the running XOR of a word's bits: bit i of the result is the XOR
+ * of bits 0 through i. With quote characters as set bits, this marks what
+ * lies between each opening quote and its closing one. Equivalent to a
+ * carry-less multiplication by all ones, done here in log2(n) shifts
+ *
+ * @param [in] word An n-bit word, n <= 64
+ *
+ * @return The prefix XOR of the word
+ */
+template <typename T>
+constexpr T prefix_xor(T word) noexcept {
+    detail::unsigned_t<T> x = word;
+
+    for (std::size_t shift = 1; shift < 8 * sizeof(T); shift *= 2)
+        x ^= static_cast<detail::unsigned_t<T>>(x << shift);
+
+    return T(x);
+}
+
+/**
+ * Forward iterator over the indexes of the bits set in a word, from least to
+ * most significant. Each step clears the lowest set bit with x & (x-1), so
+ * iterating costs one \ref lsb() per set bit and never allocates
+ *
+ * @tparam T The integral type of the word
+ */
+template <typename T>
+class set_bit_iterator final {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const int*;
+    using reference         = int;
+
+    /** Construct the end iterator */
+    constexpr set_bit_iterator() noexcept : m_word(0) {}
+
+    /**
+     * Constructor
+     *
+     * @param [in] word The word whose set bits to visit
+     */
+    constexpr explicit set_bit_iterator(T word) noexcept
+        : m_word(static_cast<detail::unsigned_t<T>>(word)) {}
+
+    /** @return The index of the current bit */
+    constexpr int operator*() const noexcept {
+        return lsb(m_word);
+    }
+
+    /** Advance to the next set bit */
+    constexpr set_bit_iterator& operator++() noexcept {
+        m_word = static_cast<detail::unsigned_t<T>>(m_word & (m_word - 1));
+        return *this;
+    }
+
+    /** Advance to the next set bit */
+    constexpr set_bit_iterator operator++(int) noexcept {
+        set_bit_iterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    constexpr bool operator==(const set_bit_iterator& other) const noexcept {
+        return m_word == other.m_word;
+    }
+
+    constexpr bool operator!=(const set_bit_iterator& other) const noexcept {
+        return m_word != other.m_word;
+    }
+
+ private:
+    /** The bits not yet visited */
+    detail::unsigned_t<T> m_word;
+};
+
+/**
+ * A lazy range over the indexes of the bits set in a word, for use with
+ * range-based for loops. See \ref set_bits()
+ *
+ * @tparam T The integral type of the word
+ */
+template <typename T>
+class set_bit_range final {
+ public:
+    using iterator = set_bit_iterator<T>;
+
+    /**
+     * Constructor
+     *
+     * @param [in] word The word whose set bits to visit
+     */
+    constexpr explicit set_bit_range(T word) noexcept : m_word(word) {}
+
+    constexpr iterator begin() const noexcept { return iterator(m_word); }
+    constexpr iterator end()   const noexcept { return iterator(); }
+
+    /** @return True if no bits are set */
+    constexpr bool empty() const noexcept { return m_word == 0; }
+
+    /** @return The number of bits set */
+    constexpr std::size_t size() const noexcept { return count(m_word); }
+
+ private:
+    /** The word whose set bits to visit */
+    T m_word;
+};
+
+/**
+ * Forward iterator over the indexes of the bits set in an array of words.
+ * Bit b of word w has index w * (8 * sizeof(T)) + b
+ *
+ * @tparam T The integral type of each word
+ */
+template <typename T>
+class set_bit_array_iterator final {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const std::size_t*;
+    using reference         = std::size_t;
+
+    /**
+     * Constructor
+     *
+     * @param [in] first The first word to visit
+     * @param [in] last  One past the final word to visit
+     */
+    constexpr set_bit_array_iterator(const T* first, const T* last) noexcept
+        : m_first(first), m_pos(first), m_last(last), m_word(0) {
+        if (m_pos != m_last) {
+            m_word = static_cast<detail::unsigned_t<T>>(*m_pos);
+            skip_empty();
+        }
+    }
+
+    /** @return The index of the current bit */
+    constexpr std::size_t operator*() const noexcept {
+        return static_cast<std::size_t>(m_pos - m_first) * (8 * sizeof(T)) +
+               static_cast<std::size_t>(lsb(m_word));
+    }
+
+    /** Advance to the next set bit */
+    constexpr set_bit_array_iterator& operator++() noexcept {
+        m_word = static_cast<detail::unsigned_t<T>>(m_word & (m_word - 1));
+        skip_empty();
+        return *this;
+    }
+
+    /** Advance to the next set bit */
+    constexpr set_bit_array_iterator operator++(int) noexcept {
+        set_bit_array_iterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    constexpr bool operator==(const set_bit_array_iterator& other) const
+        noexcept {
+        return m_pos == other.m_pos && m_word == other.m_word;
+    }
+
+    constexpr bool operator!=(const set_bit_array_iterator& other) const
+        noexcept {
+        return !(*this == other);
+    }
+
+ private:
+    /** Move forward to the next word with a bit set, or to the end */
+    constexpr void skip_empty() noexcept {
+        while (m_word == 0 && ++m_pos != m_last)
+            m_word = static_cast<detail::unsigned_t<T>>(*m_pos);
+    }
+
+    /** The first word of the array */
+    const T* m_first;
+
+    /** The word currently being visited */
+    const T* m_pos;
+
+    /** One past the final word */
+    const T* m_last;
+
+    /** The bits of *m_pos not yet visited */
+    detail::unsigned_t<T> m_word;
+};
+
+/**
+ * A lazy range over the indexes of the bits set in an array of words. See
+ * \ref set_bits()
+ *
+ * @tparam T The integral type of each word
+ */
+template <typename T>
+class set_bit_array_range final {
+ public:
+    using iterator = set_bit_array_iterator<T>;
+
+    /**
+     * Constructor
+     *
+     * @param [in] words     The words to visit
+     * @param [in] num_words The number of words
+     */
+    constexpr set_bit_array_range(const T* words, std::size_t num_words)
+        noexcept : m_first(words), m_last(words + num_words) {}
+
+    constexpr iterator begin() const noexcept {
+        return iterator(m_first, m_last);
+    }
+
+    constexpr iterator end() const noexcept {
+        return iterator(m_last, m_last);
+    }
+
+ private:
+    /** The first word */
+    const T* m_first;
+
+    /** One past the final word */
+    const T* m_last;
+};
+
+/**
+ * Iterate over the indexes of the bits set in a word, e.g.
+ *
+ * \code
+ * for (int bit : bitops::set_bits(word)) { ... }
+ * \endcode
+ *
+ * @param [in] word The word to parse
+ *
+ * @return A lazy range of bit indexes, from least to most significant
+ */
+template <typename T>
+constexpr set_bit_range<T> set_bits(T word) noexcept {
+    return set_bit_range<T>(word);
+}
+
+/**
+ * Iterate over the indexes of the bits set in an array of words, where bit b
+ * of word w has index w * (8 * sizeof(T)) + b
+ *
+ * @param [in] words     The words to parse
+ * @param [in] num_words The number of words
+ *
+ * @return A lazy range of bit indexes, in increasing order
+ */
+template <typename T>
+constexpr set_bit_array_range<T> set_bits(const T* words,
+                                          std::size_t num_words) noexcept {
+    return set_bit_array_range<T>(words, num_words);
+}
+
 /**
  *  Returns the indexes of all bits set in a word
  *
@@ -158,12 +677,7 @@ template<typename T> constexpr
 std::size_t get_1bits(T word, int* indexes) noexcept {
     std::size_t count = 0;
 
-    while (word) {
-        const int lsb_index = lsb(word);
-        indexes[count++] = lsb_index;
-
-        clear(lsb_index, &word);
-    }
+    for (int index : set_bits(word)) indexes[count++] = index;
 
     return count;
 }
@@ -176,14 +690,8 @@ std::size_t get_1bits(T word, int* indexes) noexcept {
  */
 template<typename T> inline
 void get_1bits(T word, std::vector<int>* indexes) {
-    indexes->clear();
-
-    while (word) {
-        const int lsb_index = lsb(word);
-        indexes->push_back(lsb_index);
-
-        clear(lsb_index, &word);
-    }
+    indexes->resize(bitops::count(word));
+    get_1bits(word, indexes->data());
 }
 
 /**
@@ -0,0 +1,742 @@
+/**
+ *  \file   bitvector.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_BITVECTOR_H_
+#define UTILITY_INCLUDE_BITOPS_BITVECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "bitops/aligned_allocator.h"
+#include "bitops/bitops.h"
+
+namespace jfern {
+namespace bitops {
+namespace detail {
+
+/*
+ * Bulk word kernels. Each op knows how to combine a pair of 64-bit words and,
+ * when the target has them, a pair of SSE2/AVX2 registers
+ */
+
+struct and_op {
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const noexcept {
+        return a & b;
+    }
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const noexcept {
+        return _mm_and_si128(a, b);
+    }
+#endif
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const noexcept {
+        return _mm256_and_si256(a, b);
+    }
+#endif
+};
+
+struct or_op {
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const noexcept {
+        return a | b;
+    }
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const noexcept {
+        return _mm_or_si128(a, b);
+    }
+#endif
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const noexcept {
+        return _mm256_or_si256(a, b);
+    }
+#endif
+};
+
+struct xor_op {
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const noexcept {
+        return a ^ b;
+    }
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const noexcept {
+        return _mm_xor_si128(a, b);
+    }
+#endif
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const noexcept {
+        return _mm256_xor_si256(a, b);
+    }
+#endif
+};
+
+/* Computes a & ~b */
+struct andnot_op {
+    std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const noexcept {
+        return a & ~b;
+    }
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const noexcept {
+        return _mm_andnot_si128(b, a);
+    }
+#endif
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const noexcept {
+        return _mm256_andnot_si256(b, a);
+    }
+#endif
+};
+
+/**
+ * Apply dst[i] = op(dst[i], src[i]) over two arrays of words
+ *
+ * @param [in,out] dst The destination words
+ * @param [in]     src The source words
+ * @param [in]     n   The number of words
+ * @param [in]     op  The binary operation
+ */
+template <typename Op>
+inline void transform_words(std::uint64_t* dst, const std::uint64_t* src,
+                            std::size_t n, Op op) noexcept {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        auto* d = reinterpret_cast<__m256i*>(dst + i);
+        const auto* s = reinterpret_cast<const __m256i*>(src + i);
+        _mm256_storeu_si256(d, op(_mm256_loadu_si256(d),
+                                  _mm256_loadu_si256(s)));
+    }
+#elif defined(__SSE2__)
+    for (; i + 2 <= n; i += 2) {
+        auto* d = reinterpret_cast<__m128i*>(dst + i);
+        const auto* s = reinterpret_cast<const __m128i*>(src + i);
+        _mm_storeu_si128(d, op(_mm_loadu_si128(d), _mm_loadu_si128(s)));
+    }
+#endif
+    for (; i < n; i++) dst[i] = op(dst[i], src[i]);
+}
+
+#ifdef __AVX2__
+
+/* Per-64-bit-lane population count of a 256-bit register */
+inline __m256i popcount256(__m256i v) noexcept {
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+
+    const __m256i lo = _mm256_and_si256(v, low_mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+
+    const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                           _mm256_shuffle_epi8(lookup, hi));
+
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+/* Carry-save adder: (h, l) = a + b + c, bitwise */
+inline void csa256(__m256i* h, __m256i* l,
+                   __m256i a, __m256i b, __m256i c) noexcept {
+    const __m256i u = _mm256_xor_si256(a, b);
+    *h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    *l = _mm256_xor_si256(u, c);
+}
+
+#endif  // __AVX2__
+
+/**
+ * Count the bits set in an array of words. With AVX2 this uses the
+ * Harley-Seal carry-save adder tree over blocks of 16 registers, so that only
+ * one in 16 registers needs a full population count
+ *
+ * @param [in] words The words to count
+ * @param [in] n     The number of words
+ *
+ * @return The total number of bits set
+ */
+inline std::size_t popcount_words(const std::uint64_t* words,
+                                  std::size_t n) noexcept {
+    std::size_t total = 0;
+    std::size_t i = 0;
+
+#ifdef __AVX2__
+    const std::size_t nvec = n / 4;
+
+    if (nvec >= 16) {
+        const auto* data = reinterpret_cast<const __m256i*>(words);
+        auto load = [data](std::size_t j) {
+            return _mm256_loadu_si256(data + j);
+        };
+
+        __m256i sum      = _mm256_setzero_si256();
+        __m256i ones     = _mm256_setzero_si256();
+        __m256i twos     = _mm256_setzero_si256();
+        __m256i fours    = _mm256_setzero_si256();
+        __m256i eights   = _mm256_setzero_si256();
+        __m256i sixteens, twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+
+        std::size_t j = 0;
+        for (; j + 16 <= nvec; j += 16) {
+            csa256(&twos_a,   &ones,   ones,   load(j+0),  load(j+1));
+            csa256(&twos_b,   &ones,   ones,   load(j+2),  load(j+3));
+            csa256(&fours_a,  &twos,   twos,   twos_a,     twos_b);
+            csa256(&twos_a,   &ones,   ones,   load(j+4),  load(j+5));
+            csa256(&twos_b,   &ones,   ones,   load(j+6),  load(j+7));
+            csa256(&fours_b,  &twos,   twos,   twos_a,     twos_b);
+            csa256(&eights_a, &fours,  fours,  fours_a,    fours_b);
+            csa256(&twos_a,   &ones,   ones,   load(j+8),  load(j+9));
+            csa256(&twos_b,   &ones,   ones,   load(j+10), load(j+11));
+            csa256(&fours_a,  &twos,   twos,   twos_a,     twos_b);
+            csa256(&twos_a,   &ones,   ones,   load(j+12), load(j+13));
+            csa256(&twos_b,   &ones,   ones,   load(j+14), load(j+15));
+            csa256(&fours_b,  &twos,   twos,   twos_a,     twos_b);
+            csa256(&eights_b, &fours,  fours,  fours_a,    fours_b);
+            csa256(&sixteens, &eights, eights, eights_a,   eights_b);
+
+            sum = _mm256_add_epi64(sum, popcount256(sixteens));
+        }
+
+        sum = _mm256_slli_epi64(sum, 4);
+        sum = _mm256_add_epi64(sum,
+                               _mm256_slli_epi64(popcount256(eights), 3));
+        sum = _mm256_add_epi64(sum,
+                               _mm256_slli_epi64(popcount256(fours),  2));
+        sum = _mm256_add_epi64(sum,
+                               _mm256_slli_epi64(popcount256(twos),   1));
+        sum = _mm256_add_epi64(sum, popcount256(ones));
+
+        for (; j < nvec; j++) sum = _mm256_add_epi64(sum, popcount256(load(j)));
+
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sum);
+
+        total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        i = nvec * 4;
+    }
+#endif
+
+    for (; i < n; i++) total += count(words[i]);
+
+    return total;
+}
+
+}  // namespace detail
+
+/** Sentinel to represent an out-of-range bit index */
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+/**
+ * A dynamically sized sequence of bits, stored as 64-bit words on a cache
+ * line boundary. Bulk operations work a full vector register at a time when
+ * the target supports SSE2/AVX2. Bits past size() in the final word are kept
+ * zero at all times
+ */
+class bitvector final {
+ public:
+    /** The storage type of a single word */
+    using word_type = std::uint64_t;
+
+    /** Number of bits per word */
+    static constexpr std::size_t word_bits = 64;
+
+    bitvector() = default;
+    explicit bitvector(std::size_t size, bool value = false);
+
+    bitvector(const bitvector& other)            = default;
+    bitvector(bitvector&& other)                 noexcept = default;
+    bitvector& operator=(const bitvector& other) = default;
+    bitvector& operator=(bitvector&& other)      noexcept = default;
+    ~bitvector()                                 = default;
+
+    std::size_t size()      const noexcept;
+    std::size_t num_words() const noexcept;
+    bool        empty()     const noexcept;
+
+    void resize(std::size_t size, bool value = false);
+
+    bool test(std::size_t index)       const noexcept;
+    bool operator[](std::size_t index) const noexcept;
+
+    bitvector& set()   noexcept;
+    bitvector& reset() noexcept;
+    bitvector& flip()  noexcept;
+
+    bitvector& set(std::size_t index, bool value = true) noexcept;
+    bitvector& reset(std::size_t index) noexcept;
+    bitvector& flip(std::size_t index)  noexcept;
+
+    std::size_t count() const noexcept;
+    bool        any()   const noexcept;
+    bool        none()  const noexcept;
+
+    std::size_t find_first() const noexcept;
+    std::size_t find_next(std::size_t index) const noexcept;
+    std::size_t find_last()  const noexcept;
+
+    bitvector& operator&=(const bitvector& other);
+    bitvector& operator|=(const bitvector& other);
+    bitvector& operator^=(const bitvector& other);
+    bitvector& and_not(const bitvector& other);
+
+    bitvector& operator<<=(std::size_t shift) noexcept;
+    bitvector& operator>>=(std::size_t shift) noexcept;
+
+    bool operator==(const bitvector& other) const noexcept;
+    bool operator!=(const bitvector& other) const noexcept;
+
+    word_type*       data()       noexcept;
+    const word_type* data() const noexcept;
+
+ private:
+    static std::size_t words_for(std::size_t bits) noexcept;
+
+    void check_size(const bitvector& other) const;
+    void trim() noexcept;
+
+    /** The words, 64-byte aligned */
+    std::vector<word_type, aligned_allocator<word_type, 64>> m_words;
+
+    /** The number of bits in use */
+    std::size_t m_size = 0;
+};
+
+/**
+ * Constructor
+ *
+ * @param [in] size  The number of bits
+ * @param [in] value The initial value of every bit
+ */
+inline bitvector::bitvector(std::size_t size, bool value)
+    : m_words(words_for(size), value ? ~word_type(0) : word_type(0)),
+      m_size(size) {
+    trim();
+}
+
+/**
+ * @return The number of bits in this vector
+ */
+inline std::size_t bitvector::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The number of 64-bit words backing this vector
+ */
+inline std::size_t bitvector::num_words() const noexcept {
+    return m_words.size();
+}
+
+/**
+ * @return True if this vector holds no bits
+ */
+inline bool bitvector::empty() const noexcept {
+    return m_size == 0;
+}
+
+/**
+ * Change the number of bits in this vector
+ *
+ * @param [in] size  The new number of bits
+ * @param [in] value The value of any bits appended
+ */
+inline void bitvector::resize(std::size_t size, bool value) {
+    const std::size_t old_size = m_size;
+    const word_type fill = value ? ~word_type(0) : word_type(0);
+
+    m_words.resize(words_for(size), fill);
+
+    if (value && size > old_size && old_size % word_bits != 0) {
+        m_words[old_size / word_bits] |=
+            ~word_type(0) << (old_size % word_bits);
+    }
+
+    m_size = size;
+    trim();
+}
+
+/**
+ * Check whether a bit is set
+ *
+ * @param [in] index The bit index. Must be less than size()
+ *
+ * @return True if the bit is set
+ */
+inline bool bitvector::test(std::size_t index) const noexcept {
+    return (m_words[index / word_bits] >> (index % word_bits)) & 1;
+}
+
+/**
+ * Check whether a bit is set
+ *
+ * @param [in] index The bit index. Must be less than size()
+ *
+ * @return True if the bit is set
+ */
+inline bool bitvector::operator[](std::size_t index) const noexcept {
+    return test(index);
+}
+
+/**
+ * Set every bit
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::set() noexcept {
+    std::fill(m_words.begin(), m_words.end(), ~word_type(0));
+    trim();
+    return *this;
+}
+
+/**
+ * Clear every bit
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::reset() noexcept {
+    std::fill(m_words.begin(), m_words.end(), word_type(0));
+    return *this;
+}
+
+/**
+ * Toggle every bit
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::flip() noexcept {
+    for (auto& word : m_words) word = ~word;
+    trim();
+    return *this;
+}
+
+/**
+ * Assign a value to a single bit
+ *
+ * @param [in] index The bit index. Must be less than size()
+ * @param [in] value The value to assign
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::set(std::size_t index, bool value) noexcept {
+    word_type& word = m_words[index / word_bits];
+    const int bit = static_cast<int>(index % word_bits);
+
+    if (value)
+        bitops::set(bit, &word);
+    else
+        bitops::clear(bit, &word);
+
+    return *this;
+}
+
+/**
+ * Clear a single bit
+ *
+ * @param [in] index The bit index. Must be less than size()
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::reset(std::size_t index) noexcept {
+    return set(index, false);
+}
+
+/**
+ * Toggle a single bit
+ *
+ * @param [in] index The bit index. Must be less than size()
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::flip(std::size_t index) noexcept {
+    m_words[index / word_bits] ^=
+        get_bit<word_type>(static_cast<int>(index % word_bits));
+    return *this;
+}
+
+/**
+ * Count the number of bits set
+ *
+ * @return The number of bits set
+ */
+inline std::size_t bitvector::count() const noexcept {
+    return detail::popcount_words(m_words.data(), m_words.size());
+}
+
+/**
+ * @return True if any bit is set
+ */
+inline bool bitvector::any() const noexcept {
+    for (word_type word : m_words) {
+        if (word) return true;
+    }
+
+    return false;
+}
+
+/**
+ * @return True if no bits are set
+ */
+inline bool bitvector::none() const noexcept {
+    return !any();
+}
+
+/**
+ * Find the lowest index whose bit is set
+ *
+ * @return The index, or \ref npos if no bits are set
+ */
+inline std::size_t bitvector::find_first() const noexcept {
+    for (std::size_t i = 0; i < m_words.size(); i++) {
+        if (m_words[i]) return i * word_bits + lsb(m_words[i]);
+    }
+
+    return npos;
+}
+
+/**
+ * Find the lowest index above \a index whose bit is set
+ *
+ * @param [in] index Begin the search just past this index
+ *
+ * @return The index, or \ref npos if there is none
+ */
+inline std::size_t bitvector::find_next(std::size_t index) const noexcept {
+    if (index == npos || ++index >= m_size) return npos;
+
+    std::size_t i = index / word_bits;
+
+    const word_type word = m_words[i] & (~word_type(0) << (index % word_bits));
+    if (word) return i * word_bits + lsb(word);
+
+    for (++i; i < m_words.size(); i++) {
+        if (m_words[i]) return i * word_bits + lsb(m_words[i]);
+    }
+
+    return npos;
+}
+
+/**
+ * Find the highest index whose bit is set
+ *
+ * @return The index, or \ref npos if no bits are set
+ */
+inline std::size_t bitvector::find_last() const noexcept {
+    for (std::size_t i = m_words.size(); i-- > 0;) {
+        if (m_words[i]) return i * word_bits + msb(m_words[i]);
+    }
+
+    return npos;
+}
+
+/**
+ * Bitwise AND with another vector of the same size
+ *
+ * @param [in] other The other vector
+ *
+ * @return *this
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+inline bitvector& bitvector::operator&=(const bitvector& other) {
+    check_size(other);
+    detail::transform_words(m_words.data(), other.m_words.data(),
+                            m_words.size(), detail::and_op());
+    return *this;
+}
+
+/**
+ * Bitwise OR with another vector of the same size
+ *
+ * @param [in] other The other vector
+ *
+ * @return *this
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+inline bitvector& bitvector::operator|=(const bitvector& other) {
+    check_size(other);
+    detail::transform_words(m_words.data(), other.m_words.data(),
+                            m_words.size(), detail::or_op());
+    return *this;
+}
+
+/**
+ * Bitwise XOR with another vector of the same size
+ *
+ * @param [in] other The other vector
+ *
+ * @return *this
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+inline bitvector& bitvector::operator^=(const bitvector& other) {
+    check_size(other);
+    detail::transform_words(m_words.data(), other.m_words.data(),
+                            m_words.size(), detail::xor_op());
+    return *this;
+}
+
+/**
+ * Clear every bit that is set in another vector of the same size, i.e.
+ * *this &= ~other
+ *
+ * @param [in] other The other vector
+ *
+ * @return *this
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+inline bitvector& bitvector::and_not(const bitvector& other) {
+    check_size(other);
+    detail::transform_words(m_words.data(), other.m_words.data(),
+                            m_words.size(), detail::andnot_op());
+    return *this;
+}
+
+/**
+ * Shift every bit toward higher indexes. Bits shifted past size() are lost,
+ * and zeros are shifted in at the bottom
+ *
+ * @param [in] shift The number of positions to shift by
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::operator<<=(std::size_t shift) noexcept {
+    if (shift >= m_size) return reset();
+    if (shift == 0) return *this;
+
+    const std::size_t word_shift = shift / word_bits;
+    const std::size_t bit_shift  = shift % word_bits;
+    const std::size_t n = m_words.size();
+
+    for (std::size_t i = n; i-- > word_shift;) {
+        word_type word = m_words[i - word_shift] << bit_shift;
+        if (bit_shift != 0 && i > word_shift) {
+            word |= m_words[i - word_shift - 1] >> (word_bits - bit_shift);
+        }
+        m_words[i] = word;
+    }
+
+    std::fill(m_words.begin(), m_words.begin() + word_shift, word_type(0));
+
+    trim();
+    return *this;
+}
+
+/**
+ * Shift every bit toward lower indexes. Bits shifted below index 0 are lost,
+ * and zeros are shifted in at the top
+ *
+ * @param [in] shift The number of positions to shift by
+ *
+ * @return *this
+ */
+inline bitvector& bitvector::operator>>=(std::size_t shift) noexcept {
+    if (shift >= m_size) return reset();
+    if (shift == 0) return *this;
+
+    const std::size_t word_shift = shift / word_bits;
+    const std::size_t bit_shift  = shift % word_bits;
+    const std::size_t n = m_words.size();
+
+    for (std::size_t i = 0; i + word_shift < n; i++) {
+        word_type word = m_words[i + word_shift] >> bit_shift;
+        if (bit_shift != 0 && i + word_shift + 1 < n) {
+            word |= m_words[i + word_shift + 1] << (word_bits - bit_shift);
+        }
+        m_words[i] = word;
+    }
+
+    std::fill(m_words.end() - word_shift, m_words.end(), word_type(0));
+
+    return *this;
+}
+
+/**
+ * @return True if both vectors have the same size and bits
+ */
+inline bool bitvector::operator==(const bitvector& other) const noexcept {
+    return m_size == other.m_size && m_words == other.m_words;
+}
+
+/**
+ * @return True if the vectors differ in size or in any bit
+ */
+inline bool bitvector::operator!=(const bitvector& other) const noexcept {
+    return !(*this == other);
+}
+
+/**
+ * @return The underlying words, least significant first
+ */
+inline bitvector::word_type* bitvector::data() noexcept {
+    return m_words.data();
+}
+
+/**
+ * @return The underlying words, least significant first
+ */
+inline const bitvector::word_type* bitvector::data() const noexcept {
+    return m_words.data();
+}
+
+/**
+ * @return The number of words needed to hold \a bits bits
+ */
+inline std::size_t bitvector::words_for(std::size_t bits) noexcept {
+    return (bits + word_bits - 1) / word_bits;
+}
+
+/**
+ * Make sure another vector is the same size as this one
+ *
+ * @throws std::invalid_argument if the sizes differ
+ */
+inline void bitvector::check_size(const bitvector& other) const {
+    if (m_size != other.m_size)
+        throw std::invalid_argument("bitvector sizes differ");
+}
+
+/**
+ * Zero the unused bits at the top of the final word
+ */
+inline void bitvector::trim() noexcept {
+    const std::size_t used = m_size % word_bits;
+    if (used != 0) m_words.back() &= ~(~word_type(0) << used);
+}
+
+/**
+ * Bitwise AND of two vectors of the same size
+ */
+inline bitvector operator&(bitvector lhs, const bitvector& rhs) {
+    return lhs &= rhs;
+}
+
+/**
+ * Bitwise OR of two vectors of the same size
+ */
+inline bitvector operator|(bitvector lhs, const bitvector& rhs) {
+    return lhs |= rhs;
+}
+
+/**
+ * Bitwise XOR of two vectors of the same size
+ */
+inline bitvector operator^(bitvector lhs, const bitvector& rhs) {
+    return lhs ^= rhs;
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_BITVECTOR_H_
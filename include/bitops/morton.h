@@ -0,0 +1,274 @@
+/**
+ *  \file   morton.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_MORTON_H_
+#define UTILITY_INCLUDE_BITOPS_MORTON_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "bitops/bitops.h"
+
+namespace jfern {
+namespace bitops {
+namespace detail {
+
+/** Every other bit, starting from bit 0 */
+constexpr std::uint64_t morton2_mask = 0x5555555555555555ull;
+
+/** Every third bit, starting from bit 0, for 21 bits */
+constexpr std::uint64_t morton3_mask = 0x1249249249249249ull;
+
+/**
+ * @return The number of bits each coordinate gets in a D-dimensional Morton
+ *         code of type T
+ */
+template <typename T, int D>
+constexpr int morton_bits() noexcept {
+    return static_cast<int>(8 * sizeof(T)) / D;
+}
+
+/**
+ * @return Bits 0, D, 2D, ... of a word of type T, one per coordinate bit
+ */
+template <typename T, int D>
+constexpr T morton_mask() noexcept {
+    using U = unsigned_t<T>;
+
+    constexpr int used = D * morton_bits<T, D>();
+    constexpr std::uint64_t all = D == 2 ? morton2_mask : morton3_mask;
+
+    return T(U(used == 64 ? all : all & ((std::uint64_t(1) << used) - 1)));
+}
+
+/**
+ * Spread the low 32 bits of a word out to the even bit positions
+ */
+constexpr std::uint64_t spread2(std::uint64_t x) noexcept {
+    x &= 0xffffffffull;
+    x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+    x = (x | (x << 8))  & 0x00ff00ff00ff00ffull;
+    x = (x | (x << 4))  & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x << 2))  & 0x3333333333333333ull;
+    x = (x | (x << 1))  & 0x5555555555555555ull;
+    return x;
+}
+
+/**
+ * Gather the even bits of a word into its low 32 bits. Inverse of
+ * \ref spread2()
+ */
+constexpr std::uint64_t compact2(std::uint64_t x) noexcept {
+    x &= 0x5555555555555555ull;
+    x = (x | (x >> 1))  & 0x3333333333333333ull;
+    x = (x | (x >> 2))  & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x >> 4))  & 0x00ff00ff00ff00ffull;
+    x = (x | (x >> 8))  & 0x0000ffff0000ffffull;
+    x = (x | (x >> 16)) & 0x00000000ffffffffull;
+    return x;
+}
+
+/**
+ * Spread the low 21 bits of a word out to every third bit position
+ */
+constexpr std::uint64_t spread3(std::uint64_t x) noexcept {
+    x &= 0x1fffffull;
+    x = (x | (x << 32)) & 0x001f00000000ffffull;
+    x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+    x = (x | (x << 8))  & 0x100f00f00f00f00full;
+    x = (x | (x << 4))  & 0x10c30c30c30c30c3ull;
+    x = (x | (x << 2))  & 0x1249249249249249ull;
+    return x;
+}
+
+/**
+ * Gather every third bit of a word into its low 21 bits. Inverse of
+ * \ref spread3()
+ */
+constexpr std::uint64_t compact3(std::uint64_t x) noexcept {
+    x &= 0x1249249249249249ull;
+    x = (x | (x >> 2))  & 0x10c30c30c30c30c3ull;
+    x = (x | (x >> 4))  & 0x100f00f00f00f00full;
+    x = (x | (x >> 8))  & 0x001f0000ff0000ffull;
+    x = (x | (x >> 16)) & 0x001f00000000ffffull;
+    x = (x | (x >> 32)) & 0x00000000001fffffull;
+    return x;
+}
+
+/**
+ * Place the coordinate bits of a D-dimensional Morton code of type T at bits
+ * 0, D, 2D, ... Uses PDEP on BMI2 targets, and magic-mask shifts otherwise
+ */
+template <typename T, int D>
+constexpr T morton_spread(T coordinate) noexcept {
+    using U = unsigned_t<T>;
+#ifdef UTILITY_BITOPS_HAS_BMI2
+    if (!__builtin_is_constant_evaluated())
+        return pdep(T(U(coordinate)), morton_mask<T, D>());
+#endif
+    const std::uint64_t x = U(coordinate) &
+        ((std::uint64_t(1) << morton_bits<T, D>()) - 1);
+    return T(U(D == 2 ? spread2(x) : spread3(x)));
+}
+
+/**
+ * Gather the bits at 0, D, 2D, ... of a D-dimensional Morton code into a
+ * coordinate. Uses PEXT on BMI2 targets, and magic-mask shifts otherwise
+ */
+template <typename T, int D>
+constexpr T morton_compact(T code) noexcept {
+    using U = unsigned_t<T>;
+#ifdef UTILITY_BITOPS_HAS_BMI2
+    if (!__builtin_is_constant_evaluated())
+        return pext(code, morton_mask<T, D>());
+#endif
+    const std::uint64_t x = U(code) & U(morton_mask<T, D>());
+    return T(U(D == 2 ? compact2(x) : compact3(x)));
+}
+
+}  // namespace detail
+
+/**
+ * Interleave two coordinates into a 2D Morton (Z-order) code, with \a x in
+ * the even bits and \a y in the odd bits. Each coordinate contributes its low
+ * n/2 bits
+ *
+ * @param [in] x The first coordinate
+ * @param [in] y The second coordinate
+ *
+ * @return The n-bit Morton code
+ */
+template <typename T>
+constexpr T morton_encode(T x, T y) noexcept {
+    static_assert(std::is_integral<T>::value, "T must be an integer");
+    using U = detail::unsigned_t<T>;
+    return T(U(detail::morton_spread<T, 2>(x)) |
+             U(U(detail::morton_spread<T, 2>(y)) << 1));
+}
+
+/**
+ * Interleave three coordinates into a 3D Morton code, with \a x in bits 0,
+ * 3, 6, ..., \a y in bits 1, 4, 7, ... and \a z in bits 2, 5, 8, ... Each
+ * coordinate contributes its low floor(n/3) bits
+ *
+ * @param [in] x The first coordinate
+ * @param [in] y The second coordinate
+ * @param [in] z The third coordinate
+ *
+ * @return The n-bit Morton code
+ */
+template <typename T>
+constexpr T morton_encode(T x, T y, T z) noexcept {
+    static_assert(std::is_integral<T>::value, "T must be an integer");
+    using U = detail::unsigned_t<T>;
+    return T(U(detail::morton_spread<T, 3>(x)) |
+             U(U(detail::morton_spread<T, 3>(y)) << 1) |
+             U(U(detail::morton_spread<T, 3>(z)) << 2));
+}
+
+/**
+ * Split a 2D Morton code back into its coordinates
+ *
+ * @param [in]  code The Morton code
+ * @param [out] x    The first coordinate
+ * @param [out] y    The second coordinate
+ */
+template <typename T>
+constexpr void morton_decode(T code, T* x, T* y) noexcept {
+    static_assert(std::is_integral<T>::value, "T must be an integer");
+    using U = detail::unsigned_t<T>;
+    *x = detail::morton_compact<T, 2>(code);
+    *y = detail::morton_compact<T, 2>(T(U(code) >> 1));
+}
+
+/**
+ * Split a 3D Morton code back into its coordinates
+ *
+ * @param [in]  code The Morton code
+ * @param [out] x    The first coordinate
+ * @param [out] y    The second coordinate
+ * @param [out] z    The third coordinate
+ */
+template <typename T>
+constexpr void morton_decode(T code, T* x, T* y, T* z) noexcept {
+    static_assert(std::is_integral<T>::value, "T must be an integer");
+    using U = detail::unsigned_t<T>;
+    *x = detail::morton_compact<T, 3>(code);
+    *y = detail::morton_compact<T, 3>(T(U(code) >> 1));
+    *z = detail::morton_compact<T, 3>(T(U(code) >> 2));
+}
+
+/**
+ * Encode an array of 2D points
+ *
+ * @param [in]  xs    The first coordinates
+ * @param [in]  ys    The second coordinates
+ * @param [in]  n     The number of points
+ * @param [out] codes The Morton codes
+ */
+template <typename T>
+inline void morton_encode(const T* xs, const T* ys, std::size_t n,
+                          T* codes) noexcept {
+    for (std::size_t i = 0; i < n; i++)
+        codes[i] = morton_encode(xs[i], ys[i]);
+}
+
+/**
+ * Encode an array of 3D points
+ *
+ * @param [in]  xs    The first coordinates
+ * @param [in]  ys    The second coordinates
+ * @param [in]  zs    The third coordinates
+ * @param [in]  n     The number of points
+ * @param [out] codes The Morton codes
+ */
+template <typename T>
+inline void morton_encode(const T* xs, const T* ys, const T* zs,
+                          std::size_t n, T* codes) noexcept {
+    for (std::size_t i = 0; i < n; i++)
+        codes[i] = morton_encode(xs[i], ys[i], zs[i]);
+}
+
+/**
+ * Decode an array of 2D Morton codes
+ *
+ * @param [in]  codes The Morton codes
+ * @param [in]  n     The number of codes
+ * @param [out] xs    The first coordinates
+ * @param [out] ys    The second coordinates
+ */
+template <typename T>
+inline void morton_decode(const T* codes, std::size_t n, T* xs,
+                          T* ys) noexcept {
+    for (std::size_t i = 0; i < n; i++)
+        morton_decode(codes[i], &xs[i], &ys[i]);
+}
+
+/**
+ * Decode an array of 3D Morton codes
+ *
+ * @param [in]  codes The Morton codes
+ * @param [in]  n     The number of codes
+ * @param [out] xs    The first coordinates
+ * @param [out] ys    The second coordinates
+ * @param [out] zs    The third coordinates
+ */
+template <typename T>
+inline void morton_decode(const T* codes, std::size_t n, T* xs, T* ys,
+                          T* zs) noexcept {
+    for (std::size_t i = 0; i < n; i++)
+        morton_decode(codes[i], &xs[i], &ys[i], &zs[i]);
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_MORTON_H_
@@ -0,0 +1,305 @@
+/**
+ *  \file   rank_select.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_RANK_SELECT_H_
+#define UTILITY_INCLUDE_BITOPS_RANK_SELECT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+#include "bitops/bitops.h"
+#include "bitops/bitvector.h"
+
+namespace jfern {
+namespace bitops {
+namespace detail {
+
+/**
+ * Find the position of the k-th (0 based) set bit within a word. Uses PDEP
+ * when the target has BMI2, and a broadword byte-rank search otherwise
+ *
+ * @param [in] word The word to search
+ * @param [in] k    The rank of the desired bit. Must be less than
+ *                  count(word)
+ *
+ * @return The bit index
+ */
+inline int select_in_word(std::uint64_t word, unsigned int k) noexcept {
+#ifdef __BMI2__
+    return lsb(_pdep_u64(std::uint64_t(1) << k, word));
+#else
+    constexpr std::uint64_t ones8 = 0x0101010101010101ull;
+    constexpr std::uint64_t high8 = 0x8080808080808080ull;
+
+    /* Per-byte population counts, then their running sums */
+    std::uint64_t sums = word - ((word >> 1) & 0x5555555555555555ull);
+    sums = (sums & 0x3333333333333333ull) +
+           ((sums >> 2) & 0x3333333333333333ull);
+    sums = ((sums + (sums >> 4)) & 0x0f0f0f0f0f0f0f0full) * ones8;
+
+    /* Bytes whose running sum is <= k are skipped over entirely */
+    const int byte = count((((k * ones8) | high8) - sums) & high8);
+    const unsigned int before =
+        byte == 0 ? 0 : (sums >> (8 * (byte - 1))) & 0xff;
+
+    std::uint8_t bits = static_cast<std::uint8_t>(word >> (8 * byte));
+    for (unsigned int i = before; i < k; i++) bits &= bits - 1;
+
+    return 8 * byte + lsb(bits);
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * A succinct rank/select index over a \ref bitvector
+ *
+ * The bit vector is divided into 2048-bit blocks. Each block owns a single
+ * 64-bit entry which interleaves its cumulative rank (32 bits, relative to a
+ * 2^32-bit region) with the population counts of its first three 512-bit
+ * sub-blocks (10 bits each), for a space overhead of about 3.1%. Select
+ * samples the block holding every 8192nd set bit, adding at most 0.8%
+ *
+ * The index refers to the bit vector it was built from, which must outlive it
+ * and must not be modified while it is in use
+ */
+class rank_select final {
+ public:
+    explicit rank_select(const bitvector& bits);
+
+    rank_select(const rank_select& other)            = default;
+    rank_select(rank_select&& other)                 noexcept = default;
+    rank_select& operator=(const rank_select& other) = default;
+    rank_select& operator=(rank_select&& other)      noexcept = default;
+    ~rank_select()                                   = default;
+
+    std::size_t rank(std::size_t index)  const noexcept;
+    std::size_t rank0(std::size_t index) const noexcept;
+    std::size_t select(std::size_t k)    const noexcept;
+
+    std::size_t count()       const noexcept;
+    std::size_t size()        const noexcept;
+    std::size_t space_bytes() const noexcept;
+
+ private:
+    /** Bits per block */
+    static constexpr std::size_t block_bits = 2048;
+
+    /** Bits per sub-block */
+    static constexpr std::size_t sub_bits = 512;
+
+    /** Set bits between consecutive select samples */
+    static constexpr std::size_t sample_rate = 8192;
+
+    /** log2 of the number of bits per region */
+    static constexpr int region_shift = 32;
+
+    std::size_t block_rank(std::size_t block) const noexcept;
+
+    /** The words of the indexed bit vector */
+    const std::uint64_t* m_words;
+
+    /** The number of bits in the indexed bit vector */
+    std::size_t m_size;
+
+    /** Cumulative rank at the start of each 2^32-bit region */
+    std::vector<std::uint64_t> m_regions;
+
+    /** Interleaved block and sub-block counts, plus one trailing entry */
+    std::vector<std::uint64_t> m_blocks;
+
+    /** The block holding every sample_rate-th set bit */
+    std::vector<std::size_t> m_samples;
+};
+
+/**
+ * Constructor. Builds the index in a single pass over \a bits
+ *
+ * @param [in] bits The bit vector to index
+ */
+inline rank_select::rank_select(const bitvector& bits)
+    : m_words(bits.data()), m_size(bits.size()) {
+    constexpr std::size_t words_per_block = block_bits / 64;
+    constexpr std::size_t words_per_sub   = sub_bits / 64;
+
+    const std::size_t num_words  = bits.num_words();
+    const std::size_t num_blocks = (m_size + block_bits - 1) / block_bits;
+
+    m_regions.reserve((std::uint64_t(m_size) >> region_shift) + 1);
+    m_blocks.reserve(num_blocks + 1);
+
+    std::uint64_t total = 0, region_base = 0;
+
+    for (std::size_t block = 0; block <= num_blocks; block++) {
+        if (((std::uint64_t(block) * block_bits) >> region_shift) ==
+                m_regions.size()) {
+            region_base = total;
+            m_regions.push_back(region_base);
+        }
+
+        std::uint64_t entry = total - region_base;
+
+        for (std::size_t sub = 0; sub < 4; sub++) {
+            const std::size_t first = block * words_per_block +
+                                      sub * words_per_sub;
+            const std::size_t last  = std::min(first + words_per_sub,
+                                               num_words);
+
+            std::uint64_t sub_count = 0;
+            for (std::size_t w = first; w < last; w++)
+                sub_count += bitops::count(m_words[w]);
+
+            if (sub < 3) entry |= sub_count << (32 + 10 * sub);
+
+            while (m_samples.size() * sample_rate < total + sub_count)
+                m_samples.push_back(block);
+
+            total += sub_count;
+        }
+
+        m_blocks.push_back(entry);
+    }
+}
+
+/**
+ * Count the set bits before a position
+ *
+ * @param [in] index The position. Must not exceed size()
+ *
+ * @return The number of set bits in [0, index)
+ */
+inline std::size_t rank_select::rank(std::size_t index) const noexcept {
+    const std::size_t block = index / block_bits;
+    const std::uint64_t entry = m_blocks[block];
+
+    std::size_t result = m_regions[std::uint64_t(index) >> region_shift] +
+                         (entry & 0xffffffffu);
+
+    const std::size_t sub = (index / sub_bits) % 4;
+    for (std::size_t s = 0; s < sub; s++)
+        result += (entry >> (32 + 10 * s)) & 0x3ff;
+
+    const std::size_t last = index / 64;
+    for (std::size_t w = index / sub_bits * (sub_bits / 64); w < last; w++)
+        result += bitops::count(m_words[w]);
+
+    if (index % 64 != 0) {
+        result += bitops::count(m_words[last] &
+                                ~(~std::uint64_t(0) << (index % 64)));
+    }
+
+    return result;
+}
+
+/**
+ * Count the clear bits before a position
+ *
+ * @param [in] index The position. Must not exceed size()
+ *
+ * @return The number of clear bits in [0, index)
+ */
+inline std::size_t rank_select::rank0(std::size_t index) const noexcept {
+    return index - rank(index);
+}
+
+/**
+ * Find the position of the k-th set bit
+ *
+ * @param [in] k The (0 based) rank of the desired bit
+ *
+ * @return The position of the bit, or \ref npos if fewer than k+1 bits
+ *         are set
+ */
+inline std::size_t rank_select::select(std::size_t k) const noexcept {
+    if (k >= count()) return npos;
+
+    /*
+     * The samples bracket the block holding bit k; binary search the
+     * cumulative ranks in between for the last block starting at or below k
+     */
+    const std::size_t sample = k / sample_rate;
+
+    std::size_t lo = m_samples[sample];
+    std::size_t hi = sample + 1 < m_samples.size() ?
+                        m_samples[sample + 1] : m_blocks.size() - 1;
+
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo + 1) / 2;
+        if (block_rank(mid) <= k)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    const std::uint64_t entry = m_blocks[lo];
+    std::size_t remaining = k - block_rank(lo);
+
+    std::size_t sub = 0;
+    for (; sub < 3; sub++) {
+        const std::size_t sub_count = (entry >> (32 + 10 * sub)) & 0x3ff;
+        if (remaining < sub_count) break;
+        remaining -= sub_count;
+    }
+
+    std::size_t w = lo * (block_bits / 64) + sub * (sub_bits / 64);
+    for (;; w++) {
+        const std::size_t word_count = bitops::count(m_words[w]);
+        if (remaining < word_count) break;
+        remaining -= word_count;
+    }
+
+    return w * 64 + detail::select_in_word(
+        m_words[w], static_cast<unsigned int>(remaining));
+}
+
+/**
+ * @return The total number of set bits
+ */
+inline std::size_t rank_select::count() const noexcept {
+    return block_rank(m_blocks.size() - 1);
+}
+
+/**
+ * @return The number of bits indexed
+ */
+inline std::size_t rank_select::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The memory used by the index itself, in bytes, not including the
+ *         bit vector
+ */
+inline std::size_t rank_select::space_bytes() const noexcept {
+    return sizeof(*this) +
+           m_regions.capacity() * sizeof(std::uint64_t) +
+           m_blocks.capacity()  * sizeof(std::uint64_t) +
+           m_samples.capacity() * sizeof(std::size_t);
+}
+
+/**
+ * @return The number of set bits before the start of a block
+ */
+inline std::size_t rank_select::block_rank(std::size_t block) const noexcept {
+    const std::size_t region =
+        (std::uint64_t(block) * block_bits) >> region_shift;
+    return m_regions[region] + (m_blocks[block] & 0xffffffffu);
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_RANK_SELECT_H_
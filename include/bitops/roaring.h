@@ -0,0 +1,1345 @@
+/**
+ *  \file   roaring.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  \brief A compressed bitmap of 32-bit values in the style of Roaring
+ *         bitmaps (Chambi, Lemire et al.)
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_ROARING_H_
+#define UTILITY_INCLUDE_BITOPS_ROARING_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bitops/bitops.h"
+#include "bitops/bitvector.h"
+
+namespace jfern {
+namespace bitops {
+namespace detail {
+
+/** How a 64K chunk of values is stored */
+enum class container_type : std::uint16_t {
+    array  = 0,  // sorted 16-bit values
+    bitmap = 1,  // 1024 64-bit words
+    run    = 2   // sorted (start, length - 1) pairs
+};
+
+/** Above this many values an array container becomes a bitmap */
+constexpr std::uint32_t array_max = 4096;
+
+/** The number of words in a bitmap container */
+constexpr std::size_t bitmap_words = 1024;
+
+/**
+ * Holds the low 16 bits of every value that shares a common high 16 bits
+ */
+struct roaring_container {
+    /** The storage format */
+    container_type type = container_type::array;
+
+    /** The number of values held */
+    std::uint32_t cardinality = 0;
+
+    /** Array values, or interleaved run starts and lengths */
+    std::vector<std::uint16_t> values;
+
+    /** Bitmap words */
+    std::vector<std::uint64_t> words;
+
+    /**
+     * @return The number of runs in a run container
+     */
+    std::size_t num_runs() const noexcept {
+        return values.size() / 2;
+    }
+
+    /**
+     * Check whether a value is present
+     *
+     * @param [in] low The low 16 bits of the value
+     *
+     * @return True if present
+     */
+    bool contains(std::uint16_t low) const noexcept {
+        switch (type) {
+          case container_type::array:
+            return std::binary_search(values.begin(), values.end(), low);
+          case container_type::bitmap:
+            return (words[low >> 6] >> (low & 63)) & 1;
+          case container_type::run:
+          default:
+            break;
+        }
+
+        /* Find the last run starting at or before low */
+        std::size_t lo = 0, hi = num_runs();
+        while (lo < hi) {
+            const std::size_t mid = (lo + hi) / 2;
+            if (values[2 * mid] <= low)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        return lo > 0 &&
+            std::uint32_t(low - values[2 * (lo - 1)]) <= values[2 * lo - 1];
+    }
+
+    /**
+     * Expand this container into 1024 bitmap words
+     *
+     * @param [out] out The words
+     */
+    void to_words(std::vector<std::uint64_t>* out) const {
+        if (type == container_type::bitmap) {
+            *out = words;
+            return;
+        }
+
+        out->assign(bitmap_words, 0);
+
+        if (type == container_type::array) {
+            for (std::uint16_t v : values)
+                (*out)[v >> 6] |= std::uint64_t(1) << (v & 63);
+        } else {
+            for (std::size_t r = 0; r < num_runs(); r++) {
+                set_range(out->data(), values[2 * r],
+                          std::uint32_t(values[2 * r]) + values[2 * r + 1] + 1);
+            }
+        }
+    }
+
+    /**
+     * Rebuild this container from bitmap words, choosing an array when the
+     * cardinality allows
+     *
+     * @param [in] in The words, which are consumed
+     */
+    void from_words(std::vector<std::uint64_t>&& in) {
+        cardinality = static_cast<std::uint32_t>(
+            popcount_words(in.data(), in.size()));
+        values.clear();
+
+        if (cardinality <= array_max) {
+            type = container_type::array;
+            values.reserve(cardinality);
+            for (std::size_t v : set_bits(in.data(), in.size()))
+                values.push_back(static_cast<std::uint16_t>(v));
+            words.clear();
+            words.shrink_to_fit();
+        } else {
+            type  = container_type::bitmap;
+            words = std::move(in);
+        }
+    }
+
+    /**
+     * Convert a run container to an array or bitmap so that it can be
+     * modified one value at a time
+     */
+    void expand() {
+        if (type != container_type::run) return;
+
+        std::vector<std::uint64_t> expanded;
+        to_words(&expanded);
+        from_words(std::move(expanded));
+    }
+
+    /**
+     * Insert a value
+     *
+     * @param [in] low The low 16 bits of the value
+     *
+     * @return True if the value was not already present
+     */
+    bool add(std::uint16_t low) {
+        expand();
+
+        if (type == container_type::bitmap) {
+            std::uint64_t& word = words[low >> 6];
+            const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+            if (word & bit) return false;
+
+            word |= bit;
+            cardinality++;
+            return true;
+        }
+
+        const auto iter = std::lower_bound(values.begin(), values.end(), low);
+        if (iter != values.end() && *iter == low) return false;
+
+        if (cardinality < array_max) {
+            values.insert(iter, low);
+            cardinality++;
+            return true;
+        }
+
+        std::vector<std::uint64_t> expanded;
+        to_words(&expanded);
+        expanded[low >> 6] |= std::uint64_t(1) << (low & 63);
+        from_words(std::move(expanded));
+
+        return true;
+    }
+
+    /**
+     * Erase a value
+     *
+     * @param [in] low The low 16 bits of the value
+     *
+     * @return True if the value was present
+     */
+    bool remove(std::uint16_t low) {
+        expand();
+
+        if (type == container_type::bitmap) {
+            std::uint64_t& word = words[low >> 6];
+            const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+            if (!(word & bit)) return false;
+
+            word ^= bit;
+            if (--cardinality <= array_max) {
+                std::vector<std::uint64_t> shrunk = std::move(words);
+                from_words(std::move(shrunk));
+            }
+            return true;
+        }
+
+        const auto iter = std::lower_bound(values.begin(), values.end(), low);
+        if (iter == values.end() || *iter != low) return false;
+
+        values.erase(iter);
+        cardinality--;
+        return true;
+    }
+
+    /**
+     * Count the runs of consecutive values
+     *
+     * @return The number of runs
+     */
+    std::size_t count_runs() const {
+        switch (type) {
+          case container_type::run:
+            return num_runs();
+          case container_type::array: {
+            std::size_t runs = 0;
+            for (std::size_t i = 0; i < values.size(); i++) {
+                if (i == 0 || values[i] != values[i - 1] + 1) runs++;
+            }
+            return runs;
+          }
+          case container_type::bitmap:
+          default:
+            break;
+        }
+
+        /* A run starts wherever a set bit follows a clear one */
+        std::size_t runs = 0;
+        std::uint64_t carry = 0;
+        for (std::uint64_t word : words) {
+            runs += count(word & ~((word << 1) | carry));
+            carry = word >> 63;
+        }
+
+        return runs;
+    }
+
+    /**
+     * Switch to whichever of the array, bitmap and run formats is smallest
+     *
+     * @return True if this is now a run container
+     */
+    bool optimize() {
+        const std::size_t runs       = count_runs();
+        const std::size_t run_bytes  = 4 * runs;
+        const std::size_t flat_bytes = cardinality <= array_max ?
+                                       2 * cardinality : 8 * bitmap_words;
+
+        if (run_bytes < flat_bytes) {
+            if (type == container_type::run) return true;
+
+            std::vector<std::uint64_t> flat;
+            to_words(&flat);
+
+            values.clear();
+            values.reserve(2 * runs);
+
+            /* Walk the set bits, extending or starting runs */
+            for (std::size_t v : set_bits(flat.data(), flat.size())) {
+                const auto low = static_cast<std::uint16_t>(v);
+                if (!values.empty() &&
+                    std::uint32_t(values[values.size() - 2]) +
+                        values.back() + 1 == low) {
+                    values.back()++;
+                } else {
+                    values.push_back(low);
+                    values.push_back(0);
+                }
+            }
+
+            type = container_type::run;
+            words.clear();
+            words.shrink_to_fit();
+            return true;
+        }
+
+        expand();
+        return false;
+    }
+
+    /**
+     * @return The heap memory used by this container, in bytes
+     */
+    std::size_t memory_bytes() const noexcept {
+        return values.capacity() * sizeof(std::uint16_t) +
+               words.capacity()  * sizeof(std::uint64_t);
+    }
+
+    /**
+     * Set the bits of a half-open range within bitmap words
+     *
+     * @param [in,out] words The bitmap words
+     * @param [in]     first The first bit to set
+     * @param [in]     last  One past the final bit to set
+     */
+    static void set_range(std::uint64_t* words, std::uint32_t first,
+                          std::uint32_t last) noexcept {
+        if (first >= last) return;
+
+        const std::uint32_t first_word = first >> 6;
+        const std::uint32_t last_word  = (last - 1) >> 6;
+
+        const std::uint64_t head = ~std::uint64_t(0) << (first & 63);
+        const std::uint64_t tail =
+            ~std::uint64_t(0) >> (63 - ((last - 1) & 63));
+
+        if (first_word == last_word) {
+            words[first_word] |= head & tail;
+            return;
+        }
+
+        words[first_word] |= head;
+        for (std::uint32_t w = first_word + 1; w < last_word; w++)
+            words[w] = ~std::uint64_t(0);
+        words[last_word] |= tail;
+    }
+};
+
+/**
+ * Union of two containers
+ */
+inline roaring_container container_or(const roaring_container& a,
+                                      const roaring_container& b) {
+    roaring_container result;
+
+    if (a.type == container_type::array && b.type == container_type::array &&
+        a.cardinality + b.cardinality <= array_max) {
+        result.values.reserve(a.cardinality + b.cardinality);
+        std::set_union(a.values.begin(), a.values.end(),
+                       b.values.begin(), b.values.end(),
+                       std::back_inserter(result.values));
+        result.cardinality = static_cast<std::uint32_t>(result.values.size());
+        return result;
+    }
+
+    std::vector<std::uint64_t> lhs, rhs;
+    a.to_words(&lhs);
+
+    if (b.type == container_type::array) {
+        for (std::uint16_t v : b.values)
+            lhs[v >> 6] |= std::uint64_t(1) << (v & 63);
+    } else {
+        b.to_words(&rhs);
+        transform_words(lhs.data(), rhs.data(), lhs.size(), or_op());
+    }
+
+    result.from_words(std::move(lhs));
+    return result;
+}
+
+/**
+ * Intersection of two containers
+ */
+inline roaring_container container_and(const roaring_container& a,
+                                       const roaring_container& b) {
+    roaring_container result;
+
+    if (a.type == container_type::array || b.type == container_type::array) {
+        const roaring_container& small =
+            a.type == container_type::array ? a : b;
+        const roaring_container& other = &small == &a ? b : a;
+
+        if (other.type == container_type::array) {
+            std::set_intersection(small.values.begin(), small.values.end(),
+                                  other.values.begin(), other.values.end(),
+                                  std::back_inserter(result.values));
+        } else {
+            for (std::uint16_t v : small.values) {
+                if (other.contains(v)) result.values.push_back(v);
+            }
+        }
+
+        result.cardinality = static_cast<std::uint32_t>(result.values.size());
+        return result;
+    }
+
+    std::vector<std::uint64_t> lhs, rhs;
+    a.to_words(&lhs);
+    b.to_words(&rhs);
+    transform_words(lhs.data(), rhs.data(), lhs.size(), and_op());
+
+    result.from_words(std::move(lhs));
+    return result;
+}
+
+/**
+ * Difference of two containers, i.e. the values of \a a not in \a b
+ */
+inline roaring_container container_andnot(const roaring_container& a,
+                                          const roaring_container& b) {
+    roaring_container result;
+
+    if (a.type == container_type::array) {
+        for (std::uint16_t v : a.values) {
+            if (!b.contains(v)) result.values.push_back(v);
+        }
+
+        result.cardinality = static_cast<std::uint32_t>(result.values.size());
+        return result;
+    }
+
+    std::vector<std::uint64_t> lhs, rhs;
+    a.to_words(&lhs);
+
+    if (b.type == container_type::array) {
+        for (std::uint16_t v : b.values)
+            lhs[v >> 6] &= ~(std::uint64_t(1) << (v & 63));
+    } else {
+        b.to_words(&rhs);
+        transform_words(lhs.data(), rhs.data(), lhs.size(), andnot_op());
+    }
+
+    result.from_words(std::move(lhs));
+    return result;
+}
+
+/*
+ * Little-endian loads and stores for the serialized format. Compilers reduce
+ * these to plain moves on little-endian targets
+ */
+
+template <typename T>
+inline T load_le(const std::uint8_t* src) noexcept {
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++)
+        value = static_cast<T>(value | (T(src[i]) << (8 * i)));
+    return value;
+}
+
+template <typename T>
+inline void store_le(T value, std::uint8_t* dst) noexcept {
+    for (std::size_t i = 0; i < sizeof(T); i++)
+        dst[i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+}  // namespace detail
+
+/**
+ * A set of 32-bit values, split into 64K-value chunks by their high 16 bits.
+ * Each chunk is stored in whichever form suits its density: a sorted array
+ * of up to 4096 values, an 8 KiB bitmap, or (after \ref run_optimize()) a
+ * list of runs
+ *
+ * The serialized form (see \ref serialize()) is little-endian with 8-byte
+ * aligned payloads, and can be queried in place by \ref roaring_view:
+ *
+ * \code
+ * u32 magic "JRB1" | u32 n | n x { u16 key, u16 type, u32 cardinality,
+ *                                  u32 count, u32 offset } | payloads
+ * \endcode
+ */
+class roaring_bitmap final {
+ public:
+    class const_iterator;
+    using iterator = const_iterator;
+
+    roaring_bitmap() = default;
+    roaring_bitmap(std::initializer_list<std::uint32_t> values);
+
+    template <class InputIterator>
+    roaring_bitmap(InputIterator first, InputIterator last);
+
+    roaring_bitmap(const roaring_bitmap& other)            = default;
+    roaring_bitmap(roaring_bitmap&& other)                 noexcept = default;
+    roaring_bitmap& operator=(const roaring_bitmap& other) = default;
+    roaring_bitmap& operator=(roaring_bitmap&& other)      noexcept = default;
+    ~roaring_bitmap()                                      = default;
+
+    bool add(std::uint32_t value);
+    void add_range(std::uint32_t first, std::uint64_t last);
+    bool remove(std::uint32_t value);
+    void clear() noexcept;
+
+    bool          contains(std::uint32_t value) const noexcept;
+    std::uint64_t cardinality()                 const noexcept;
+    bool          empty()                       const noexcept;
+    std::size_t   memory_bytes()                const noexcept;
+
+    bool run_optimize();
+
+    roaring_bitmap& operator|=(const roaring_bitmap& other);
+    roaring_bitmap& operator&=(const roaring_bitmap& other);
+    roaring_bitmap& operator-=(const roaring_bitmap& other);
+
+    bool operator==(const roaring_bitmap& other) const;
+    bool operator!=(const roaring_bitmap& other) const;
+
+    const_iterator begin() const noexcept;
+    const_iterator end()   const noexcept;
+
+    std::size_t               serialized_bytes() const noexcept;
+    std::vector<std::uint8_t> serialize()        const;
+
+    static roaring_bitmap deserialize(const void* data, std::size_t size);
+
+ private:
+    friend class roaring_view;
+
+    /** Bytes in the serialized header */
+    static constexpr std::size_t header_bytes = 8;
+
+    /** Bytes per serialized directory entry */
+    static constexpr std::size_t entry_bytes = 16;
+
+    /** "JRB1", read as a little-endian integer */
+    static constexpr std::uint32_t magic = 0x3142524a;
+
+    template <typename Op>
+    void merge(const roaring_bitmap& other, Op op, bool keep_unmatched);
+
+    std::size_t find(std::uint16_t key) const noexcept;
+
+    /** The high 16 bits shared by each container's values, ascending */
+    std::vector<std::uint16_t> m_keys;
+
+    /** The containers, none of them empty */
+    std::vector<detail::roaring_container> m_containers;
+};
+
+/**
+ * Forward iterator over the values of a \ref roaring_bitmap, in ascending
+ * order
+ */
+class roaring_bitmap::const_iterator final {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::uint32_t;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const std::uint32_t*;
+    using reference         = std::uint32_t;
+
+    const_iterator() = default;
+
+    /**
+     * Constructor
+     *
+     * @param [in] owner     The bitmap to iterate over
+     * @param [in] container The container at which to start
+     */
+    const_iterator(const roaring_bitmap* owner, std::size_t container) noexcept
+        : m_owner(owner), m_container(container) {
+        enter();
+    }
+
+    /** @return The current value */
+    std::uint32_t operator*() const noexcept {
+        const auto& c = m_owner->m_containers[m_container];
+        const std::uint32_t high =
+            std::uint32_t(m_owner->m_keys[m_container]) << 16;
+
+        switch (c.type) {
+          case detail::container_type::array:
+            return high | c.values[m_pos];
+          case detail::container_type::bitmap:
+            return high | std::uint32_t(64 * m_pos + lsb(m_word));
+          case detail::container_type::run:
+          default:
+            return high | std::uint32_t(c.values[2 * m_pos] + m_offset);
+        }
+    }
+
+    /** Advance to the next value */
+    const_iterator& operator++() noexcept {
+        const auto& c = m_owner->m_containers[m_container];
+        bool done = false;
+
+        switch (c.type) {
+          case detail::container_type::array:
+            done = ++m_pos == c.values.size();
+            break;
+          case detail::container_type::bitmap:
+            m_word &= m_word - 1;
+            while (m_word == 0 && ++m_pos < detail::bitmap_words)
+                m_word = c.words[m_pos];
+            done = m_pos == detail::bitmap_words;
+            break;
+          case detail::container_type::run:
+          default:
+            if (m_offset < c.values[2 * m_pos + 1]) {
+                m_offset++;
+            } else {
+                m_offset = 0;
+                done = ++m_pos == c.num_runs();
+            }
+            break;
+        }
+
+        if (done) {
+            m_container++;
+            enter();
+        }
+
+        return *this;
+    }
+
+    /** Advance to the next value */
+    const_iterator operator++(int) noexcept {
+        const_iterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+        return m_container == other.m_container && m_pos == other.m_pos &&
+               m_word == other.m_word && m_offset == other.m_offset;
+    }
+
+    bool operator!=(const const_iterator& other) const noexcept {
+        return !(*this == other);
+    }
+
+ private:
+    /** Position at the first value of the current container, if any */
+    void enter() noexcept {
+        m_pos = 0; m_word = 0; m_offset = 0;
+
+        if (m_container >= m_owner->m_containers.size()) return;
+
+        const auto& c = m_owner->m_containers[m_container];
+        if (c.type == detail::container_type::bitmap) {
+            m_word = c.words[0];
+            while (m_word == 0) m_word = c.words[++m_pos];
+        }
+    }
+
+    /** The bitmap being iterated over */
+    const roaring_bitmap* m_owner = nullptr;
+
+    /** Index of the current container */
+    std::size_t m_container = 0;
+
+    /** Array index, word index or run index within the container */
+    std::size_t m_pos = 0;
+
+    /** Unvisited bits of the current bitmap word */
+    std::uint64_t m_word = 0;
+
+    /** Offset into the current run */
+    std::uint32_t m_offset = 0;
+};
+
+/**
+ * Constructor
+ *
+ * @param [in] values The initial values
+ */
+inline roaring_bitmap::roaring_bitmap(
+    std::initializer_list<std::uint32_t> values)
+    : roaring_bitmap(values.begin(), values.end()) {
+}
+
+/**
+ * Constructor
+ *
+ * @param [in] first Input iterator to the first value
+ * @param [in] last  Input iterator one past the final value
+ */
+template <class InputIterator>
+roaring_bitmap::roaring_bitmap(InputIterator first, InputIterator last) {
+    for (auto iter = first; iter != last; ++iter) add(*iter);
+}
+
+/**
+ * Insert a value
+ *
+ * @param [in] value The value to insert
+ *
+ * @return True if the value was not already present
+ */
+inline bool roaring_bitmap::add(std::uint32_t value) {
+    const auto key = static_cast<std::uint16_t>(value >> 16);
+    const auto iter = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    const std::size_t index = iter - m_keys.begin();
+
+    if (iter == m_keys.end() || *iter != key) {
+        m_keys.insert(iter, key);
+        m_containers.insert(m_containers.begin() + index,
+                            detail::roaring_container());
+    }
+
+    return m_containers[index].add(static_cast<std::uint16_t>(value));
+}
+
+/**
+ * Insert every value in a half-open range
+ *
+ * @param [in] first The first value to insert
+ * @param [in] last  One past the final value to insert, up to 2^32
+ */
+inline void roaring_bitmap::add_range(std::uint32_t first,
+                                      std::uint64_t last) {
+    last = std::min<std::uint64_t>(last, std::uint64_t(1) << 32);
+
+    std::uint64_t value = first;
+    while (value < last) {
+        const auto key = static_cast<std::uint16_t>(value >> 16);
+        const std::uint64_t chunk_end = std::min<std::uint64_t>(
+            (std::uint64_t(key) + 1) << 16, last);
+
+        detail::roaring_container range;
+        range.type = detail::container_type::run;
+        range.cardinality = static_cast<std::uint32_t>(chunk_end - value);
+        range.values = { static_cast<std::uint16_t>(value),
+                         static_cast<std::uint16_t>(chunk_end - value - 1) };
+
+        const auto iter = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+        const std::size_t index = iter - m_keys.begin();
+
+        if (iter == m_keys.end() || *iter != key) {
+            m_keys.insert(iter, key);
+            m_containers.insert(m_containers.begin() + index,
+                                std::move(range));
+        } else {
+            m_containers[index] =
+                detail::container_or(m_containers[index], range);
+        }
+
+        value = chunk_end;
+    }
+}
+
+/**
+ * Erase a value
+ *
+ * @param [in] value The value to erase
+ *
+ * @return True if the value was present
+ */
+inline bool roaring_bitmap::remove(std::uint32_t value) {
+    const std::size_t index = find(static_cast<std::uint16_t>(value >> 16));
+    if (index == npos) return false;
+
+    if (!m_containers[index].remove(static_cast<std::uint16_t>(value)))
+        return false;
+
+    if (m_containers[index].cardinality == 0) {
+        m_keys.erase(m_keys.begin() + index);
+        m_containers.erase(m_containers.begin() + index);
+    }
+
+    return true;
+}
+
+/**
+ * Erase every value
+ */
+inline void roaring_bitmap::clear() noexcept {
+    m_keys.clear();
+    m_containers.clear();
+}
+
+/**
+ * Check whether a value is present
+ *
+ * @param [in] value The value to look for
+ *
+ * @return True if present
+ */
+inline bool roaring_bitmap::contains(std::uint32_t value) const noexcept {
+    const std::size_t index = find(static_cast<std::uint16_t>(value >> 16));
+    return index != npos &&
+           m_containers[index].contains(static_cast<std::uint16_t>(value));
+}
+
+/**
+ * @return The number of values in the set
+ */
+inline std::uint64_t roaring_bitmap::cardinality() const noexcept {
+    std::uint64_t total = 0;
+    for (const auto& c : m_containers) total += c.cardinality;
+    return total;
+}
+
+/**
+ * @return True if the set has no values
+ */
+inline bool roaring_bitmap::empty() const noexcept {
+    return m_containers.empty();
+}
+
+/**
+ * @return The heap memory used by this bitmap, in bytes
+ */
+inline std::size_t roaring_bitmap::memory_bytes() const noexcept {
+    std::size_t total = m_keys.capacity() * sizeof(std::uint16_t) +
+        m_containers.capacity() * sizeof(detail::roaring_container);
+
+    for (const auto& c : m_containers) total += c.memory_bytes();
+
+    return total;
+}
+
+/**
+ * Convert every container to whichever of the array, bitmap and run formats
+ * takes the least space. Run containers are converted back automatically
+ * when modified
+ *
+ * @return True if any container now holds runs
+ */
+inline bool roaring_bitmap::run_optimize() {
+    bool any_runs = false;
+    for (auto& c : m_containers) any_runs |= c.optimize();
+    return any_runs;
+}
+
+/**
+ * In-place union
+ *
+ * @param [in] other The other set
+ *
+ * @return *this
+ */
+inline roaring_bitmap& roaring_bitmap::operator|=(const roaring_bitmap& other) {
+    merge(other, &detail::container_or, true);
+    return *this;
+}
+
+/**
+ * In-place intersection
+ *
+ * @param [in] other The other set
+ *
+ * @return *this
+ */
+inline roaring_bitmap& roaring_bitmap::operator&=(const roaring_bitmap& other) {
+    std::vector<std::uint16_t> keys;
+    std::vector<detail::roaring_container> containers;
+
+    std::size_t i = 0, j = 0;
+    while (i < m_keys.size() && j < other.m_keys.size()) {
+        if (m_keys[i] < other.m_keys[j]) {
+            i++;
+        } else if (other.m_keys[j] < m_keys[i]) {
+            j++;
+        } else {
+            auto c = detail::container_and(m_containers[i],
+                                           other.m_containers[j]);
+            if (c.cardinality != 0) {
+                keys.push_back(m_keys[i]);
+                containers.push_back(std::move(c));
+            }
+            i++; j++;
+        }
+    }
+
+    m_keys = std::move(keys);
+    m_containers = std::move(containers);
+    return *this;
+}
+
+/**
+ * In-place difference
+ *
+ * @param [in] other The values to remove
+ *
+ * @return *this
+ */
+inline roaring_bitmap& roaring_bitmap::operator-=(const roaring_bitmap& other) {
+    merge(other, &detail::container_andnot, false);
+    return *this;
+}
+
+/**
+ * @return True if both sets hold the same values
+ */
+inline bool roaring_bitmap::operator==(const roaring_bitmap& other) const {
+    if (m_keys != other.m_keys) return false;
+
+    for (std::size_t i = 0; i < m_containers.size(); i++) {
+        if (m_containers[i].cardinality != other.m_containers[i].cardinality)
+            return false;
+    }
+
+    return std::equal(begin(), end(), other.begin());
+}
+
+/**
+ * @return True if the sets differ
+ */
+inline bool roaring_bitmap::operator!=(const roaring_bitmap& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @return An iterator to the smallest value
+ */
+inline roaring_bitmap::const_iterator roaring_bitmap::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+/**
+ * @return An iterator one past the largest value
+ */
+inline roaring_bitmap::const_iterator roaring_bitmap::end() const noexcept {
+    return const_iterator(this, m_containers.size());
+}
+
+/**
+ * @return The size of the output of \ref serialize(), in bytes
+ */
+inline std::size_t roaring_bitmap::serialized_bytes() const noexcept {
+    std::size_t size = header_bytes + entry_bytes * m_containers.size();
+
+    for (const auto& c : m_containers) {
+        size = (size + 7) & ~std::size_t(7);
+        size += c.type == detail::container_type::bitmap ?
+                    8 * c.words.size() : 2 * c.values.size();
+    }
+
+    return size;
+}
+
+/**
+ * Write this set in its portable serialized form
+ *
+ * @return The serialized bytes
+ */
+inline std::vector<std::uint8_t> roaring_bitmap::serialize() const {
+    std::vector<std::uint8_t> out(serialized_bytes(), 0);
+    std::uint8_t* const base = out.data();
+
+    detail::store_le<std::uint32_t>(magic, base);
+    detail::store_le<std::uint32_t>(
+        static_cast<std::uint32_t>(m_containers.size()), base + 4);
+
+    std::size_t offset = header_bytes + entry_bytes * m_containers.size();
+
+    for (std::size_t i = 0; i < m_containers.size(); i++) {
+        const auto& c = m_containers[i];
+        std::uint8_t* const entry = base + header_bytes + entry_bytes * i;
+
+        offset = (offset + 7) & ~std::size_t(7);
+
+        std::size_t count = 0;
+        if (c.type == detail::container_type::bitmap) {
+            count = c.words.size();
+            for (std::size_t w = 0; w < count; w++)
+                detail::store_le(c.words[w], base + offset + 8 * w);
+        } else {
+            count = c.type == detail::container_type::run ?
+                        c.num_runs() : c.values.size();
+            for (std::size_t v = 0; v < c.values.size(); v++)
+                detail::store_le(c.values[v], base + offset + 2 * v);
+        }
+
+        detail::store_le<std::uint16_t>(m_keys[i], entry);
+        detail::store_le<std::uint16_t>(
+            static_cast<std::uint16_t>(c.type), entry + 2);
+        detail::store_le<std::uint32_t>(c.cardinality, entry + 4);
+        detail::store_le<std::uint32_t>(
+            static_cast<std::uint32_t>(count), entry + 8);
+        detail::store_le<std::uint32_t>(
+            static_cast<std::uint32_t>(offset), entry + 12);
+
+        offset += c.type == detail::container_type::bitmap ?
+                      8 * count : 2 * c.values.size();
+    }
+
+    return out;
+}
+
+/**
+ * Apply a container operation against every container of another set
+ *
+ * @param [in] other          The other set
+ * @param [in] op             Combines a pair of containers with equal keys
+ * @param [in] keep_unmatched If true, containers found only in \a other are
+ *                            copied into this set
+ */
+template <typename Op>
+void roaring_bitmap::merge(const roaring_bitmap& other, Op op,
+                           bool keep_unmatched) {
+    std::vector<std::uint16_t> keys;
+    std::vector<detail::roaring_container> containers;
+
+    keys.reserve(m_keys.size() + (keep_unmatched ? other.m_keys.size() : 0));
+    containers.reserve(keys.capacity());
+
+    std::size_t i = 0, j = 0;
+    while (i < m_keys.size() || j < other.m_keys.size()) {
+        if (j == other.m_keys.size() ||
+            (i < m_keys.size() && m_keys[i] < other.m_keys[j])) {
+            keys.push_back(m_keys[i]);
+            containers.push_back(std::move(m_containers[i++]));
+        } else if (i == m_keys.size() || other.m_keys[j] < m_keys[i]) {
+            if (keep_unmatched) {
+                keys.push_back(other.m_keys[j]);
+                containers.push_back(other.m_containers[j]);
+            }
+            j++;
+        } else {
+            auto c = op(m_containers[i], other.m_containers[j]);
+            if (c.cardinality != 0) {
+                keys.push_back(m_keys[i]);
+                containers.push_back(std::move(c));
+            }
+            i++; j++;
+        }
+    }
+
+    m_keys = std::move(keys);
+    m_containers = std::move(containers);
+}
+
+/**
+ * Find the container for a key
+ *
+ * @param [in] key The high 16 bits of a value
+ *
+ * @return The container index, or \ref npos if there is none
+ */
+inline std::size_t roaring_bitmap::find(std::uint16_t key) const noexcept {
+    const auto iter = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    if (iter == m_keys.end() || *iter != key) return npos;
+    return iter - m_keys.begin();
+}
+
+/**
+ * Union of two sets
+ */
+inline roaring_bitmap operator|(roaring_bitmap lhs, const roaring_bitmap& rhs) {
+    return lhs |= rhs;
+}
+
+/**
+ * Intersection of two sets
+ */
+inline roaring_bitmap operator&(roaring_bitmap lhs, const roaring_bitmap& rhs) {
+    return lhs &= rhs;
+}
+
+/**
+ * Difference of two sets
+ */
+inline roaring_bitmap operator-(roaring_bitmap lhs, const roaring_bitmap& rhs) {
+    return lhs -= rhs;
+}
+
+/**
+ * Read-only access to a serialized \ref roaring_bitmap, e.g. one in a
+ * memory-mapped file, without copying or decoding it up front. The buffer
+ * must outlive the view
+ */
+class roaring_view final {
+ public:
+    roaring_view(const void* data, std::size_t size);
+
+    bool          contains(std::uint32_t value) const noexcept;
+    std::uint64_t cardinality()                 const noexcept;
+    std::size_t   num_containers()              const noexcept;
+
+    template <typename F>
+    void for_each(F&& visit) const;
+
+    roaring_bitmap materialize() const;
+
+ private:
+    /** A decoded directory entry */
+    struct entry {
+        std::uint16_t          key;
+        detail::container_type type;
+        std::uint32_t          cardinality;
+        std::uint32_t          count;
+        const std::uint8_t*    payload;
+    };
+
+    entry get_entry(std::size_t index) const noexcept;
+
+    /** The serialized bytes */
+    const std::uint8_t* m_data;
+
+    /** The number of containers */
+    std::size_t m_count;
+};
+
+/**
+ * Constructor. Validates the directory so that later queries can trust it
+ *
+ * @param [in] data The serialized bytes
+ * @param [in] size The number of bytes
+ *
+ * @throws std::invalid_argument if the data is not a valid serialized bitmap
+ */
+inline roaring_view::roaring_view(const void* data, std::size_t size)
+    : m_data(static_cast<const std::uint8_t*>(data)), m_count(0) {
+    constexpr std::size_t header = roaring_bitmap::header_bytes;
+    constexpr std::size_t stride = roaring_bitmap::entry_bytes;
+
+    if (size < header ||
+        detail::load_le<std::uint32_t>(m_data) != roaring_bitmap::magic) {
+        throw std::invalid_argument("not a serialized roaring_bitmap");
+    }
+
+    m_count = detail::load_le<std::uint32_t>(m_data + 4);
+    if (m_count > (size - header) / stride)
+        throw std::invalid_argument("truncated roaring_bitmap directory");
+
+    for (std::size_t i = 0; i < m_count; i++) {
+        const std::uint8_t* raw = m_data + header + stride * i;
+
+        const auto key    = detail::load_le<std::uint16_t>(raw);
+        const auto type   = detail::load_le<std::uint16_t>(raw + 2);
+        const auto card   = detail::load_le<std::uint32_t>(raw + 4);
+        const auto count  = detail::load_le<std::uint32_t>(raw + 8);
+        const auto offset = detail::load_le<std::uint32_t>(raw + 12);
+
+        std::size_t bytes = 0;
+        switch (static_cast<detail::container_type>(type)) {
+          case detail::container_type::array:
+            bytes = 2 * std::size_t(count);
+            break;
+          case detail::container_type::bitmap:
+            bytes = 8 * std::size_t(count);
+            if (count != detail::bitmap_words)
+                throw std::invalid_argument("bad roaring_bitmap container");
+            break;
+          case detail::container_type::run:
+            bytes = 4 * std::size_t(count);
+            break;
+          default:
+            throw std::invalid_argument("bad roaring_bitmap container");
+        }
+
+        if (card == 0 || card > 65536 || offset > size ||
+            bytes > size - offset ||
+            (i > 0 && key <= detail::load_le<std::uint16_t>(raw - stride))) {
+            throw std::invalid_argument("bad roaring_bitmap container");
+        }
+    }
+}
+
+/**
+ * Check whether a value is present
+ *
+ * @param [in] value The value to look for
+ *
+ * @return True if present
+ */
+inline bool roaring_view::contains(std::uint32_t value) const noexcept {
+    const auto key = static_cast<std::uint16_t>(value >> 16);
+    const auto low = static_cast<std::uint16_t>(value);
+
+    std::size_t lo = 0, hi = m_count;
+    while (lo < hi) {
+        const std::size_t mid = (lo + hi) / 2;
+        if (get_entry(mid).key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo == m_count) return false;
+
+    const entry e = get_entry(lo);
+    if (e.key != key) return false;
+
+    switch (e.type) {
+      case detail::container_type::bitmap:
+        return (detail::load_le<std::uint64_t>(e.payload + 8 * (low >> 6))
+                    >> (low & 63)) & 1;
+      case detail::container_type::array: {
+        std::size_t first = 0, last = e.count;
+        while (first < last) {
+            const std::size_t mid = (first + last) / 2;
+            if (detail::load_le<std::uint16_t>(e.payload + 2 * mid) < low)
+                first = mid + 1;
+            else
+                last = mid;
+        }
+        return first < e.count &&
+               detail::load_le<std::uint16_t>(e.payload + 2 * first) == low;
+      }
+      case detail::container_type::run:
+      default: {
+        std::size_t first = 0, last = e.count;
+        while (first < last) {
+            const std::size_t mid = (first + last) / 2;
+            if (detail::load_le<std::uint16_t>(e.payload + 4 * mid) <= low)
+                first = mid + 1;
+            else
+                last = mid;
+        }
+        if (first == 0) return false;
+
+        const std::uint8_t* run = e.payload + 4 * (first - 1);
+        return std::uint32_t(low - detail::load_le<std::uint16_t>(run)) <=
+               detail::load_le<std::uint16_t>(run + 2);
+      }
+    }
+}
+
+/**
+ * @return The number of values in the set
+ */
+inline std::uint64_t roaring_view::cardinality() const noexcept {
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < m_count; i++) total += get_entry(i).cardinality;
+    return total;
+}
+
+/**
+ * @return The number of containers
+ */
+inline std::size_t roaring_view::num_containers() const noexcept {
+    return m_count;
+}
+
+/**
+ * Call a function on every value, in ascending order
+ *
+ * @param [in] visit Called with each std::uint32_t value
+ */
+template <typename F>
+void roaring_view::for_each(F&& visit) const {
+    for (std::size_t i = 0; i < m_count; i++) {
+        const entry e = get_entry(i);
+        const std::uint32_t high = std::uint32_t(e.key) << 16;
+
+        switch (e.type) {
+          case detail::container_type::array:
+            for (std::size_t v = 0; v < e.count; v++)
+                visit(high | detail::load_le<std::uint16_t>(e.payload + 2 * v));
+            break;
+          case detail::container_type::bitmap:
+            for (std::size_t w = 0; w < e.count; w++) {
+                const auto word =
+                    detail::load_le<std::uint64_t>(e.payload + 8 * w);
+                for (int bit : set_bits(word))
+                    visit(high | std::uint32_t(64 * w + bit));
+            }
+            break;
+          case detail::container_type::run:
+          default:
+            for (std::size_t r = 0; r < e.count; r++) {
+                const std::uint32_t start =
+                    detail::load_le<std::uint16_t>(e.payload + 4 * r);
+                const std::uint32_t length =
+                    detail::load_le<std::uint16_t>(e.payload + 4 * r + 2);
+                for (std::uint32_t v = start; v <= start + length; v++)
+                    visit(high | v);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Decode the serialized data into a \ref roaring_bitmap
+ *
+ * @return The bitmap
+ */
+inline roaring_bitmap roaring_view::materialize() const {
+    roaring_bitmap result;
+    result.m_keys.reserve(m_count);
+    result.m_containers.resize(m_count);
+
+    for (std::size_t i = 0; i < m_count; i++) {
+        const entry e = get_entry(i);
+        auto& c = result.m_containers[i];
+
+        result.m_keys.push_back(e.key);
+        c.type = e.type;
+        c.cardinality = e.cardinality;
+
+        if (e.type == detail::container_type::bitmap) {
+            c.words.resize(e.count);
+            for (std::size_t w = 0; w < e.count; w++) {
+                c.words[w] = detail::load_le<std::uint64_t>(e.payload + 8 * w);
+            }
+        } else {
+            const std::size_t n =
+                e.type == detail::container_type::run ? 2 * e.count : e.count;
+            c.values.resize(n);
+            for (std::size_t v = 0; v < n; v++) {
+                c.values[v] = detail::load_le<std::uint16_t>(e.payload + 2 * v);
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Decode a directory entry
+ *
+ * @param [in] index The container index
+ *
+ * @return The entry
+ */
+inline roaring_view::entry roaring_view::get_entry(std::size_t index) const
+    noexcept {
+    const std::uint8_t* raw = m_data + roaring_bitmap::header_bytes +
+                              roaring_bitmap::entry_bytes * index;
+    entry e;
+    e.key         = detail::load_le<std::uint16_t>(raw);
+    e.type        = static_cast<detail::container_type>(
+                        detail::load_le<std::uint16_t>(raw + 2));
+    e.cardinality = detail::load_le<std::uint32_t>(raw + 4);
+    e.count       = detail::load_le<std::uint32_t>(raw + 8);
+    e.payload     = m_data + detail::load_le<std::uint32_t>(raw + 12);
+    return e;
+}
+
+/**
+ * Read a set from its serialized form
+ *
+ * @param [in] data The serialized bytes
+ * @param [in] size The number of bytes
+ *
+ * @return The set
+ *
+ * @throws std::invalid_argument if the data is not a valid serialized bitmap
+ */
+inline roaring_bitmap roaring_bitmap::deserialize(const void* data,
+                                                  std::size_t size) {
+    return roaring_view(data, size).materialize();
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_ROARING_H_
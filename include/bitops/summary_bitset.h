@@ -0,0 +1,331 @@
+/**
+ *  \file   summary_bitset.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_BITOPS_SUMMARY_BITSET_H_
+#define UTILITY_INCLUDE_BITOPS_SUMMARY_BITSET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bitops/bitops.h"
+#include "bitops/bitvector.h"
+
+namespace jfern {
+namespace bitops {
+
+/**
+ * A fixed-size set of bits with a tree of summary levels above it. Bit i of
+ * a summary word is set whenever word i of the level below is nonzero, and
+ * levels are added until one word summarizes everything
+ *
+ * Searching for the next or previous set bit costs one lsb()/msb() per level
+ * on the way up and again on the way down, i.e. O(log64 n), regardless of how
+ * sparse the set is. A million bits need four levels. Single-bit updates
+ * touch the levels above only when a word becomes empty or nonempty
+ */
+class summary_bitset final {
+ public:
+    summary_bitset() : summary_bitset(0) {}
+    explicit summary_bitset(std::size_t size);
+    explicit summary_bitset(const bitvector& bits);
+
+    summary_bitset(const summary_bitset& other)            = default;
+    summary_bitset(summary_bitset&& other)                 noexcept = default;
+    summary_bitset& operator=(const summary_bitset& other) = default;
+    summary_bitset& operator=(summary_bitset&& other)      noexcept = default;
+    ~summary_bitset()                                      = default;
+
+    bool insert(std::size_t index) noexcept;
+    bool erase(std::size_t index)  noexcept;
+    void clear() noexcept;
+
+    bool contains(std::size_t index) const noexcept;
+
+    std::size_t count() const noexcept;
+    bool        empty() const noexcept;
+    std::size_t size()  const noexcept;
+    std::size_t depth() const noexcept;
+
+    std::size_t find_first() const noexcept;
+    std::size_t find_next(std::size_t index) const noexcept;
+    std::size_t find_last()  const noexcept;
+    std::size_t find_prev(std::size_t index) const noexcept;
+
+ private:
+    std::size_t successor(std::size_t index)   const noexcept;
+    std::size_t predecessor(std::size_t index) const noexcept;
+
+    /** Level 0 holds the bits, and each level after summarizes the last */
+    std::vector<std::vector<std::uint64_t>> m_levels;
+
+    /** The number of bits */
+    std::size_t m_size;
+
+    /** The number of bits set */
+    std::size_t m_count;
+};
+
+/**
+ * Constructor. All bits start clear
+ *
+ * @param [in] size The number of bits
+ */
+inline summary_bitset::summary_bitset(std::size_t size)
+    : m_levels(), m_size(size), m_count(0) {
+    std::size_t words = (size + 63) / 64;
+    m_levels.emplace_back(words, 0);
+
+    while (words > 1) {
+        words = (words + 63) / 64;
+        m_levels.emplace_back(words, 0);
+    }
+}
+
+/**
+ * Constructor. Copies the bits of a \ref bitvector and builds the summaries
+ * in a single pass per level
+ *
+ * @param [in] bits The bits to copy
+ */
+inline summary_bitset::summary_bitset(const bitvector& bits)
+    : summary_bitset(bits.size()) {
+    m_levels[0].assign(bits.data(), bits.data() + bits.num_words());
+    m_count = bits.count();
+
+    for (std::size_t level = 1; level < m_levels.size(); level++) {
+        const std::vector<std::uint64_t>& below = m_levels[level - 1];
+        for (std::size_t i = 0; i < below.size(); i++) {
+            if (below[i])
+                m_levels[level][i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+    }
+}
+
+/**
+ * Set a bit
+ *
+ * @param [in] index The bit to set. Must be less than size()
+ *
+ * @return True if the bit was previously clear
+ */
+inline bool summary_bitset::insert(std::size_t index) noexcept {
+    std::uint64_t& word = m_levels[0][index / 64];
+    const std::uint64_t bit = std::uint64_t(1) << (index % 64);
+
+    if (word & bit) return false;
+
+    bool was_empty = word == 0;
+    word |= bit;
+    m_count++;
+
+    for (std::size_t level = 1; was_empty && level < m_levels.size();
+         level++) {
+        index /= 64;
+        std::uint64_t& summary = m_levels[level][index / 64];
+        was_empty = summary == 0;
+        summary |= std::uint64_t(1) << (index % 64);
+    }
+
+    return true;
+}
+
+/**
+ * Clear a bit
+ *
+ * @param [in] index The bit to clear. Must be less than size()
+ *
+ * @return True if the bit was previously set
+ */
+inline bool summary_bitset::erase(std::size_t index) noexcept {
+    std::uint64_t& word = m_levels[0][index / 64];
+    const std::uint64_t bit = std::uint64_t(1) << (index % 64);
+
+    if (!(word & bit)) return false;
+
+    word &= ~bit;
+    m_count--;
+
+    bool now_empty = word == 0;
+    for (std::size_t level = 1; now_empty && level < m_levels.size();
+         level++) {
+        index /= 64;
+        std::uint64_t& summary = m_levels[level][index / 64];
+        summary &= ~(std::uint64_t(1) << (index % 64));
+        now_empty = summary == 0;
+    }
+
+    return true;
+}
+
+/**
+ * Clear all bits
+ */
+inline void summary_bitset::clear() noexcept {
+    for (auto& level : m_levels)
+        std::fill(level.begin(), level.end(), 0);
+    m_count = 0;
+}
+
+/**
+ * Check whether a bit is set
+ *
+ * @param [in] index The bit to check. Must be less than size()
+ *
+ * @return True if set
+ */
+inline bool summary_bitset::contains(std::size_t index) const noexcept {
+    return (m_levels[0][index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * @return The number of bits set
+ */
+inline std::size_t summary_bitset::count() const noexcept {
+    return m_count;
+}
+
+/**
+ * @return True if no bits are set
+ */
+inline bool summary_bitset::empty() const noexcept {
+    return m_count == 0;
+}
+
+/**
+ * @return The number of bits
+ */
+inline std::size_t summary_bitset::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The number of levels, including the bits themselves
+ */
+inline std::size_t summary_bitset::depth() const noexcept {
+    return m_levels.size();
+}
+
+/**
+ * Find the lowest index whose bit is set
+ *
+ * @return The index, or \ref npos if no bits are set
+ */
+inline std::size_t summary_bitset::find_first() const noexcept {
+    return m_size == 0 ? npos : successor(0);
+}
+
+/**
+ * Find the lowest index above \a index whose bit is set
+ *
+ * @param [in] index Begin the search just past this index
+ *
+ * @return The index, or \ref npos if there is none
+ */
+inline std::size_t summary_bitset::find_next(std::size_t index) const
+    noexcept {
+    if (index == npos || ++index >= m_size) return npos;
+    return successor(index);
+}
+
+/**
+ * Find the highest index whose bit is set
+ *
+ * @return The index, or \ref npos if no bits are set
+ */
+inline std::size_t summary_bitset::find_last() const noexcept {
+    return m_size == 0 ? npos : predecessor(m_size - 1);
+}
+
+/**
+ * Find the highest index below \a index whose bit is set
+ *
+ * @param [in] index Begin the search just before this index. Values past
+ *                   size() search the whole set
+ *
+ * @return The index, or \ref npos if there is none
+ */
+inline std::size_t summary_bitset::find_prev(std::size_t index) const
+    noexcept {
+    if (index == 0 || m_size == 0) return npos;
+    return predecessor(index > m_size ? m_size - 1 : index - 1);
+}
+
+/**
+ * @return The lowest set index at or above \a index, which must be less than
+ *         size(), or \ref npos if there is none
+ */
+inline std::size_t summary_bitset::successor(std::size_t index) const
+    noexcept {
+    std::size_t level = 0;
+
+    /* Climb until some word has a set bit at or after the position */
+    for (;; level++) {
+        if (level == m_levels.size()) return npos;
+
+        const std::vector<std::uint64_t>& words = m_levels[level];
+        const std::size_t w = index / 64;
+        if (w >= words.size()) return npos;
+
+        const std::uint64_t word = words[w] & (~std::uint64_t(0) <<
+                                               (index % 64));
+        if (word) {
+            index = 64 * w + lsb(word);
+            break;
+        }
+
+        index = w + 1;
+    }
+
+    /* Descend along the lowest set bits */
+    while (level-- > 0)
+        index = 64 * index + lsb(m_levels[level][index]);
+
+    return index;
+}
+
+/**
+ * @return The highest set index at or below \a index, which must be less than
+ *         size(), or \ref npos if there is none
+ */
+inline std::size_t summary_bitset::predecessor(std::size_t index) const
+    noexcept {
+    std::size_t level = 0;
+
+    /* Climb until some word has a set bit at or before the position */
+    for (;; level++) {
+        if (level == m_levels.size()) return npos;
+
+        const std::size_t w = index / 64;
+        const std::size_t b = index % 64;
+
+        const std::uint64_t word = m_levels[level][w] &
+            (b == 63 ? ~std::uint64_t(0) : (std::uint64_t(2) << b) - 1);
+        if (word) {
+            index = 64 * w + msb(word);
+            break;
+        }
+
+        if (w == 0) return npos;
+        index = w - 1;
+    }
+
+    /* Descend along the highest set bits */
+    while (level-- > 0)
+        index = 64 * index + msb(m_levels[level][index]);
+
+    return index;
+}
+
+}  // namespace bitops
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_BITOPS_SUMMARY_BITSET_H_
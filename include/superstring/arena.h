@@ -0,0 +1,222 @@
+/**
+ *  \file   arena.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_ARENA_H_
+#define UTILITY_INCLUDE_SUPERSTRING_ARENA_H_
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace jfern {
+
+/**
+ * A bump allocator. Memory is carved out of large blocks by advancing a
+ * pointer, and everything is given back at once by \ref release() or the
+ * destructor, so that the strings produced while serving one request cost a
+ * handful of calls into the global heap rather than one per string
+ *
+ * An arena is not thread-safe. Give each thread (or each request) its own
+ */
+class arena final {
+ public:
+    /** The size of each block obtained from the global heap by default */
+    static constexpr std::size_t default_block_size = 64 * 1024;
+
+    explicit arena(std::size_t block_size = default_block_size);
+
+    arena(const arena& other)            = delete;
+    arena(arena&& other)                 = delete;
+    arena& operator=(const arena& other) = delete;
+    arena& operator=(arena&& other)      = delete;
+    ~arena();
+
+    void* allocate(std::size_t size, std::size_t alignment);
+    void  deallocate(void* ptr, std::size_t size) noexcept;
+    void  release() noexcept;
+
+    std::size_t blocks()         const noexcept;
+    std::size_t bytes_used()     const noexcept;
+    std::size_t bytes_reserved() const noexcept;
+
+ private:
+    /** Header placed at the start of every block */
+    struct block {
+        /** The previously allocated block */
+        block* next;
+
+        /** The total size of this block, header included */
+        std::size_t size;
+    };
+
+    void grow(std::size_t size, std::size_t alignment);
+
+    /** The block currently being carved up */
+    block* m_head;
+
+    /** The next free byte in \ref m_head */
+    char* m_cursor;
+
+    /** One past the last byte in \ref m_head */
+    char* m_end;
+
+    /** The size of each new block */
+    std::size_t m_block_size;
+
+    /** The number of blocks held */
+    std::size_t m_blocks;
+
+    /** Bytes handed out since the last release */
+    std::size_t m_used;
+
+    /** The total size of the blocks held */
+    std::size_t m_reserved;
+};
+
+/**
+ * A standard allocator that draws from an \ref arena. Deallocation is a no-op
+ * except for the most recent allocation, which a growing string or vector
+ * gives back right away; everything else is reclaimed when the arena is
+ * released
+ *
+ * @tparam T The type of object to allocate
+ */
+template <class T>
+class arena_allocator {
+ public:
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    explicit arena_allocator(arena* source) noexcept;
+
+    template <class U>
+    arena_allocator(const arena_allocator<U>& other) noexcept;  // NOLINT
+
+    T*   allocate(std::size_t n);
+    void deallocate(T* ptr, std::size_t n) noexcept;
+
+    arena* source() const noexcept;
+
+ private:
+    /** Where the memory comes from */
+    arena* m_source;
+};
+
+template <class T, class U>
+bool operator==(const arena_allocator<T>& a,
+                const arena_allocator<U>& b) noexcept;
+template <class T, class U>
+bool operator!=(const arena_allocator<T>& a,
+                const arena_allocator<U>& b) noexcept;
+
+/**
+ * @return The number of blocks held
+ */
+inline std::size_t arena::blocks() const noexcept {
+    return m_blocks;
+}
+
+/**
+ * @return The number of bytes handed out since the last release, including
+ *         alignment padding but not blocks' unused space
+ */
+inline std::size_t arena::bytes_used() const noexcept {
+    return m_used;
+}
+
+/**
+ * @return The total size of the blocks held
+ */
+inline std::size_t arena::bytes_reserved() const noexcept {
+    return m_reserved;
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] source The arena to allocate from. Must outlive this allocator
+ *                   and every copy of it
+ */
+template <class T>
+arena_allocator<T>::arena_allocator(arena* source) noexcept
+    : m_source(source) {
+}
+
+/**
+ * Converting constructor, used by containers to rebind the allocator to
+ * their internal node types
+ *
+ * @param[in] other An allocator for a different type
+ */
+template <class T> template <class U>
+arena_allocator<T>::arena_allocator(const arena_allocator<U>& other) noexcept
+    : m_source(other.source()) {
+}
+
+/**
+ * Allocate storage
+ *
+ * @param[in] n The number of objects to make room for
+ *
+ * @return The (uninitialized) storage
+ */
+template <class T>
+T* arena_allocator<T>::allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        throw std::bad_alloc();
+
+    return static_cast<T*>(m_source->allocate(n * sizeof(T), alignof(T)));
+}
+
+/**
+ * Deallocate storage
+ *
+ * @param[in] ptr Storage obtained from \ref allocate()
+ * @param[in] n   The number of objects it was allocated for
+ */
+template <class T>
+void arena_allocator<T>::deallocate(T* ptr, std::size_t n) noexcept {
+    m_source->deallocate(ptr, n * sizeof(T));
+}
+
+/**
+ * @return The arena this allocator draws from
+ */
+template <class T>
+arena* arena_allocator<T>::source() const noexcept {
+    return m_source;
+}
+
+/**
+ * @return True if \a a and \a b draw from the same arena, in which case
+ *         memory allocated by one can be deallocated by the other
+ */
+template <class T, class U>
+bool operator==(const arena_allocator<T>& a,
+                const arena_allocator<U>& b) noexcept {
+    return a.source() == b.source();
+}
+
+/**
+ * @return True if \a a and \a b draw from different arenas
+ */
+template <class T, class U>
+bool operator!=(const arena_allocator<T>& a,
+                const arena_allocator<U>& b) noexcept {
+    return !(a == b);
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_ARENA_H_
@@ -0,0 +1,32 @@
+/**
+ *  \file   case_map.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_CASE_MAP_H_
+#define UTILITY_INCLUDE_SUPERSTRING_CASE_MAP_H_
+
+#include <cstddef>
+
+namespace jfern {
+namespace case_map {
+
+/*
+ * In-place case conversion. Runs of ASCII are mapped a vector at a time with
+ * the kernels selected by search::active_level(); only a block that holds a
+ * byte above 0x7f goes through the locale-aware std::tolower/std::toupper.
+ * ASCII letters are always mapped as in the "C" locale
+ */
+
+void lower(char* data, std::size_t size) noexcept;
+void upper(char* data, std::size_t size) noexcept;
+
+}  // namespace case_map
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_CASE_MAP_H_
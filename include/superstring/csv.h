@@ -0,0 +1,259 @@
+/**
+ *  \file   csv.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_CSV_H_
+#define UTILITY_INCLUDE_SUPERSTRING_CSV_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/**
+ * One field of a CSV record, viewed in place. A quoted field is viewed
+ * without its enclosing quotes; if it contains escaped (doubled) quotes, they
+ * are still doubled in view(), and str() undoes them
+ */
+class csv_field final {
+ public:
+    csv_field() noexcept;
+    csv_field(superstring_view text, char quote) noexcept;
+
+    csv_field(const csv_field& other)            = default;
+    csv_field(csv_field&& other)                 noexcept = default;
+    csv_field& operator=(const csv_field& other) = default;
+    csv_field& operator=(csv_field&& other)      noexcept = default;
+    ~csv_field()                                 = default;
+
+    bool             escaped() const noexcept;
+    std::string      str()     const;
+    superstring_view view()    const noexcept;
+
+ private:
+    /** The field's characters, without enclosing quotes */
+    superstring_view m_text;
+
+    /** The quote character if the field has escaped quotes, or '\0' */
+    char m_quote;
+};
+
+/**
+ * The fields of one CSV record. A record is a view: its fields belong to the
+ * \ref csv_reader that produced it
+ */
+class csv_record final {
+ public:
+    using iterator = const csv_field*;
+
+    csv_record() noexcept;
+    csv_record(const csv_field* fields, std::size_t size) noexcept;
+
+    csv_record(const csv_record& other)            = default;
+    csv_record(csv_record&& other)                 noexcept = default;
+    csv_record& operator=(const csv_record& other) = default;
+    csv_record& operator=(csv_record&& other)      noexcept = default;
+    ~csv_record()                                  = default;
+
+    const csv_field& operator[](std::size_t index) const noexcept;
+    const csv_field& at(std::size_t index) const;
+
+    iterator begin() const noexcept;
+    iterator end()   const noexcept;
+
+    bool        empty() const noexcept;
+    std::size_t size()  const noexcept;
+
+ private:
+    /** The first field */
+    const csv_field* m_fields;
+
+    /** The number of fields */
+    std::size_t m_size;
+};
+
+/**
+ * Reads RFC 4180 records: fields are separated by a delimiter, records end
+ * at "\n" or "\r\n", and a field in quotes may contain delimiters, line
+ * breaks and doubled quotes. Passing '\0' as the quote character turns
+ * quoting off, as most TSV files need
+ *
+ * Input is indexed ahead of parsing, a window at a time. For each block of 64
+ * bytes, vector compares (see search.h for how the instruction set is picked)
+ * produce bitmasks of quotes, delimiters and newlines. The prefix XOR of the
+ * quote mask, computed with a carry-less multiply where the CPU has one,
+ * covers everything inside quotes, and the delimiters and newlines left over
+ * are written to the index. Parsing then just walks the index, looking only
+ * at the bytes around each separator
+ *
+ * Fields are views into the input, or, when reading from a stream, into the
+ * reader's buffer. The buffer holds at least one whole record, and grows if
+ * a record does not fit. Either way, a record is valid until the next call to
+ * next()
+ */
+class csv_reader final {
+ public:
+    explicit csv_reader(superstring_view text, char delimiter = ',',
+                        char quote = '"');
+    explicit csv_reader(std::istream& stream, char delimiter = ',',
+                        char quote = '"',
+                        std::size_t buffer_size = default_buffer_size);
+
+    csv_reader(const csv_reader& other)            = delete;
+    csv_reader(csv_reader&& other)                 noexcept = default;
+    csv_reader& operator=(const csv_reader& other) = delete;
+    csv_reader& operator=(csv_reader&& other)      noexcept = default;
+    ~csv_reader()                                  = default;
+
+    bool next(csv_record* record);
+
+    std::size_t records() const noexcept;
+
+    /** The initial size of the buffer a stream is read into */
+    static constexpr std::size_t default_buffer_size = 1024 * 1024;
+
+    /** The number of bytes indexed at a time */
+    static constexpr std::size_t window_size = 64 * 1024;
+
+ private:
+    csv_reader(char delimiter, char quote);
+
+    void index_window();
+    bool refill();
+
+    /** The stream to read from, or null if reading from memory */
+    std::istream* m_stream;
+
+    /** The buffer the stream is read into */
+    std::unique_ptr<char[]> m_buffer;
+
+    /** The size of \ref m_buffer */
+    std::size_t m_capacity;
+
+    /** True once the stream has been read to the end */
+    bool m_eof;
+
+    /** The input: the text passed in, or the contents of \ref m_buffer */
+    const char* m_data;
+
+    /** The size of the input */
+    std::size_t m_size;
+
+    /** The offset of the first byte not yet indexed */
+    std::size_t m_indexed;
+
+    /** All ones if the byte before \ref m_indexed is inside quotes */
+    std::uint64_t m_inside;
+
+    /** The offset of the window last indexed */
+    std::size_t m_window;
+
+    /**
+     * The offsets of the delimiters and newlines outside quotes, relative
+     * to \ref m_window
+     */
+    std::unique_ptr<std::uint32_t[]> m_index;
+
+    /** The number of offsets in \ref m_index */
+    std::size_t m_index_size;
+
+    /** The next offset in \ref m_index to parse */
+    std::size_t m_next;
+
+    /** The offset of the next record */
+    std::size_t m_start;
+
+    /**
+     * Storage for the fields of the record last returned. It only grows, so
+     * that fields can be written without checking for room one at a time
+     */
+    std::vector<csv_field> m_fields;
+
+    /** The number of records returned */
+    std::size_t m_records;
+
+    /** The field delimiter */
+    char m_delimiter;
+
+    /** The quote character, or '\0' */
+    char m_quote;
+};
+
+/**
+ * @return True if the field contains escaped quotes, in which case view()
+ *         differs from str()
+ */
+inline bool csv_field::escaped() const noexcept {
+    return m_quote != '\0';
+}
+
+/**
+ * @return The field's characters as they appear in the input, without any
+ *         enclosing quotes
+ */
+inline superstring_view csv_field::view() const noexcept {
+    return m_text;
+}
+
+/**
+ * Get a field
+ *
+ * @param[in] index The index of the field, which must be less than size()
+ *
+ * @return The field
+ */
+inline const csv_field& csv_record::operator[](std::size_t index) const
+    noexcept {
+    return m_fields[index];
+}
+
+/**
+ * Get a field, with bounds checking
+ *
+ * @param[in] index The index of the field
+ *
+ * @return The field
+ *
+ * @throws std::out_of_range if \a index is not less than size()
+ */
+inline const csv_field& csv_record::at(std::size_t index) const {
+    if (index >= m_size) throw std::out_of_range("csv_record::at()");
+    return m_fields[index];
+}
+
+/** @return An iterator to the first field */
+inline csv_record::iterator csv_record::begin() const noexcept {
+    return m_fields;
+}
+
+/** @return An iterator past the last field */
+inline csv_record::iterator csv_record::end() const noexcept {
+    return m_fields + m_size;
+}
+
+/** @return True if the record has no fields */
+inline bool csv_record::empty() const noexcept {
+    return m_size == 0;
+}
+
+/** @return The number of fields */
+inline std::size_t csv_record::size() const noexcept {
+    return m_size;
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_CSV_H_
@@ -0,0 +1,587 @@
+/**
+ *  \file   hash.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_HASH_H_
+#define UTILITY_INCLUDE_SUPERSTRING_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "superstring/superstring_view.h"
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace jfern {
+
+namespace detail {
+
+/** Keys up to this size are hashed inline */
+constexpr std::size_t hash_short_size = 16;
+
+/** The constants of wyhash (final version 4) */
+constexpr std::uint64_t hash_k0 = 0xa0761d6478bd642full;
+constexpr std::uint64_t hash_k1 = 0xe7037ed1a0b428dbull;
+constexpr std::uint64_t hash_k2 = 0x8ebc6af09c88c6e3ull;
+constexpr std::uint64_t hash_k3 = 0x589965cc75374cc3ull;
+
+/**
+ * Multiply two 64-bit integers, replacing them with the low and high halves
+ * of the 128-bit product
+ */
+inline void hash_multiply(std::uint64_t* a, std::uint64_t* b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = static_cast<unsigned __int128>(*a) * *b;
+    *a = static_cast<std::uint64_t>(product);
+    *b = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+    *a = _umul128(*a, *b, b);
+#else
+    const std::uint64_t a_lo = *a & 0xFFFFFFFF, a_hi = *a >> 32;
+    const std::uint64_t b_lo = *b & 0xFFFFFFFF, b_hi = *b >> 32;
+
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t hi_hi = a_hi * b_hi;
+
+    const std::uint64_t middle =
+        (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+
+    *a = (middle << 32) | (lo_lo & 0xFFFFFFFF);
+    *b = hi_hi + (hi_lo >> 32) + (middle >> 32);
+#endif
+}
+
+/** @return The two halves of the 128-bit product a * b, XOR-ed together */
+inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b) noexcept {
+    hash_multiply(&a, &b);
+    return a ^ b;
+}
+
+/** @return Four bytes read in little-endian order */
+inline std::uint64_t hash_read4(const unsigned char* data) noexcept {
+    return std::uint64_t(data[0])         | std::uint64_t(data[1]) << 8 |
+           std::uint64_t(data[2]) << 16 | std::uint64_t(data[3]) << 24;
+}
+
+/** Finish a hash from the last 16 bytes read */
+inline std::uint64_t hash_finish(std::uint64_t a, std::uint64_t b,
+                                 std::uint64_t seed,
+                                 std::size_t size) noexcept {
+    a ^= hash_k1;
+    b ^= seed;
+    hash_multiply(&a, &b);
+    return hash_mix(a ^ hash_k0 ^ size, b ^ hash_k1);
+}
+
+std::uint64_t hash_long(const unsigned char* data, std::size_t size,
+                        std::uint64_t seed) noexcept;
+
+}  // namespace detail
+
+/**
+ * Hash a sequence of bytes. This is a 64-bit, non-cryptographic hash for
+ * hash tables, filters and sharding: fast on short keys, and, on long ones,
+ * as fast as memory allows
+ *
+ * Keys of up to 16 bytes are hashed inline, as wyhash (final version 4) hashes
+ * them: two multiplies, with every byte read at most twice and no loop. Keys
+ * up to a kilobyte continue in wyhash's rounds of 48 bytes. Longer keys are
+ * taken 64 bytes at a time into eight accumulators, as in XXH3, whose 32x32-
+ * bit multiplies map onto the vector kernels search::active_level() picks
+ *
+ * Every kernel level gives the same hash for the same key and seed, but the
+ * hash is not meant to be stored: it may change between versions of this
+ * library, and it differs on big-endian CPUs
+ *
+ * @param[in] data The bytes
+ * @param[in] size The number of bytes
+ * @param[in] seed Selects one of 2^64 different hash functions
+ *
+ * @return The hash
+ */
+inline std::uint64_t hash64(const void* data, std::size_t size,
+                            std::uint64_t seed = 0) noexcept {
+    const auto bytes = static_cast<const unsigned char*>(data);
+    if (size > detail::hash_short_size)
+        return detail::hash_long(bytes, size, seed);
+
+    seed ^= detail::hash_mix(seed ^ detail::hash_k0, detail::hash_k1);
+
+    std::uint64_t a = 0, b = 0;
+    if (size >= 4) {
+        /* Two overlapping pairs of 4-byte words cover 4 to 16 bytes */
+        const std::size_t middle = (size >> 3) << 2;
+        a = detail::hash_read4(bytes) << 32 |
+            detail::hash_read4(bytes + middle);
+        b = detail::hash_read4(bytes + size - 4) << 32 |
+            detail::hash_read4(bytes + size - 4 - middle);
+    } else if (size > 0) {
+        a = std::uint64_t(bytes[0]) << 16 |
+            std::uint64_t(bytes[size >> 1]) << 8 | bytes[size - 1];
+    }
+
+    return detail::hash_finish(a, b, seed, size);
+}
+
+/**
+ * Hash a string
+ *
+ * @param[in] text The string
+ * @param[in] seed Selects one of 2^64 different hash functions
+ *
+ * @return hash64(text.data(), text.size(), seed)
+ */
+inline std::uint64_t hash64(superstring_view text,
+                            std::uint64_t seed = 0) noexcept {
+    return hash64(text.data(), text.size(), seed);
+}
+
+/**
+ * A string view together with its hash64(), so that the hash is computed
+ * once no matter how many tables the string is looked up in. Comparisons
+ * check the hashes before the characters
+ *
+ * The referenced characters must outlive the view
+ */
+class hashed_view final {
+ public:
+    hashed_view() noexcept;
+    hashed_view(const char* text) noexcept;                 // NOLINT
+    hashed_view(const std::string& text) noexcept;          // NOLINT
+    hashed_view(superstring_view text) noexcept;            // NOLINT
+    hashed_view(superstring_view text, std::uint64_t hash) noexcept;
+
+    hashed_view(const hashed_view& other)            = default;
+    hashed_view(hashed_view&& other)                 noexcept = default;
+    hashed_view& operator=(const hashed_view& other) = default;
+    hashed_view& operator=(hashed_view&& other)      noexcept = default;
+    ~hashed_view()                                   = default;
+
+    const char*      data() const noexcept;
+    std::uint64_t    hash() const noexcept;
+    std::size_t      size() const noexcept;
+    superstring_view view() const noexcept;
+
+ private:
+    /** The characters */
+    superstring_view m_text;
+
+    /** hash64() of \ref m_text */
+    std::uint64_t m_hash;
+};
+
+/**
+ * A string that carries its hash64(), for use as a hash table key. Looking
+ * one up never rehashes it, and the tables below can find it from any
+ * string or view without a copy
+ */
+class hashed_string final {
+ public:
+    hashed_string();
+    hashed_string(const char* text);                        // NOLINT
+    hashed_string(const std::string& text);                 // NOLINT
+    hashed_string(std::string&& text);                      // NOLINT
+    hashed_string(superstring_view text);                   // NOLINT
+    hashed_string(hashed_view text);                        // NOLINT
+
+    hashed_string(const hashed_string& other)            = default;
+    hashed_string(hashed_string&& other)                 noexcept = default;
+    hashed_string& operator=(const hashed_string& other) = default;
+    hashed_string& operator=(hashed_string&& other)      noexcept = default;
+    ~hashed_string()                                     = default;
+
+    operator hashed_view() const noexcept;  // NOLINT
+
+    void assign(superstring_view text);
+    void assign(hashed_view text);
+
+    const char*        data() const noexcept;
+    std::uint64_t      hash() const noexcept;
+    std::size_t        size() const noexcept;
+    const std::string& str()  const noexcept;
+    superstring_view   view() const noexcept;
+
+ private:
+    /** The characters */
+    std::string m_text;
+
+    /** hash64() of \ref m_text */
+    std::uint64_t m_hash;
+};
+
+bool operator==(const hashed_view& a, const hashed_view& b) noexcept;
+bool operator!=(const hashed_view& a, const hashed_view& b) noexcept;
+
+namespace detail {
+
+/*
+ * Every kind of key, reduced to a view: hashed keys keep their hash
+ */
+inline superstring_view hash_key(const char* key) noexcept {
+    return key;
+}
+
+template <class Alloc>
+superstring_view hash_key(
+    const std::basic_string<char, std::char_traits<char>, Alloc>& key)
+    noexcept {
+    return key;
+}
+
+inline superstring_view hash_key(superstring_view key) noexcept {
+    return key;
+}
+
+inline hashed_view hash_key(const hashed_view& key) noexcept {
+    return key;
+}
+
+inline hashed_view hash_key(const hashed_string& key) noexcept {
+    return key;
+}
+
+inline std::uint64_t key_hash(superstring_view key) noexcept {
+    return hash64(key);
+}
+
+inline std::uint64_t key_hash(const hashed_view& key) noexcept {
+    return key.hash();
+}
+
+inline bool key_equal(superstring_view a, superstring_view b) noexcept {
+    return a == b;
+}
+
+inline bool key_equal(superstring_view a, const hashed_view& b) noexcept {
+    return a == b.view();
+}
+
+inline bool key_equal(const hashed_view& a, superstring_view b) noexcept {
+    return a.view() == b;
+}
+
+inline bool key_equal(const hashed_view& a, const hashed_view& b) noexcept {
+    return a == b;
+}
+
+/*
+ * Set a map's scratch key to the key being looked up, reusing its storage
+ */
+template <class Key>
+void assign_key(std::string* scratch, const Key& key) {
+    const superstring_view text = hashed_view(key).view();
+    scratch->assign(text.data(), text.size());
+}
+
+inline void assign_key(std::string* scratch, superstring_view key) {
+    scratch->assign(key.data(), key.size());
+}
+
+template <class Key>
+void assign_key(hashed_string* scratch, const Key& key) {
+    scratch->assign(key);
+}
+
+template <class Key>
+void assign_key(hashed_view* scratch, const Key& key) noexcept {
+    *scratch = hashed_view(key);
+}
+
+template <class Key>
+void assign_key(superstring_view* scratch, const Key& key) noexcept {
+    *scratch = hashed_view(key).view();
+}
+
+inline void assign_key(superstring_view* scratch, superstring_view key)
+    noexcept {
+    *scratch = key;
+}
+
+}  // namespace detail
+
+/**
+ * A hash function for tables keyed on any kind of string. Strings, views and
+ * C strings hash to hash64() of their characters, and hashed keys to the
+ * hash they carry, which is the same value. It is transparent, so C++20
+ * containers can look up any of these without converting to the key type;
+ * before that, see find_key()
+ */
+struct string_hash {
+    using is_transparent = void;
+
+    template <class Key>
+    std::size_t operator()(const Key& key) const noexcept {
+        return static_cast<std::size_t>(
+            detail::key_hash(detail::hash_key(key)));
+    }
+};
+
+/**
+ * Compares any two kinds of string by their characters, checking hashes
+ * first when both sides carry one. The companion of \ref string_hash
+ */
+struct string_equal {
+    using is_transparent = void;
+
+    template <class Key1, class Key2>
+    bool operator()(const Key1& a, const Key2& b) const noexcept {
+        return detail::key_equal(detail::hash_key(a), detail::hash_key(b));
+    }
+};
+
+/**
+ * Look up a string in a map or set keyed on std::string, superstring_view,
+ * \ref hashed_string or \ref hashed_view, without allocating. The key is
+ * copied into a scratch key of the table's own type (one per thread and
+ * table type), whose storage is reused from one call to the next; if the
+ * key is a \ref hashed_string or \ref hashed_view, its hash comes along
+ *
+ * @param[in] table The table
+ * @param[in] key   A string, C string, view or hashed key
+ *
+ * @return An iterator to the entry found, or table.end()
+ */
+template <class Table, class Key>
+typename Table::iterator find_key(Table& table, const Key& key) {
+    thread_local typename Table::key_type scratch;
+    detail::assign_key(&scratch, detail::hash_key(key));
+    return table.find(scratch);
+}
+
+/**
+ * @overload
+ */
+template <class Table, class Key>
+typename Table::const_iterator find_key(const Table& table, const Key& key) {
+    thread_local typename Table::key_type scratch;
+    detail::assign_key(&scratch, detail::hash_key(key));
+    return table.find(scratch);
+}
+
+/**
+ * Construct an empty view
+ */
+inline hashed_view::hashed_view() noexcept
+    : hashed_view(superstring_view()) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text A null-terminated string
+ */
+inline hashed_view::hashed_view(const char* text) noexcept
+    : hashed_view(superstring_view(text)) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text The string to view
+ */
+inline hashed_view::hashed_view(const std::string& text) noexcept
+    : hashed_view(superstring_view(text)) {
+}
+
+/**
+ * Constructor, which hashes the text
+ *
+ * @param[in] text The text to view
+ */
+inline hashed_view::hashed_view(superstring_view text) noexcept
+    : m_text(text), m_hash(hash64(text)) {
+}
+
+/**
+ * Constructor, for text already hashed
+ *
+ * @param[in] text The text to view
+ * @param[in] hash hash64(text), with the default seed
+ */
+inline hashed_view::hashed_view(superstring_view text, std::uint64_t hash)
+    noexcept : m_text(text), m_hash(hash) {
+}
+
+/** @return The characters */
+inline const char* hashed_view::data() const noexcept {
+    return m_text.data();
+}
+
+/** @return hash64() of the characters */
+inline std::uint64_t hashed_view::hash() const noexcept {
+    return m_hash;
+}
+
+/** @return The number of characters */
+inline std::size_t hashed_view::size() const noexcept {
+    return m_text.size();
+}
+
+/** @return The characters, as a plain view */
+inline superstring_view hashed_view::view() const noexcept {
+    return m_text;
+}
+
+/**
+ * Construct an empty string
+ */
+inline hashed_string::hashed_string()
+    : m_text(), m_hash(hash64(superstring_view())) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text A null-terminated string to copy
+ */
+inline hashed_string::hashed_string(const char* text)
+    : hashed_string(superstring_view(text)) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text The string to copy
+ */
+inline hashed_string::hashed_string(const std::string& text)
+    : m_text(text), m_hash(hash64(m_text)) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text The string to take
+ */
+inline hashed_string::hashed_string(std::string&& text)
+    : m_text(std::move(text)), m_hash(hash64(m_text)) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text The text to copy
+ */
+inline hashed_string::hashed_string(superstring_view text)
+    : m_text(text.data(), text.size()), m_hash(hash64(text)) {
+}
+
+/**
+ * Constructor, keeping the hash already computed
+ *
+ * @param[in] text The text to copy
+ */
+inline hashed_string::hashed_string(hashed_view text)
+    : m_text(text.data(), text.size()), m_hash(text.hash()) {
+}
+
+/** @return A view of the string, with its hash */
+inline hashed_string::operator hashed_view() const noexcept {
+    return hashed_view(m_text, m_hash);
+}
+
+/**
+ * Replace the contents, reusing the storage
+ *
+ * @param[in] text The new text
+ */
+inline void hashed_string::assign(superstring_view text) {
+    m_text.assign(text.data(), text.size());
+    m_hash = hash64(text);
+}
+
+/**
+ * Replace the contents, reusing the storage and keeping the hash already
+ * computed
+ *
+ * @param[in] text The new text
+ */
+inline void hashed_string::assign(hashed_view text) {
+    m_text.assign(text.data(), text.size());
+    m_hash = text.hash();
+}
+
+/** @return The characters */
+inline const char* hashed_string::data() const noexcept {
+    return m_text.data();
+}
+
+/** @return hash64() of the characters */
+inline std::uint64_t hashed_string::hash() const noexcept {
+    return m_hash;
+}
+
+/** @return The number of characters */
+inline std::size_t hashed_string::size() const noexcept {
+    return m_text.size();
+}
+
+/** @return The string */
+inline const std::string& hashed_string::str() const noexcept {
+    return m_text;
+}
+
+/** @return A view of the string */
+inline superstring_view hashed_string::view() const noexcept {
+    return m_text;
+}
+
+/**
+ * Compare two hashed strings, looking at the characters only if the hashes
+ * match
+ *
+ * @param[in] a The first
+ * @param[in] b The second
+ *
+ * @return True if the characters are the same
+ */
+inline bool operator==(const hashed_view& a, const hashed_view& b) noexcept {
+    return a.hash() == b.hash() && a.view() == b.view();
+}
+
+/**
+ * @param[in] a The first
+ * @param[in] b The second
+ *
+ * @return !(a == b)
+ */
+inline bool operator!=(const hashed_view& a, const hashed_view& b) noexcept {
+    return !(a == b);
+}
+
+}  // namespace jfern
+
+namespace std {
+
+/** Hashes a \ref jfern::hashed_view to the hash it carries */
+template <>
+struct hash<jfern::hashed_view> {
+    std::size_t operator()(const jfern::hashed_view& key) const noexcept {
+        return static_cast<std::size_t>(key.hash());
+    }
+};
+
+/** Hashes a \ref jfern::hashed_string to the hash it carries */
+template <>
+struct hash<jfern::hashed_string> {
+    std::size_t operator()(const jfern::hashed_string& key) const noexcept {
+        return static_cast<std::size_t>(key.hash());
+    }
+};
+
+}  // namespace std
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_HASH_H_
@@ -0,0 +1,136 @@
+/**
+ *  \file   intern_pool.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_INTERN_POOL_H_
+#define UTILITY_INCLUDE_SUPERSTRING_INTERN_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "superstring/arena.h"
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/**
+ * A symbol table. Each distinct string is stored once, in an \ref arena, and
+ * given a 32-bit ID that stays valid (as does its view) for the life of the
+ * pool. Two interned strings are equal exactly when their IDs are, so IDs
+ * make cheap keys for downstream maps
+ *
+ * The pool is split into shards by hash. Looking up a string that is already
+ * present takes no lock at all; only adding a new string locks its shard, so
+ * threads interning different strings rarely contend
+ */
+class intern_pool final {
+ public:
+    /** A string's ID */
+    using id_type = std::uint32_t;
+
+    /** Returned by find() for a string that is not in the pool */
+    static constexpr id_type npos = ~id_type(0);
+
+    /** The default number of shards */
+    static constexpr std::size_t default_shards = 16;
+
+    explicit intern_pool(std::size_t shards = default_shards);
+
+    intern_pool(const intern_pool& pool)            = delete;
+    intern_pool(intern_pool&& pool)                 = delete;
+    intern_pool& operator=(const intern_pool& pool) = delete;
+    intern_pool& operator=(intern_pool&& pool)      = delete;
+    ~intern_pool();
+
+    id_type          intern(superstring_view str);
+    id_type          find(superstring_view str) const noexcept;
+    superstring_view view(id_type id)            const;
+
+    std::size_t size()  const noexcept;
+    std::size_t bytes() const noexcept;
+
+ private:
+    /** The number of IDs in a shard's first segment */
+    static constexpr std::size_t first_segment = 64;
+
+    /** Enough segments, each twice the size of the last, for any shard */
+    static constexpr std::size_t max_segments = 32;
+
+    /**
+     * An open addressing hash table. Each occupied slot holds the top half
+     * of a string's hash and one more than its index within the shard; zero
+     * marks an empty slot
+     */
+    struct table {
+        explicit table(std::size_t capacity);
+
+        /** The number of slots, less one */
+        std::size_t mask;
+
+        /** The slots */
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+    };
+
+    /** One independently locked part of the pool */
+    struct shard {
+        shard();
+
+        /** Serializes insertions */
+        std::mutex mutex;
+
+        /** Where this shard's strings are stored */
+        arena storage;
+
+        /**
+         * The table readers search. When it fills up, a larger one replaces
+         * it and the old one is kept, since readers may still be using it
+         */
+        std::atomic<table*> current;
+
+        /** Every table this shard has used */
+        std::vector<std::unique_ptr<table>> tables;
+
+        /**
+         * Maps indices to strings. Segments are never moved once allocated,
+         * so they can be read without the lock
+         */
+        std::atomic<superstring_view*> segments[max_segments];
+
+        /** The number of strings in this shard */
+        std::atomic<std::size_t> count;
+
+        /** The number of characters stored */
+        std::atomic<std::size_t> bytes;
+    };
+
+    std::size_t      lookup(const shard& part, std::uint64_t hash,
+                            superstring_view str) const noexcept;
+    void             insert(shard* part, std::uint64_t hash,
+                            std::size_t index);
+    superstring_view entry(const shard& part, std::size_t index) const noexcept;
+    id_type          make_id(std::uint64_t hash, std::size_t index) const
+        noexcept;
+
+    static void locate(std::size_t index, std::size_t* segment,
+                       std::size_t* offset) noexcept;
+
+    /** The shards */
+    std::unique_ptr<shard[]> m_shards;
+
+    /** The number of low ID (and hash) bits that select a shard */
+    std::size_t m_shard_bits;
+};
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_INTERN_POOL_H_
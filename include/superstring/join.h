@@ -0,0 +1,297 @@
+/**
+ *  \file   join.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_JOIN_H_
+#define UTILITY_INCLUDE_SUPERSTRING_JOIN_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/*
+ * Sinks receive the output of join(). A sink has two members:
+ *
+ *   void reserve(std::size_t size);                  // Total size, if known
+ *   void write(const char* data, std::size_t size);  // Next characters
+ *
+ * so that a joined result can be written straight to its destination without
+ * first being built up in a string
+ */
+
+/**
+ * Appends to a string. Without a reserve() call the string grows by doubling
+ *
+ * @tparam String A std::basic_string<char> with any allocator
+ */
+template <class String = std::string>
+class string_sink final {
+ public:
+    explicit string_sink(String* out) noexcept;
+
+    void reserve(std::size_t size);
+    void write(const char* data, std::size_t size);
+
+ private:
+    /** The string being appended to */
+    String* m_out;
+};
+
+/**
+ * Writes into a caller-provided buffer, which is never reallocated
+ */
+class buffer_sink final {
+ public:
+    buffer_sink(char* data, std::size_t capacity) noexcept;
+
+    void reserve(std::size_t size) const;
+    void write(const char* data, std::size_t size);
+
+    std::size_t      size() const noexcept;
+    superstring_view view() const noexcept;
+
+ private:
+    /** The start of the buffer */
+    char* m_data;
+
+    /** The size of the buffer */
+    std::size_t m_capacity;
+
+    /** The number of characters written so far */
+    std::size_t m_size;
+};
+
+/**
+ * Writes to a std::ostream
+ */
+class ostream_sink final {
+ public:
+    explicit ostream_sink(std::ostream& stream) noexcept;
+
+    void reserve(std::size_t size) const noexcept;
+    void write(const char* data, std::size_t size);
+
+ private:
+    /** The stream written to */
+    std::ostream& m_stream;
+};
+
+/**
+ * Writes to a file descriptor in chunks. Small writes are gathered into a
+ * buffer so that the number of system calls depends on the size of the
+ * output, not the number of pieces. Anything left in the buffer is written
+ * by flush() or the destructor
+ */
+class fd_sink final {
+ public:
+    /** The default size of each write(2) */
+    static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+    explicit fd_sink(int fd, std::size_t chunk_size = default_chunk_size);
+
+    fd_sink(const fd_sink& sink)            = delete;
+    fd_sink(fd_sink&& sink)                 = delete;
+    fd_sink& operator=(const fd_sink& sink) = delete;
+    fd_sink& operator=(fd_sink&& sink)      = delete;
+    ~fd_sink();
+
+    void reserve(std::size_t size) const noexcept;
+    void write(const char* data, std::size_t size);
+    void flush();
+
+ private:
+    void write_fully(const char* data, std::size_t size);
+
+    /** The file descriptor written to. Not owned */
+    int m_fd;
+
+    /** Characters gathered for the next write(2) */
+    std::unique_ptr<char[]> m_buffer;
+
+    /** The size of \ref m_buffer */
+    std::size_t m_chunk_size;
+
+    /** The number of characters in \ref m_buffer */
+    std::size_t m_size;
+};
+
+template <class Sink, class Iterator>
+std::size_t join(Sink& sink, superstring_view separator, Iterator first,
+                 Iterator last);
+
+template <class String = std::string, class Iterator>
+String join(superstring_view separator, Iterator first, Iterator last,
+            const typename String::allocator_type& alloc =
+                typename String::allocator_type());
+
+/**
+ * Constructor
+ *
+ * @param[in] out The string to append to. Must outlive this sink
+ */
+template <class String>
+string_sink<String>::string_sink(String* out) noexcept : m_out(out) {
+}
+
+/**
+ * Make room for characters about to be written
+ *
+ * @param[in] size The number of characters
+ */
+template <class String>
+void string_sink<String>::reserve(std::size_t size) {
+    m_out->reserve(m_out->size() + size);
+}
+
+/**
+ * Append characters to the string
+ *
+ * @param[in] data The characters
+ * @param[in] size The number of characters
+ */
+template <class String>
+void string_sink<String>::write(const char* data, std::size_t size) {
+    const std::size_t needed = m_out->size() + size;
+
+    /*
+     * Double explicitly rather than count on append() to: some libraries
+     * grow by less, or by exactly what is asked for
+     */
+    if (needed > m_out->capacity())
+        m_out->reserve(std::max(needed, 2 * m_out->capacity()));
+
+    m_out->append(data, size);
+}
+
+/**
+ * @return The number of characters written so far
+ */
+inline std::size_t buffer_sink::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The characters written so far
+ */
+inline superstring_view buffer_sink::view() const noexcept {
+    return superstring_view(m_data, m_size);
+}
+
+/**
+ * Does nothing: a stream cannot make use of a size hint
+ */
+inline void ostream_sink::reserve(std::size_t) const noexcept {
+}
+
+/**
+ * Does nothing: output is already written a chunk at a time
+ */
+inline void fd_sink::reserve(std::size_t) const noexcept {
+}
+
+namespace detail {
+
+/*
+ * Add up the size of the output, if it can be known without consuming the
+ * range. Returns false for single-pass iterators
+ */
+template <class Iterator>
+bool joined_size(superstring_view separator, Iterator first, Iterator last,
+                 std::size_t* size) {
+    using category =
+        typename std::iterator_traits<Iterator>::iterator_category;
+
+    if (!std::is_base_of<std::forward_iterator_tag, category>::value)
+        return false;
+
+    *size = 0;
+    for (auto iter = first; iter != last; ++iter) {
+        if (iter != first) *size += separator.size();
+        *size += superstring_view(*iter).size();
+    }
+
+    return true;
+}
+
+}  // namespace detail
+
+/**
+ * Write a range of strings, with a separator between each pair, to a sink.
+ * If the iterators are multi-pass, the output size is computed first and
+ * passed to the sink's reserve(), so that a string sink allocates exactly
+ * once
+ *
+ * @param[in] sink      Where to write the output
+ * @param[in] separator What to put in between the strings
+ * @param[in] first     Iterator to the first string. Each element must be
+ *                      convertible to a \ref superstring_view
+ * @param[in] last      Iterator past the last string
+ *
+ * @return The number of characters written
+ */
+template <class Sink, class Iterator>
+std::size_t join(Sink& sink, superstring_view separator, Iterator first,
+                 Iterator last) {
+    std::size_t total = 0;
+    if (detail::joined_size(separator, first, last, &total))
+        sink.reserve(total);
+
+    /*
+     * Copies of a single-pass iterator may compare equal wherever they are,
+     * so the first element is tracked with a flag rather than by comparing
+     * against first
+     */
+    std::size_t written = 0;
+    bool leading = true;
+    for (auto iter = first; iter != last; ++iter) {
+        if (!leading) {
+            sink.write(separator.data(), separator.size());
+            written += separator.size();
+        }
+        leading = false;
+
+        const superstring_view piece(*iter);
+        sink.write(piece.data(), piece.size());
+        written += piece.size();
+    }
+
+    return written;
+}
+
+/**
+ * Join a range of strings, with a separator between each pair, into a new
+ * string
+ *
+ * @param[in] separator What to put in between the strings
+ * @param[in] first     Iterator to the first string
+ * @param[in] last      Iterator past the last string
+ * @param[in] alloc     The allocator for the result
+ *
+ * @return The joined string
+ */
+template <class String, class Iterator>
+String join(superstring_view separator, Iterator first, Iterator last,
+            const typename String::allocator_type& alloc) {
+    String out(alloc);
+    string_sink<String> sink(&out);
+    join(sink, separator, first, last);
+    return out;
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_JOIN_H_
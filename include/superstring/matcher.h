@@ -0,0 +1,186 @@
+/**
+ *  \file   matcher.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_MATCHER_H_
+#define UTILITY_INCLUDE_SUPERSTRING_MATCHER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "superstring/search.h"
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/**
+ * An occurrence of one of a \ref matcher's patterns
+ */
+struct match {
+    /** Sentinel pattern index, meaning there was no match */
+    static constexpr std::size_t npos = superstring_view::npos;
+
+    /** The index of the pattern that matched */
+    std::size_t pattern;
+
+    /** The offset of the match's first character in the text */
+    std::size_t position;
+
+    /** The length of the match */
+    std::size_t length;
+};
+
+bool operator==(const match& a, const match& b) noexcept;
+bool operator!=(const match& a, const match& b) noexcept;
+
+/**
+ * Whether a \ref matcher skips ahead with the vector kernels from search.h,
+ * rather than stepping the automaton over every byte. The prefilter looks for
+ * the rarest byte of each pattern (going by typical text), since no match can
+ * begin far before one. The automatic setting backs off for a while whenever
+ * the prefilter keeps finding candidates close together
+ */
+enum class prefilter {
+    off,
+    on,
+    automatic
+};
+
+/**
+ * Finds any of a set of patterns in one pass over a text, using an
+ * Aho-Corasick automaton. The patterns are compiled once, on construction,
+ * into a dense transition table over the bytes that actually appear in them,
+ * so scanning a byte is a single table lookup
+ *
+ * A matcher is immutable once constructed, and can be shared between threads
+ * without locking
+ */
+class matcher final {
+ public:
+    template <class InputIterator>
+    matcher(InputIterator first, InputIterator last,
+            prefilter mode = prefilter::automatic);
+    matcher(std::initializer_list<superstring_view> patterns,
+            prefilter mode = prefilter::automatic);
+
+    matcher(const matcher& other)            = default;
+    matcher(matcher&& other)                 noexcept = default;
+    matcher& operator=(const matcher& other) = default;
+    matcher& operator=(matcher&& other)      noexcept = default;
+    ~matcher()                               = default;
+
+    std::size_t      size()                      const noexcept;
+    superstring_view pattern(std::size_t index) const;
+    std::size_t      states()                    const noexcept;
+    prefilter        mode()                      const noexcept;
+
+    bool               contains(superstring_view text)   const noexcept;
+    match              find_first(superstring_view text) const noexcept;
+    std::vector<match> find_all(superstring_view text)   const;
+
+ private:
+    /** Marks a transition into a state where some pattern ends */
+    static constexpr std::uint32_t match_bit = std::uint32_t(1) << 31;
+
+    void compile(const std::vector<superstring_view>& patterns);
+
+    template <bool Prefilter, class Report>
+    void scan(superstring_view text, Report report) const;
+
+    /** Every pattern, back to back */
+    std::string m_text;
+
+    /** Where each pattern starts in \ref m_text, plus one past the last */
+    std::vector<std::size_t> m_offsets;
+
+    /** Maps each byte to its column in \ref m_table */
+    std::uint16_t m_columns[256];
+
+    /** The number of columns: distinct pattern bytes, plus one for the rest */
+    std::size_t m_width;
+
+    /**
+     * The transition function. Entry (row + column) holds the next state's
+     * row offset (state * m_width), with \ref match_bit set if any pattern
+     * ends there
+     */
+    std::vector<std::uint32_t> m_table;
+
+    /** Where each state's outputs start in \ref m_outputs */
+    std::vector<std::uint32_t> m_output_offsets;
+
+    /** The patterns ending at each state, in ascending order */
+    std::vector<std::uint32_t> m_outputs;
+
+    /** The rarest byte of each pattern, which the prefilter looks for */
+    search::char_class m_rare;
+
+    /** The furthest any pattern's rare byte is from its start */
+    std::size_t m_rare_offset;
+
+    /** When to use the prefilter */
+    prefilter m_mode;
+};
+
+/**
+ * Constructor. Compiles the patterns
+ *
+ * @param[in] first An iterator to the first pattern. Each must be convertible
+ *                  to a \ref superstring_view, and is copied
+ * @param[in] last  An iterator past the last pattern
+ * @param[in] mode  When to use the prefilter
+ *
+ * @throws std::length_error if the automaton is too large to index
+ */
+template <class InputIterator>
+matcher::matcher(InputIterator first, InputIterator last, prefilter mode)
+    : m_text(),
+      m_offsets(),
+      m_columns{0},
+      m_width(0),
+      m_table(),
+      m_output_offsets(),
+      m_outputs(),
+      m_rare(),
+      m_rare_offset(0),
+      m_mode(mode) {
+    std::vector<superstring_view> patterns;
+    for (auto iter = first; iter != last; ++iter)
+        patterns.push_back(superstring_view(*iter));
+
+    compile(patterns);
+}
+
+/**
+ * @return The number of patterns
+ */
+inline std::size_t matcher::size() const noexcept {
+    return m_offsets.size() - 1;
+}
+
+/**
+ * @return The number of states in the automaton
+ */
+inline std::size_t matcher::states() const noexcept {
+    return m_table.size() / m_width;
+}
+
+/**
+ * @return When scans skip ahead with the prefilter
+ */
+inline prefilter matcher::mode() const noexcept {
+    return m_mode;
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_MATCHER_H_
@@ -0,0 +1,53 @@
+/**
+ *  \file   parallel.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_PARALLEL_H_
+#define UTILITY_INCLUDE_SUPERSTRING_PARALLEL_H_
+
+#include <cstddef>
+
+#include "superstring/superstring.h"
+#include "superstring/superstring_view.h"
+#include "superstring/thread_pool.h"
+
+namespace jfern {
+
+/**
+ * Multithreaded versions of the superstring operations that touch every
+ * character, for strings of many megabytes. Each divides the string into a
+ * few chunks per thread, processes the chunks on a \ref thread_pool, and puts
+ * the results back together in order. The results are exactly those of the
+ * sequential versions
+ *
+ * Strings shorter than \ref min_chunk_size per thread gain nothing from
+ * this, and are processed on the calling thread
+ */
+namespace parallel {
+
+/** The least input worth handing to another thread */
+constexpr std::size_t min_chunk_size = 64 * 1024;
+
+superstring::vector_type split(thread_pool& pool, const superstring& str,
+                               superstring_view separator = " ");
+superstring::vector_type split(thread_pool& pool, const superstring& str,
+                               std::size_t size);
+superstring::vector_type split_trimmed(thread_pool& pool,
+                                       const superstring& str,
+                                       superstring_view separator = " ");
+
+superstring to_lower(thread_pool& pool, const superstring& str);
+superstring to_lower(thread_pool& pool, superstring&& str);
+superstring to_upper(thread_pool& pool, const superstring& str);
+superstring to_upper(thread_pool& pool, superstring&& str);
+
+}  // namespace parallel
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_PARALLEL_H_
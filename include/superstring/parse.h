@@ -0,0 +1,236 @@
+/**
+ *  \file   parse.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_PARSE_H_
+#define UTILITY_INCLUDE_SUPERSTRING_PARSE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/**
+ * The outcome of parsing a number
+ */
+enum class parse_status {
+    ok,
+    invalid,
+    out_of_range
+};
+
+/*
+ * Numbers are parsed from the whole of a view, with no leading or trailing
+ * whitespace. Unlike std::stoi() and std::stod(), parsing doesn't depend on
+ * the locale, doesn't allocate and doesn't throw; on failure, the status
+ * says why and the value is zeroed
+ */
+
+template <class Integer>
+parse_status parse(superstring_view str, Integer* value) noexcept;
+
+parse_status parse(superstring_view str, double* value) noexcept;
+
+template <class T, class InputIterator>
+std::size_t parse_column(InputIterator first, InputIterator last, T* values,
+                         parse_status* statuses = nullptr) noexcept;
+
+namespace detail {
+
+/**
+ * Check if eight characters, loaded as a little-endian word, are all decimal
+ * digits
+ *
+ * @param[in] word The characters
+ *
+ * @return True if they are all digits
+ */
+inline bool is_eight_digits(std::uint64_t word) noexcept {
+    return ((word & 0xF0F0F0F0F0F0F0F0ull) |
+            (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+        == 0x3333333333333333ull;
+}
+
+/**
+ * Convert eight digits, loaded as a little-endian word, to their value. Each
+ * step combines adjacent groups of digits, so it takes three multiplications
+ * rather than eight
+ *
+ * @param[in] word The digits
+ *
+ * @return Their value
+ */
+inline std::uint32_t parse_eight_digits(std::uint64_t word) noexcept {
+    const std::uint64_t mask = 0x000000FF000000FFull;
+    const std::uint64_t mul1 = 100 + (1000000ull << 32);
+    const std::uint64_t mul2 = 1 + (10000ull << 32);
+
+    word -= 0x3030303030303030ull;
+    word = (word * 10) + (word >> 8);
+    word = (((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32;
+
+    return static_cast<std::uint32_t>(word);
+}
+
+/**
+ * Load eight characters as a little-endian word
+ *
+ * @param[in] data The characters
+ *
+ * @return The word
+ */
+inline std::uint64_t load_eight(const char* data) noexcept {
+    std::uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+/**
+ * Parse a run of decimal digits
+ *
+ * @param[in]  data  The digits
+ * @param[in]  size  The number of digits
+ * @param[out] value Their value
+ *
+ * @return parse_status::ok on success, parse_status::invalid if there are
+ *         no digits or something else is mixed in, or
+ *         parse_status::out_of_range if the value is 2^64 or more
+ */
+inline parse_status parse_digits(const char* data, std::size_t size,
+                                 std::uint64_t* value) noexcept {
+    if (size == 0) return parse_status::invalid;
+
+    /* Leading zeros don't count towards the 20 digits a uint64_t can hold */
+    while (size > 1 && *data == '0') {
+        data++;
+        size--;
+    }
+
+    if (size > std::numeric_limits<std::uint64_t>::digits10 + 1) {
+        for (std::size_t i = 0; i < size; i++) {
+            if (static_cast<unsigned char>(data[i] - '0') > 9)
+                return parse_status::invalid;
+        }
+        return parse_status::out_of_range;
+    }
+
+    /* Two blocks of eight can't overflow; the rest are checked one by one */
+    std::uint64_t result = 0;
+    std::size_t i = 0;
+    for (; size - i >= 8 && i < 16; i += 8) {
+        const std::uint64_t word = load_eight(data + i);
+        if (!is_eight_digits(word)) return parse_status::invalid;
+
+        result = result * 100000000 + parse_eight_digits(word);
+    }
+
+    for (; i < size; i++) {
+        const unsigned int digit = static_cast<unsigned char>(data[i] - '0');
+        if (digit > 9) return parse_status::invalid;
+
+        if (result > (std::numeric_limits<std::uint64_t>::max() - digit) / 10)
+            return parse_status::out_of_range;
+
+        result = result * 10 + digit;
+    }
+
+    *value = result;
+    return parse_status::ok;
+}
+
+}  // namespace detail
+
+/**
+ * Parse an integer: an optional sign (only '+' for unsigned types) and then
+ * decimal digits. Digits are checked and converted eight at a time
+ *
+ * @param[in]  str   The characters, all of which must be part of the number
+ * @param[out] value The integer
+ *
+ * @return parse_status::ok on success, parse_status::invalid if \a str is
+ *         not an integer, or parse_status::out_of_range if it does not fit
+ *         in an \a Integer
+ */
+template <class Integer>
+parse_status parse(superstring_view str, Integer* value) noexcept {
+    static_assert(std::is_integral<Integer>::value &&
+                  !std::is_same<Integer, bool>::value,
+                  "parse() needs an integer type");
+
+    *value = 0;
+
+    const char* data = str.data();
+    std::size_t size = str.size();
+
+    bool negative = false;
+    if (size > 0 && (*data == '-' || *data == '+')) {
+        negative = *data == '-';
+        if (negative && std::is_unsigned<Integer>::value)
+            return parse_status::invalid;
+
+        data++;
+        size--;
+    }
+
+    std::uint64_t magnitude;
+    const parse_status status = detail::parse_digits(data, size, &magnitude);
+    if (status != parse_status::ok) return status;
+
+    using unsigned_type = typename std::make_unsigned<Integer>::type;
+    const std::uint64_t limit = static_cast<unsigned_type>(
+        std::numeric_limits<Integer>::max()) + std::uint64_t(negative);
+
+    if (magnitude > limit) return parse_status::out_of_range;
+
+    *value = static_cast<Integer>(
+        negative ? static_cast<unsigned_type>(0 - magnitude)
+                 : static_cast<unsigned_type>(magnitude));
+    return parse_status::ok;
+}
+
+/**
+ * Parse a column of numbers, e.g. the fields split from one column of a
+ * file. Tokens that fail to parse are recorded in \a statuses, and given the
+ * value zero
+ *
+ * @param[in]  first    An iterator to the first token. Each must be
+ *                      convertible to a \ref superstring_view
+ * @param[in]  last     An iterator past the last token
+ * @param[out] values   Where to store the numbers, one per token
+ * @param[out] statuses If not null, where to store each token's status
+ *
+ * @return The number of tokens that parsed successfully
+ */
+template <class T, class InputIterator>
+std::size_t parse_column(InputIterator first, InputIterator last, T* values,
+                         parse_status* statuses) noexcept {
+    std::size_t parsed = 0;
+
+    for (; first != last; ++first, ++values) {
+        const parse_status status = parse(superstring_view(*first), values);
+        parsed += status == parse_status::ok;
+
+        if (statuses) *statuses++ = status;
+    }
+
+    return parsed;
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_PARSE_H_
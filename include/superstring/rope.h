@@ -0,0 +1,256 @@
+/**
+ *  \file   rope.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_ROPE_H_
+#define UTILITY_INCLUDE_SUPERSTRING_ROPE_H_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "superstring/superstring.h"
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+namespace detail {
+
+struct rope_node;
+
+}  // namespace detail
+
+/**
+ * A string stored as a balanced tree of chunks, for assembling and editing
+ * large text without moving it around. Concatenation, substrings, insertion
+ * and erasure all take O(log n) time and copy none of the existing text
+ *
+ * Chunks are immutable and reference counted, so copies of a rope (and any
+ * substrings taken from it) share them. Short appends are gathered into a
+ * buffer of up to \ref flat_size characters before they become a chunk,
+ * which keeps the tree from filling up with tiny pieces
+ *
+ * Like the standard containers, a rope may be read from several threads at
+ * once, but not modified while it is being read
+ */
+class rope final {
+ public:
+    class chunk_iterator;
+    class chunk_range;
+
+    /** Means "until the end of the rope" */
+    static constexpr std::size_t npos = superstring_view::npos;
+
+    /** The size of the buffer short appends are gathered into */
+    static constexpr std::size_t flat_size = 4096;
+
+    rope() noexcept;
+    explicit rope(const char* str);
+    explicit rope(superstring_view str);
+    explicit rope(std::string&& str);
+    explicit rope(const superstring& str);
+    explicit rope(superstring&& str);
+
+    rope(const rope& other)            = default;
+    rope(rope&& other)                 noexcept = default;
+    rope& operator=(const rope& other) = default;
+    rope& operator=(rope&& other)      noexcept = default;
+    ~rope()                            = default;
+
+    std::size_t size()  const noexcept;
+    bool        empty() const noexcept;
+    std::size_t depth() const noexcept;
+
+    char at(std::size_t pos) const;
+
+    rope substr(std::size_t pos = 0, std::size_t count = npos) const;
+
+    rope& append(const char* str);
+    rope& append(superstring_view str);
+    rope& append(std::string&& str);
+    rope& append(const rope& other);
+
+    rope& operator+=(superstring_view str);
+    rope& operator+=(const rope& other);
+
+    rope& insert(std::size_t pos, superstring_view str);
+    rope& insert(std::size_t pos, const rope& other);
+    rope& erase(std::size_t pos, std::size_t count = npos);
+    void  clear() noexcept;
+
+    chunk_range chunks() const;
+
+    std::size_t copy(char* dest, std::size_t count, std::size_t pos = 0)
+        const;
+    std::string str() const;
+
+    template <class Sink>
+    void write(Sink& sink) const;
+    void writev(int fd) const;
+
+    explicit operator superstring() const;
+
+ private:
+    using node_ptr = std::shared_ptr<const detail::rope_node>;
+
+    explicit rope(node_ptr root) noexcept;
+
+    void     flush();
+    node_ptr tree() const;
+
+    /** Every chunk but the last few short appends */
+    node_ptr m_root;
+
+    /**
+     * Short appends not yet added to \ref m_root. This is written in place
+     * only when no other rope shares it
+     */
+    std::shared_ptr<std::string> m_tail;
+};
+
+/**
+ * Visits the chunks of a \ref rope in order. Modifying the rope invalidates
+ * its iterators
+ */
+class rope::chunk_iterator final {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = superstring_view;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const superstring_view*;
+    using reference         = const superstring_view&;
+
+    chunk_iterator() noexcept;
+
+    reference operator*()  const noexcept;
+    pointer   operator->() const noexcept;
+
+    chunk_iterator& operator++();
+    chunk_iterator  operator++(int);
+
+    bool operator==(const chunk_iterator& other) const noexcept;
+    bool operator!=(const chunk_iterator& other) const noexcept;
+
+ private:
+    friend class rope;
+
+    chunk_iterator(const detail::rope_node* root, const std::string* tail);
+
+    void advance();
+
+    /** The subtrees still to visit, the next one last */
+    std::vector<const detail::rope_node*> m_pending;
+
+    /** The rope's unflushed appends, until they have been visited */
+    const std::string* m_tail;
+
+    /** The current chunk; null at the end */
+    superstring_view m_chunk;
+
+    /** The number of characters before the current chunk */
+    std::size_t m_position;
+};
+
+/**
+ * The chunks of a \ref rope, for use with range-based for loops
+ */
+class rope::chunk_range final {
+ public:
+    chunk_iterator begin() const;
+    chunk_iterator end()   const noexcept;
+
+ private:
+    friend class rope;
+
+    chunk_range(const detail::rope_node* root,
+                const std::string* tail) noexcept;
+
+    /** The rope's tree */
+    const detail::rope_node* m_root;
+
+    /** The rope's unflushed appends */
+    const std::string* m_tail;
+};
+
+rope operator+(rope lhs, const rope& rhs);
+
+bool operator==(const rope& a, const rope& b);
+bool operator!=(const rope& a, const rope& b);
+bool operator==(const rope& a, superstring_view b);
+bool operator!=(const rope& a, superstring_view b);
+
+/**
+ * Constructor
+ *
+ * @param[in] str The initial contents, a null-terminated string, which are
+ *                copied
+ */
+inline rope::rope(const char* str) : rope(superstring_view(str)) {
+}
+
+/**
+ * @return True if there are no characters
+ */
+inline bool rope::empty() const noexcept {
+    return size() == 0;
+}
+
+/**
+ * Append a null-terminated string
+ *
+ * @param[in] str The string to append
+ *
+ * @return *this
+ */
+inline rope& rope::append(const char* str) {
+    return append(superstring_view(str));
+}
+
+/**
+ * Append a string
+ *
+ * @param[in] str The string to append
+ *
+ * @return *this
+ */
+inline rope& rope::operator+=(superstring_view str) {
+    return append(str);
+}
+
+/**
+ * Append another rope, sharing its chunks
+ *
+ * @param[in] other The rope to append
+ *
+ * @return *this
+ */
+inline rope& rope::operator+=(const rope& other) {
+    return append(other);
+}
+
+/**
+ * Write the rope to a sink from join.h, one chunk at a time
+ *
+ * @param[in] sink The sink
+ *
+ * @throws Whatever the sink throws
+ */
+template <class Sink>
+void rope::write(Sink& sink) const {
+    sink.reserve(size());
+
+    for (superstring_view chunk : chunks())
+        sink.write(chunk.data(), chunk.size());
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_ROPE_H_
@@ -0,0 +1,105 @@
+/**
+ *  \file   search.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_SEARCH_H_
+#define UTILITY_INCLUDE_SUPERSTRING_SEARCH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+namespace search {
+
+/**
+ * The instruction sets the search kernels are written for. The best one the
+ * CPU supports is picked at run time, so a portable build still gets the
+ * AVX2 kernels on hardware that has them
+ */
+enum class level {
+    scalar,
+    sse2,
+    avx2
+};
+
+/**
+ * A set of byte values, i.e. a character class such as whitespace, laid out
+ * for the vector kernels. Bytes above 0x7f are ordinary members
+ */
+class char_class final {
+ public:
+    char_class() noexcept;
+    explicit char_class(superstring_view chars) noexcept;
+
+    char_class(const char_class& other)            = default;
+    char_class(char_class&& other)                 noexcept = default;
+    char_class& operator=(const char_class& other) = default;
+    char_class& operator=(char_class&& other)      noexcept = default;
+    ~char_class()                                  = default;
+
+    void insert(char c) noexcept;
+
+    bool        contains(char c) const noexcept;
+    std::size_t size()           const noexcept;
+
+    const char*         members()     const noexcept;
+    const std::uint8_t* nibble_rows() const noexcept;
+
+    /** The number of members kept in a list for compare-based kernels */
+    static constexpr std::size_t max_listed = 8;
+
+ private:
+    /** One bit per byte value */
+    std::uint64_t m_bits[4];
+
+    /**
+     * Nibble lookup tables: bit (b >> 4) % 8 of m_rows[b >> 7][b & 15] is
+     * set if byte b is a member
+     */
+    std::uint8_t m_rows[2][16];
+
+    /** The first \ref max_listed members */
+    char m_members[max_listed];
+
+    /** The number of members */
+    std::size_t m_size;
+};
+
+level active_level()    noexcept;
+level supported_level() noexcept;
+void  set_active_level(level isa);
+
+std::size_t find(superstring_view text, char c) noexcept;
+std::size_t find(superstring_view text, superstring_view needle) noexcept;
+
+std::size_t find_first_of(superstring_view text,
+                          const char_class& chars) noexcept;
+std::size_t find_first_not_of(superstring_view text,
+                              const char_class& chars) noexcept;
+std::size_t find_last_not_of(superstring_view text,
+                             const char_class& chars) noexcept;
+
+/**
+ * Check if a byte is in the set
+ *
+ * @param[in] c The byte
+ *
+ * @return True if \a c is a member
+ */
+inline bool char_class::contains(char c) const noexcept {
+    const auto byte = static_cast<unsigned char>(c);
+    return (m_bits[byte / 64] >> (byte % 64)) & 1;
+}
+
+}  // namespace search
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_SEARCH_H_
@@ -12,72 +12,560 @@
 #define UTILITY_INCLUDE_SUPERSTRING_SUPERSTRING_H_
 
 #include <cstddef>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "superstring/arena.h"
+#include "superstring/case_map.h"
+#include "superstring/intern_pool.h"
+#include "superstring/join.h"
+#include "superstring/superstring_view.h"
+#include "superstring/tokenizer.h"
+
 namespace jfern {
 
 /**
  * A superstring wraps a std::string object and allows you to do what you wish
  * you could do with a normal C++ string
+ *
+ * Every string a superstring produces (copies, trimmed strings, tokens) is
+ * allocated with the wrapped string's allocator. Use \ref superstring for
+ * the global heap, or \ref arena_superstring to keep a request's strings in
+ * an \ref arena
+ *
+ * @tparam Alloc The allocator of the wrapped string
  */
-class superstring final {
+template <class Alloc = std::allocator<char>>
+class basic_superstring final {
  public:
-    explicit superstring(const std::string& str);
+    using allocator_type = Alloc;
+
+    using string_type =
+        std::basic_string<char, std::char_traits<char>, Alloc>;
+    using vector_type = std::vector<string_type,
+        typename std::allocator_traits<Alloc>::template
+            rebind_alloc<string_type>>;
+    using id_vector_type = std::vector<intern_pool::id_type,
+        typename std::allocator_traits<Alloc>::template
+            rebind_alloc<intern_pool::id_type>>;
+
+    explicit basic_superstring(const string_type& str);
+    explicit basic_superstring(string_type&& str) noexcept;
+    basic_superstring(superstring_view str, const Alloc& alloc);
+
+    basic_superstring(const basic_superstring& sstring)            = default;
+    basic_superstring(basic_superstring&& sstring)
+        noexcept = default;
+    basic_superstring& operator=(const basic_superstring& sstring) = default;
+    basic_superstring& operator=(basic_superstring&& sstring)
+        noexcept = default;
+    ~basic_superstring()                                           = default;
 
-    superstring(const superstring& sstring)            = default;
-    superstring(superstring&& sstring)                 noexcept = default;
-    superstring& operator=(const superstring& sstring) = default;
-    superstring& operator=(superstring&& sstring)      noexcept = default;
-    ~superstring()                                     = default;
+    allocator_type get_allocator() const noexcept;
 
-    bool        ends_with(const std::string& suffix)   const;
-    bool        starts_with(const std::string& prefix) const;
+    bool        ends_with(superstring_view suffix)   const noexcept;
+    bool        starts_with(superstring_view prefix) const noexcept;
 
-    std::string get()      const noexcept;
-    superstring to_lower() const noexcept;
-    superstring to_upper() const noexcept;
+    string_type      get()  const& noexcept;
+    string_type      get()  &&     noexcept;
+    superstring_view view() const  noexcept;
 
-    superstring ltrim()    const noexcept;
-    superstring rtrim()    const noexcept;
-    superstring trim()     const noexcept;
+    basic_superstring to_lower() const& noexcept;
+    basic_superstring to_lower() &&     noexcept;
+    basic_superstring to_upper() const& noexcept;
+    basic_superstring to_upper() &&     noexcept;
 
-    std::vector<std::string> split(const std::string& delimiter = " ") const;
-    std::vector<std::string> split(std::size_t size)                   const;
+    basic_superstring ltrim()    const& noexcept;
+    basic_superstring ltrim()    &&     noexcept;
+    basic_superstring rtrim()    const& noexcept;
+    basic_superstring rtrim()    &&     noexcept;
+    basic_superstring trim()     const& noexcept;
+    basic_superstring trim()     &&     noexcept;
 
-    operator std::string() const;
+    basic_superstring& lower_inplace() noexcept;
+    basic_superstring& upper_inplace() noexcept;
+    basic_superstring& ltrim_inplace() noexcept;
+    basic_superstring& rtrim_inplace() noexcept;
+    basic_superstring& trim_inplace()  noexcept;
+
+    vector_type split(superstring_view delimiter = " ") const;
+    vector_type split(std::size_t size)                 const;
+
+    id_vector_type split_interned(intern_pool& pool,
+                                  superstring_view delimiter = " ") const;
+
+    tokenizer tokenize(delimiter delim = ' ',
+                       empty_tokens empties = empty_tokens::drop)
+        const noexcept;
+    tokenizer split_n(std::size_t n, delimiter delim = ' ',
+                      empty_tokens empties = empty_tokens::drop)
+        const noexcept;
+
+    operator string_type() const&;
+    operator string_type() &&;
 
     template <class InputIterator>
-    static std::string build(
-        const std::string& separator, InputIterator first, InputIterator last);
+    static string_type build(superstring_view separator, InputIterator first,
+                             InputIterator last, const Alloc& alloc = Alloc());
 
  private:
     /** The internally managed string */
-    std::string m_internal;
+    string_type m_internal;
 };
 
+/** A superstring on the global heap */
+using superstring = basic_superstring<>;
+
+/** A superstring whose results are all allocated from an \ref arena */
+using arena_superstring = basic_superstring<arena_allocator<char>>;
+
+/**
+ * Constructor
+ *
+ * @param[in] str The std::string on which to operate
+ */
+template <class Alloc>
+basic_superstring<Alloc>::basic_superstring(const string_type& str)
+    : m_internal(str) {
+}
+
+/**
+ * Constructor. Takes over the string's buffer rather than copying it
+ *
+ * @param[in] str The std::string on which to operate
+ */
+template <class Alloc>
+basic_superstring<Alloc>::basic_superstring(string_type&& str) noexcept
+    : m_internal(std::move(str)) {
+}
+
+/**
+ * Constructor. Copies characters into a string that uses the given
+ * allocator
+ *
+ * @param[in] str   The characters on which to operate
+ * @param[in] alloc The allocator for this and every string derived from it
+ */
+template <class Alloc>
+basic_superstring<Alloc>::basic_superstring(superstring_view str,
+                                            const Alloc& alloc)
+    : m_internal(str.data(), str.size(), alloc) {
+}
+
+/**
+ * @return The allocator of the wrapped string
+ */
+template <class Alloc>
+typename basic_superstring<Alloc>::allocator_type
+basic_superstring<Alloc>::get_allocator() const noexcept {
+    return m_internal.get_allocator();
+}
+
+/**
+ * Check if the wrapped std::string ends with a phrase
+ *
+ * @param[in] suffix Check if the wrapped std::string ends with this
+ *
+ * @return True if the wrapped string ends with \a suffix
+ */
+template <class Alloc>
+bool basic_superstring<Alloc>::ends_with(superstring_view suffix) const
+    noexcept {
+    return view().ends_with(suffix);
+}
+
+/**
+ * Check if the wrapped std::string starts with a phrase
+ *
+ * @param[in] prefix Check if the wrapped std::string starts with this
+ *
+ * @return True if the wrapped string starts with \a suffix
+ */
+template <class Alloc>
+bool basic_superstring<Alloc>::starts_with(superstring_view prefix) const
+    noexcept {
+    return view().starts_with(prefix);
+}
+
+/**
+ * Get the wrapped std::string object
+ *
+ * @return The wrapped string
+ */
+template <class Alloc>
+typename basic_superstring<Alloc>::string_type
+basic_superstring<Alloc>::get() const& noexcept {
+    return m_internal;
+}
+
+/**
+ * Take the wrapped std::string object out of an expiring superstring
+ *
+ * @return The wrapped string, moved rather than copied
+ */
+template <class Alloc>
+typename basic_superstring<Alloc>::string_type
+basic_superstring<Alloc>::get() && noexcept {
+    return std::move(m_internal);
+}
+
+/**
+ * Get a view of the wrapped std::string, without copying it. The view is
+ * valid until this object is modified or destroyed
+ *
+ * @return A view of the wrapped string
+ */
+template <class Alloc>
+superstring_view basic_superstring<Alloc>::view() const noexcept {
+    return superstring_view(m_internal);
+}
+
+/**
+ * Convert the wrapped (internal) std::string to lower case. ASCII is mapped
+ * with SIMD; see \ref case_map::lower()
+ *
+ * @return A copy of this object in lower case
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::to_lower() const& noexcept {
+    basic_superstring copy(*this);
+    copy.lower_inplace();
+    return copy;
+}
+
+/**
+ * Convert an expiring superstring to lower case, reusing its buffer
+ *
+ * @return This object, moved, in lower case
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::to_lower() && noexcept {
+    return std::move(lower_inplace());
+}
+
+/**
+ * Convert the wrapped (internal) std::string to upper case. ASCII is mapped
+ * with SIMD; see \ref case_map::upper()
+ *
+ * @return A copy of this object in upper case
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::to_upper() const& noexcept {
+    basic_superstring copy(*this);
+    copy.upper_inplace();
+    return copy;
+}
+
+/**
+ * Convert an expiring superstring to upper case, reusing its buffer
+ *
+ * @return This object, moved, in upper case
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::to_upper() && noexcept {
+    return std::move(upper_inplace());
+}
+
+/**
+ * Remove leading whitespace from a string. This includes the character
+ * set " \t\n\v\f\r"
+ *
+ * @return A copy of this object with leading whitespace removed
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::ltrim() const& noexcept {
+    return basic_superstring(view().ltrim(), get_allocator());
+}
+
+/**
+ * Remove leading whitespace from an expiring superstring, reusing its buffer
+ *
+ * @return This object, moved, with leading whitespace removed
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::ltrim() && noexcept {
+    return std::move(ltrim_inplace());
+}
+
+/**
+ * Remove trailing whitespace from a string. This includes the character
+ * set " \t\n\v\f\r"
+ *
+ * @return A copy of this object with trailing whitespace removed
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::rtrim() const& noexcept {
+    return basic_superstring(view().rtrim(), get_allocator());
+}
+
+/**
+ * Remove trailing whitespace from an expiring superstring, reusing its
+ * buffer
+ *
+ * @return This object, moved, with trailing whitespace removed
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::rtrim() && noexcept {
+    return std::move(rtrim_inplace());
+}
+
+/**
+ * Remove leading and trailing whitespace from a string. This includes the
+ * character set " \t\n\v\f\r"
+ *
+ * @return A copy of this object with all leading and trailing whitespace
+ *         removed
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::trim() const& noexcept {
+    return basic_superstring(view().trim(), get_allocator());
+}
+
+/**
+ * Remove leading and trailing whitespace from an expiring superstring,
+ * reusing its buffer
+ *
+ * @return This object, moved, with leading and trailing whitespace removed
+ */
+template <class Alloc>
+basic_superstring<Alloc>
+basic_superstring<Alloc>::trim() && noexcept {
+    return std::move(trim_inplace());
+}
+
+/**
+ * Convert the wrapped std::string to lower case, in place
+ *
+ * @return *this
+ */
+template <class Alloc>
+basic_superstring<Alloc>&
+basic_superstring<Alloc>::lower_inplace() noexcept {
+    case_map::lower(&m_internal[0], m_internal.size());
+    return *this;
+}
+
+/**
+ * Convert the wrapped std::string to upper case, in place
+ *
+ * @return *this
+ */
+template <class Alloc>
+basic_superstring<Alloc>&
+basic_superstring<Alloc>::upper_inplace() noexcept {
+    case_map::upper(&m_internal[0], m_internal.size());
+    return *this;
+}
+
+/**
+ * Remove leading whitespace from the wrapped std::string, in place. This
+ * includes the character set " \t\n\v\f\r"
+ *
+ * @return *this
+ */
+template <class Alloc>
+basic_superstring<Alloc>&
+basic_superstring<Alloc>::ltrim_inplace() noexcept {
+    const superstring_view trimmed = view().ltrim();
+    m_internal.erase(0, trimmed.data() - m_internal.data());
+    return *this;
+}
+
+/**
+ * Remove trailing whitespace from the wrapped std::string, in place. This
+ * includes the character set " \t\n\v\f\r"
+ *
+ * @return *this
+ */
+template <class Alloc>
+basic_superstring<Alloc>&
+basic_superstring<Alloc>::rtrim_inplace() noexcept {
+    m_internal.resize(view().rtrim().size());
+    return *this;
+}
+
+/**
+ * Remove leading and trailing whitespace from the wrapped std::string, in
+ * place. This includes the character set " \t\n\v\f\r"
+ *
+ * @return *this
+ */
+template <class Alloc>
+basic_superstring<Alloc>&
+basic_superstring<Alloc>::trim_inplace() noexcept {
+    return rtrim_inplace().ltrim_inplace();
+}
+
+/**
+ * Split the wrapped string into tokens. Each token is separated by a delimiter
+ *
+ * @param[in] separator The delimiter
+ *
+ * @return A std::vector of tokens from the split string
+ */
+template <class Alloc>
+typename basic_superstring<Alloc>::vector_type
+basic_superstring<Alloc>::split(superstring_view separator) const {
+    vector_type tokens(get_allocator());
+
+    if (separator.empty()) {
+        tokens.push_back(m_internal);
+        return tokens;
+    }
+
+    for (superstring_view token : jfern::tokenize(view(), separator))
+        tokens.emplace_back(token.data(), token.size(), get_allocator());
+
+    return tokens;
+}
+
 /**
- * Build a string by combining substrings into a larger one
+ * Split the wrapped string into evenly sized tokens, each one \a size
+ * characters in length. The final token contains characters remaining after
+ * dividing up the string
+ *
+ * @param[in] size The desired size of each token
+ *
+ * @return A std::vector of tokens from the split string
+ */
+template <class Alloc>
+typename basic_superstring<Alloc>::vector_type
+basic_superstring<Alloc>::split(std::size_t size) const {
+    vector_type tokens(get_allocator());
+
+    if (size == 0 || size == std::string::npos) {
+        if (size == std::string::npos)
+            tokens.push_back(m_internal);
+        return tokens;
+    }
+
+    tokens.reserve((m_internal.size() + size - 1) / size);
+
+    std::size_t start = 0;
+    do {
+        const superstring_view token = view().substr(start, size);
+        tokens.emplace_back(token.data(), token.size(), get_allocator());
+        start += size;
+    } while (start < m_internal.size());
+
+    return tokens;
+}
+
+/**
+ * Split the wrapped string into tokens as \ref split() does, but intern each
+ * token rather than copying it. Repeated tokens then cost 4 bytes each, and
+ * compare equal by ID
+ *
+ * @param[in,out] pool      The pool to intern the tokens in
+ * @param[in]     separator The delimiter
+ *
+ * @return The ID of each token. \ref intern_pool::view() gets the token back
+ */
+template <class Alloc>
+typename basic_superstring<Alloc>::id_vector_type
+basic_superstring<Alloc>::split_interned(intern_pool& pool,
+                                         superstring_view separator) const {
+    id_vector_type ids(get_allocator());
+
+    if (separator.empty()) {
+        ids.push_back(pool.intern(view()));
+        return ids;
+    }
+
+    for (superstring_view token : jfern::tokenize(view(), separator))
+        ids.push_back(pool.intern(token));
+
+    return ids;
+}
+
+/**
+ * Lazily split the wrapped std::string into tokens. Unlike \ref split(), no
+ * vector is built: each token is found when the range is advanced to it
+ *
+ * @param[in] delim   What separates the tokens
+ * @param[in] empties Whether to report empty tokens
+ *
+ * @return A range of views into the wrapped string, valid until this object
+ *         is modified or destroyed
+ */
+template <class Alloc>
+tokenizer basic_superstring<Alloc>::tokenize(delimiter delim,
+                                             empty_tokens empties) const
+    noexcept {
+    return jfern::tokenize(view(), delim, empties);
+}
+
+/**
+ * Lazily split the wrapped std::string into at most \a n tokens, the last of
+ * which holds the rest of the string
+ *
+ * @param[in] n       The maximum number of tokens
+ * @param[in] delim   What separates the tokens
+ * @param[in] empties Whether to report empty tokens
+ *
+ * @return A range of views into the wrapped string, valid until this object
+ *         is modified or destroyed
+ */
+template <class Alloc>
+tokenizer basic_superstring<Alloc>::split_n(std::size_t n, delimiter delim,
+                                            empty_tokens empties) const
+    noexcept {
+    return jfern::split_n(view(), n, delim, empties);
+}
+
+/**
+ * Type conversion to a std::string. Allows a \ref superstring to be used
+ * in contexts that require a std::string
+ *
+ * @return The wrapped string
+ */
+template <class Alloc>
+basic_superstring<Alloc>::operator string_type() const& {
+    return m_internal;
+}
+
+/**
+ * Type conversion to a std::string from an expiring superstring, so that a
+ * chain of rvalue calls ends without a copy
+ *
+ * @return The wrapped string, moved rather than copied
+ */
+template <class Alloc>
+basic_superstring<Alloc>::operator string_type() && {
+    return std::move(m_internal);
+}
+
+/**
+ * Build a string by combining substrings into a larger one. The result is
+ * sized up front when the iterators are multi-pass; see \ref join()
  *
  * @param[in] separator What to put in between the substrings
  * @param[in] first     Input iterator to the first position in a range
  * @param[in] last      Input iterator to the final position in a range
+ * @param[in] alloc     The allocator for the combined string
  *
  * @return The combined string
  */
-template <class InputIterator>
-std::string superstring::build(
-    const std::string& separator, InputIterator first, InputIterator last) {
-    std::string out = "";
-
-    for (auto iter = first; iter != last; ++iter) {
-        if (iter != first) out += separator;
-        out += (*iter);
-    }
-
-    return out;
+template <class Alloc> template <class InputIterator>
+typename basic_superstring<Alloc>::string_type
+basic_superstring<Alloc>::build(superstring_view separator, InputIterator first,
+                                InputIterator last, const Alloc& alloc) {
+    return join<string_type>(separator, first, last, alloc);
 }
 
+extern template class basic_superstring<std::allocator<char>>;
+
 }  // namespace jfern
 
 #endif  // UTILITY_INCLUDE_SUPERSTRING_SUPERSTRING_H_
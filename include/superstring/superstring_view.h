@@ -0,0 +1,254 @@
+/**
+ *  \file   superstring_view.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_SUPERSTRING_VIEW_H_
+#define UTILITY_INCLUDE_SUPERSTRING_SUPERSTRING_VIEW_H_
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace jfern {
+
+/**
+ * A non-owning, read-only reference to a sequence of characters, i.e. a C++14
+ * backport of std::string_view with the \ref superstring operations added.
+ * Splitting and trimming a view produce more views into the same storage, so
+ * nothing is copied or allocated beyond the vector of tokens itself
+ *
+ * The referenced characters must outlive the view
+ */
+class superstring_view final {
+ public:
+    /** Sentinel returned by the find functions when there is no match */
+    static constexpr std::size_t npos = std::string::npos;
+
+    constexpr superstring_view() noexcept;
+    constexpr superstring_view(const char* data, std::size_t size) noexcept;
+    superstring_view(const char* str) noexcept;         // NOLINT
+    template <class Alloc>
+    superstring_view(  // NOLINT
+        const std::basic_string<char, std::char_traits<char>, Alloc>& str)
+        noexcept;
+
+    superstring_view(const superstring_view& view) = default;
+    superstring_view(superstring_view&& view)      noexcept = default;
+    superstring_view& operator=(const superstring_view& view) = default;
+    superstring_view& operator=(superstring_view&& view)
+        noexcept = default;
+    ~superstring_view() = default;
+
+    constexpr const char* data()   const noexcept;
+    constexpr std::size_t size()   const noexcept;
+    constexpr std::size_t length() const noexcept;
+    constexpr bool        empty()  const noexcept;
+
+    constexpr const char* begin() const noexcept;
+    constexpr const char* end()   const noexcept;
+
+    constexpr const char& operator[](std::size_t index) const noexcept;
+    constexpr const char& front() const noexcept;
+    constexpr const char& back()  const noexcept;
+
+    void remove_prefix(std::size_t n) noexcept;
+    void remove_suffix(std::size_t n) noexcept;
+
+    superstring_view substr(std::size_t pos = 0, std::size_t n = npos) const;
+
+    int compare(superstring_view other) const noexcept;
+
+    std::size_t find(char c, std::size_t pos = 0)               const noexcept;
+    std::size_t find(superstring_view str, std::size_t pos = 0) const noexcept;
+    std::size_t rfind(char c, std::size_t pos = npos)           const noexcept;
+
+    std::size_t find_first_of(superstring_view chars,
+                              std::size_t pos = 0)    const noexcept;
+    std::size_t find_first_not_of(superstring_view chars,
+                                  std::size_t pos = 0) const noexcept;
+    std::size_t find_last_not_of(superstring_view chars,
+                                 std::size_t pos = npos) const noexcept;
+
+    bool ends_with(superstring_view suffix)   const noexcept;
+    bool starts_with(superstring_view prefix) const noexcept;
+
+    superstring_view ltrim() const noexcept;
+    superstring_view rtrim() const noexcept;
+    superstring_view trim()  const noexcept;
+
+    std::vector<superstring_view> split(
+        superstring_view delimiter = " ")                   const;
+    std::vector<superstring_view> split(std::size_t size) const;
+
+    std::string to_string() const;
+    explicit operator std::string() const;
+
+#if __cplusplus >= 201703L
+    constexpr operator std::string_view() const noexcept;
+#endif
+
+ private:
+    /** The first character */
+    const char* m_data;
+
+    /** The number of characters */
+    std::size_t m_size;
+};
+
+bool operator==(superstring_view a, superstring_view b) noexcept;
+bool operator!=(superstring_view a, superstring_view b) noexcept;
+bool operator<(superstring_view a, superstring_view b)  noexcept;
+
+std::ostream& operator<<(std::ostream& stream, superstring_view view);
+
+/**
+ * Default constructor. Creates an empty view
+ */
+constexpr superstring_view::superstring_view() noexcept
+    : m_data(nullptr), m_size(0) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] data The first character
+ * @param[in] size The number of characters
+ */
+constexpr superstring_view::superstring_view(const char* data,
+                                             std::size_t size) noexcept
+    : m_data(data), m_size(size) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] str A null-terminated string
+ */
+inline superstring_view::superstring_view(const char* str) noexcept
+    : m_data(str), m_size(std::strlen(str)) {
+}
+
+/**
+ * Constructor. Accepts a std::string with any allocator
+ *
+ * @param[in] str The string to view
+ */
+template <class Alloc>
+superstring_view::superstring_view(
+    const std::basic_string<char, std::char_traits<char>, Alloc>& str)
+    noexcept
+    : m_data(str.data()), m_size(str.size()) {
+}
+
+/**
+ * @return The first character
+ */
+constexpr const char* superstring_view::data() const noexcept {
+    return m_data;
+}
+
+/**
+ * @return The number of characters
+ */
+constexpr std::size_t superstring_view::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The number of characters
+ */
+constexpr std::size_t superstring_view::length() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return True if there are no characters
+ */
+constexpr bool superstring_view::empty() const noexcept {
+    return m_size == 0;
+}
+
+/**
+ * @return An iterator to the first character
+ */
+constexpr const char* superstring_view::begin() const noexcept {
+    return m_data;
+}
+
+/**
+ * @return An iterator past the last character
+ */
+constexpr const char* superstring_view::end() const noexcept {
+    return m_data + m_size;
+}
+
+/**
+ * @param[in] index The position of a character. Must be less than size()
+ *
+ * @return The character
+ */
+constexpr const char& superstring_view::operator[](std::size_t index) const
+    noexcept {
+    return m_data[index];
+}
+
+/**
+ * @return The first character. The view must not be empty
+ */
+constexpr const char& superstring_view::front() const noexcept {
+    return m_data[0];
+}
+
+/**
+ * @return The last character. The view must not be empty
+ */
+constexpr const char& superstring_view::back() const noexcept {
+    return m_data[m_size - 1];
+}
+
+/**
+ * Shrink the view from the front
+ *
+ * @param[in] n The number of characters to drop. Must not exceed size()
+ */
+inline void superstring_view::remove_prefix(std::size_t n) noexcept {
+    m_data += n;
+    m_size -= n;
+}
+
+/**
+ * Shrink the view from the back
+ *
+ * @param[in] n The number of characters to drop. Must not exceed size()
+ */
+inline void superstring_view::remove_suffix(std::size_t n) noexcept {
+    m_size -= n;
+}
+
+#if __cplusplus >= 201703L
+/**
+ * Conversion to the standard view type, where one is available
+ *
+ * @return A std::string_view of the same characters
+ */
+constexpr superstring_view::operator std::string_view() const noexcept {
+    return std::string_view(m_data, m_size);
+}
+#endif
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_SUPERSTRING_VIEW_H_
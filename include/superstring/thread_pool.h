@@ -0,0 +1,91 @@
+/**
+ *  \file   thread_pool.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_THREAD_POOL_H_
+#define UTILITY_INCLUDE_SUPERSTRING_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jfern {
+
+/**
+ * A fixed set of threads for fork-join parallelism. run() hands out a batch
+ * of numbered tasks, works on them alongside the pool's threads, and returns
+ * once all of them are done
+ *
+ * One batch runs at a time; concurrent calls to run() take turns. A task must
+ * not call run() on the pool it is running on
+ */
+class thread_pool final {
+ public:
+    explicit thread_pool(std::size_t threads = default_threads());
+
+    thread_pool(const thread_pool& pool)            = delete;
+    thread_pool(thread_pool&& pool)                 = delete;
+    thread_pool& operator=(const thread_pool& pool) = delete;
+    thread_pool& operator=(thread_pool&& pool)      = delete;
+    ~thread_pool();
+
+    std::size_t size() const noexcept;
+
+    void run(std::size_t tasks, const std::function<void(std::size_t)>& task);
+
+    static std::size_t default_threads() noexcept;
+
+ private:
+    void work();
+    void take_tasks();
+
+    /** The threads, not counting whichever thread calls run() */
+    std::vector<std::thread> m_threads;
+
+    /** Serializes calls to run() */
+    std::mutex m_run_mutex;
+
+    /** Guards everything below */
+    std::mutex m_mutex;
+
+    /** Signals the threads that a batch has started, or that they must exit */
+    std::condition_variable m_start;
+
+    /** Signals run() that the last task of a batch has finished */
+    std::condition_variable m_done;
+
+    /** The current batch's task */
+    const std::function<void(std::size_t)>* m_task;
+
+    /** The number of tasks in the current batch */
+    std::size_t m_tasks;
+
+    /** The next task to hand out */
+    std::size_t m_next;
+
+    /** The number of tasks not yet finished */
+    std::size_t m_pending;
+
+    /** Counts batches, so that threads can tell a new one has started */
+    std::size_t m_batch;
+
+    /** The first exception thrown by a task in the current batch */
+    std::exception_ptr m_error;
+
+    /** Set when the pool is being destroyed */
+    bool m_stop;
+};
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_THREAD_POOL_H_
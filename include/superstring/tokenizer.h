@@ -0,0 +1,234 @@
+/**
+ *  \file   tokenizer.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_TOKENIZER_H_
+#define UTILITY_INCLUDE_SUPERSTRING_TOKENIZER_H_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+#include "superstring/search.h"
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/**
+ * What separates one token from the next: a single character, a string of
+ * characters, or any one character from a set (see \ref any_of())
+ *
+ * A string delimiter is referenced, not copied, so its characters must
+ * outlive the delimiter. A character set is copied into a lookup table.
+ * Delimiters are found with the vectorized kernels in search.h
+ */
+class delimiter final {
+ public:
+    delimiter(char c) noexcept;                  // NOLINT
+    delimiter(const char* str) noexcept;         // NOLINT
+    delimiter(const std::string& str) noexcept;  // NOLINT
+    delimiter(superstring_view str) noexcept;    // NOLINT
+
+    delimiter(const delimiter& other)            = default;
+    delimiter(delimiter&& other)                 noexcept = default;
+    delimiter& operator=(const delimiter& other) = default;
+    delimiter& operator=(delimiter&& other)      noexcept = default;
+    ~delimiter()                                 = default;
+
+    static delimiter any_of(superstring_view chars) noexcept;
+
+    std::size_t find(superstring_view text, std::size_t pos,
+                     std::size_t* length) const noexcept;
+
+ private:
+    /** The ways tokens can be separated */
+    enum class kind {
+        character,
+        substring,
+        any_of
+    };
+
+    delimiter() noexcept;
+
+    /** How tokens are separated */
+    kind m_kind;
+
+    /** The delimiting character, for kind::character */
+    char m_char;
+
+    /** The delimiting string, for kind::substring */
+    superstring_view m_str;
+
+    /** The delimiting characters, for kind::any_of */
+    search::char_class m_set;
+};
+
+/**
+ * Whether a tokenizer reports the empty tokens between adjacent delimiters
+ * (and before a leading or after a trailing one)
+ */
+enum class empty_tokens {
+    drop,
+    keep
+};
+
+/**
+ * A lazily evaluated range of the tokens in a string. Nothing is searched
+ * until the range is iterated, and each increment only scans as far as the
+ * next delimiter, so a parser that needs the first few fields of a line
+ * never looks at the rest of it
+ *
+ * Tokens are views into the original characters, which must outlive the
+ * range. Iterators refer to the range they came from, so the range must
+ * also outlive them
+ */
+class tokenizer final {
+ public:
+    class iterator;
+
+    tokenizer(superstring_view text, delimiter delim,
+              empty_tokens empties = empty_tokens::drop,
+              std::size_t max_tokens = superstring_view::npos) noexcept;
+
+    tokenizer(const tokenizer& range)            = default;
+    tokenizer(tokenizer&& range)                 noexcept = default;
+    tokenizer& operator=(const tokenizer& range) = default;
+    tokenizer& operator=(tokenizer&& range)      noexcept = default;
+    ~tokenizer()                                 = default;
+
+    iterator begin() const noexcept;
+    iterator end()   const noexcept;
+
+ private:
+    /** The string being tokenized */
+    superstring_view m_text;
+
+    /** What separates the tokens */
+    delimiter m_delimiter;
+
+    /** Whether to report empty tokens */
+    empty_tokens m_empties;
+
+    /** The most tokens to produce. The last one holds the remaining text */
+    std::size_t m_max_tokens;
+};
+
+/**
+ * A forward iterator over the tokens of a \ref tokenizer
+ */
+class tokenizer::iterator final {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = superstring_view;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const superstring_view*;
+    using reference         = const superstring_view&;
+
+    iterator() noexcept;
+
+    iterator(const iterator& other)            = default;
+    iterator(iterator&& other)                 noexcept = default;
+    iterator& operator=(const iterator& other) = default;
+    iterator& operator=(iterator&& other)      noexcept = default;
+    ~iterator()                                = default;
+
+    reference operator*()  const noexcept;
+    pointer   operator->() const noexcept;
+
+    iterator& operator++() noexcept;
+    iterator  operator++(int) noexcept;
+
+    bool operator==(const iterator& other) const noexcept;
+    bool operator!=(const iterator& other) const noexcept;
+
+ private:
+    friend class tokenizer;
+
+    explicit iterator(const tokenizer* range) noexcept;
+
+    void advance() noexcept;
+
+    /** The range being iterated, or nullptr once past the last token */
+    const tokenizer* m_range;
+
+    /** The current token */
+    superstring_view m_token;
+
+    /** Where the next token begins, or npos after the last token */
+    std::size_t m_next;
+
+    /** The number of tokens produced so far */
+    std::size_t m_count;
+};
+
+tokenizer tokenize(superstring_view text, delimiter delim = ' ',
+                   empty_tokens empties = empty_tokens::drop) noexcept;
+
+tokenizer split_n(superstring_view text, std::size_t n,
+                  delimiter delim = ' ',
+                  empty_tokens empties = empty_tokens::drop) noexcept;
+
+/**
+ * @return The current token
+ */
+inline const superstring_view& tokenizer::iterator::operator*() const
+    noexcept {
+    return m_token;
+}
+
+/**
+ * @return The current token
+ */
+inline const superstring_view* tokenizer::iterator::operator->() const
+    noexcept {
+    return &m_token;
+}
+
+/**
+ * Move to the next token
+ *
+ * @return *this
+ */
+inline tokenizer::iterator& tokenizer::iterator::operator++() noexcept {
+    advance();
+    return *this;
+}
+
+/**
+ * Move to the next token
+ *
+ * @return A copy of this iterator from before the increment
+ */
+inline tokenizer::iterator tokenizer::iterator::operator++(int) noexcept {
+    iterator copy = *this;
+    advance();
+    return copy;
+}
+
+/**
+ * @return True if both iterators are past the end, or both refer to the same
+ *         token of the same range
+ */
+inline bool tokenizer::iterator::operator==(const iterator& other) const
+    noexcept {
+    return m_range == other.m_range &&
+           (m_range == nullptr || m_count == other.m_count);
+}
+
+/**
+ * @return True if the iterators refer to different tokens
+ */
+inline bool tokenizer::iterator::operator!=(const iterator& other) const
+    noexcept {
+    return !(*this == other);
+}
+
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_TOKENIZER_H_
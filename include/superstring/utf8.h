@@ -0,0 +1,57 @@
+/**
+ *  \file   utf8.h
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#ifndef UTILITY_INCLUDE_SUPERSTRING_UTF8_H_
+#define UTILITY_INCLUDE_SUPERSTRING_UTF8_H_
+
+#include <cstddef>
+#include <string>
+
+#include "superstring/superstring_view.h"
+
+namespace jfern {
+
+/**
+ * UTF-8 text: validation, counting code points, and case conversion that,
+ * unlike superstring::to_lower() and the functions in case_map.h, does not
+ * depend on the locale and never splits a multi-byte sequence
+ *
+ * Valid UTF-8 is as the Unicode standard defines it: no overlong encodings,
+ * surrogates or code points past U+10FFFF. Validation uses the vector kernels
+ * selected by search::active_level(). With AVX2, each 32-byte block is
+ * checked with table lookups on the high and low nibbles of neighboring
+ * bytes (Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction
+ * Per Byte", 2021); otherwise, runs of ASCII are skipped a vector at a time
+ * and everything else is decoded one sequence at a time
+ *
+ * Case conversion uses the simple (one code point to one code point)
+ * mappings of the Unicode Character Database, version 14.0, compiled into
+ * tables of runs. ASCII is converted a vector at a time, and only the rest is
+ * decoded and looked up. Bytes that are not valid UTF-8 are copied as they
+ * are
+ */
+namespace utf8 {
+
+bool        valid(superstring_view text) noexcept;
+std::size_t find_invalid(superstring_view text) noexcept;
+std::size_t length(superstring_view text) noexcept;
+
+char32_t fold(char32_t c) noexcept;
+char32_t lower(char32_t c) noexcept;
+char32_t upper(char32_t c) noexcept;
+
+std::string fold_case(superstring_view text);
+std::string to_lower(superstring_view text);
+std::string to_upper(superstring_view text);
+
+}  // namespace utf8
+}  // namespace jfern
+
+#endif  // UTILITY_INCLUDE_SUPERSTRING_UTF8_H_
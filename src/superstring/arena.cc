@@ -0,0 +1,145 @@
+/**
+ *  \file   arena.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/arena.h"
+
+#include <cstdint>
+
+namespace jfern {
+
+constexpr std::size_t arena::default_block_size;
+
+namespace {
+
+/*
+ * Round a pointer up to a multiple of the alignment, which must be a power
+ * of two
+ */
+char* align_up(char* ptr, std::size_t alignment) {
+    const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+    return ptr + ((alignment - addr % alignment) % alignment);
+}
+
+}  // namespace
+
+/**
+ * Constructor. No memory is obtained until the first allocation
+ *
+ * @param[in] block_size The size of each block to obtain from the global
+ *                       heap. Allocations larger than this get a block of
+ *                       their own
+ */
+arena::arena(std::size_t block_size)
+    : m_head(nullptr),
+      m_cursor(nullptr),
+      m_end(nullptr),
+      m_block_size(block_size),
+      m_blocks(0),
+      m_used(0),
+      m_reserved(0) {
+}
+
+/**
+ * Destructor. Returns every block to the global heap
+ */
+arena::~arena() {
+    release();
+
+    if (m_head) ::operator delete(m_head);
+}
+
+/**
+ * Allocate storage
+ *
+ * @param[in] size      The number of bytes
+ * @param[in] alignment The required alignment, a power of two
+ *
+ * @return The storage, valid until \ref release() is called or the arena is
+ *         destroyed
+ */
+void* arena::allocate(std::size_t size, std::size_t alignment) {
+    char* start = m_head ? align_up(m_cursor, alignment) : nullptr;
+
+    if (!m_head || size > static_cast<std::size_t>(m_end - start)) {
+        grow(size, alignment);
+        start = align_up(m_cursor, alignment);
+    }
+
+    m_used  += (start + size) - m_cursor;
+    m_cursor = start + size;
+
+    return start;
+}
+
+/**
+ * Give back storage. Only the most recent allocation is actually reclaimed;
+ * anything else stays in use until the arena is released
+ *
+ * @param[in] ptr  Storage obtained from \ref allocate()
+ * @param[in] size The number of bytes it was allocated with
+ */
+void arena::deallocate(void* ptr, std::size_t size) noexcept {
+    char* start = static_cast<char*>(ptr);
+
+    if (start + size == m_cursor) {
+        m_used  -= size;
+        m_cursor = start;
+    }
+}
+
+/**
+ * Reclaim everything allocated so far. One block is kept for reuse, so an
+ * arena that is released after each request settles into making no calls
+ * to the global heap at all
+ */
+void arena::release() noexcept {
+    if (!m_head) return;
+
+    while (m_head->next) {
+        block* next = m_head->next;
+        m_reserved -= m_head->size;
+        ::operator delete(m_head);
+        m_head = next;
+    }
+
+    m_blocks = 1;
+    m_used   = 0;
+    m_cursor = reinterpret_cast<char*>(m_head + 1);
+    m_end    = reinterpret_cast<char*>(m_head) + m_head->size;
+}
+
+/**
+ * Start a new block, big enough for at least one allocation
+ *
+ * @param[in] size      The size of the allocation that did not fit
+ * @param[in] alignment Its alignment
+ */
+void arena::grow(std::size_t size, std::size_t alignment) {
+    if (size > std::numeric_limits<std::size_t>::max() - sizeof(block) -
+                   alignment) {
+        throw std::bad_alloc();
+    }
+
+    std::size_t total = sizeof(block) + size + alignment;
+    if (total < m_block_size) total = m_block_size;
+
+    block* fresh = static_cast<block*>(::operator new(total));
+    fresh->next = m_head;
+    fresh->size = total;
+
+    m_head   = fresh;
+    m_cursor = reinterpret_cast<char*>(fresh + 1);
+    m_end    = reinterpret_cast<char*>(fresh) + total;
+
+    m_blocks++;
+    m_reserved += total;
+}
+
+}  // namespace jfern
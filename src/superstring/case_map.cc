@@ -0,0 +1,164 @@
+/**
+ *  \file   case_map.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/case_map.h"
+
+#include <cctype>
+
+#include "superstring/search.h"
+
+/*
+ * As in search.cc, the vector kernels carry their own target attributes and
+ * are only called when search::active_level() says the CPU has them
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILITY_CASE_MAP_X86 1
+#include <immintrin.h>
+#define UTILITY_TARGET_SSE2 __attribute__((target("sse2")))
+#define UTILITY_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace jfern {
+namespace case_map {
+
+namespace {
+
+/*
+ * One byte at a time. ASCII letters have their case bit (0x20) flipped, and
+ * anything above 0x7f is handed to the locale
+ */
+void map_scalar(char* data, std::size_t size, bool upper) {
+    const unsigned int first = upper ? 'a' : 'A';
+
+    for (std::size_t i = 0; i < size; i++) {
+        const auto c = static_cast<unsigned char>(data[i]);
+
+        if (c > 0x7f) {
+            data[i] = static_cast<char>(upper ? std::toupper(c)
+                                              : std::tolower(c));
+        } else if (c - first < 26) {
+            data[i] = static_cast<char>(c ^ 0x20);
+        }
+    }
+}
+
+#ifdef UTILITY_CASE_MAP_X86
+
+UTILITY_TARGET_SSE2
+void map_block_sse2(char* data, char first) {
+    __m128i* block = reinterpret_cast<__m128i*>(data);
+    const __m128i bytes = _mm_loadu_si128(block);
+
+    /* The signed compares below are only valid for ASCII */
+    if (_mm_movemask_epi8(bytes) != 0) {
+        map_scalar(data, 16, first == 'a');
+        return;
+    }
+
+    const __m128i letters = _mm_and_si128(
+        _mm_cmpgt_epi8(bytes, _mm_set1_epi8(first - 1)),
+        _mm_cmplt_epi8(bytes, _mm_set1_epi8(first + 26)));
+    _mm_storeu_si128(block, _mm_xor_si128(
+        bytes, _mm_and_si128(letters, _mm_set1_epi8(0x20))));
+}
+
+UTILITY_TARGET_SSE2
+void map_sse2(char* data, std::size_t size, bool upper) {
+    const char first = upper ? 'a' : 'A';
+
+    if (size < 16) {
+        map_scalar(data, size, upper);
+        return;
+    }
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) map_block_sse2(data + i, first);
+
+    /*
+     * Mapping is idempotent, so the tail is finished with one last vector
+     * that overlaps bytes already done
+     */
+    if (i < size) map_block_sse2(data + size - 16, first);
+}
+
+UTILITY_TARGET_AVX2
+void map_block_avx2(char* data, char first) {
+    __m256i* block = reinterpret_cast<__m256i*>(data);
+    const __m256i bytes = _mm256_loadu_si256(block);
+
+    /* The signed compares below are only valid for ASCII */
+    if (_mm256_movemask_epi8(bytes) != 0) {
+        map_scalar(data, 32, first == 'a');
+        return;
+    }
+
+    const __m256i letters = _mm256_and_si256(
+        _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(first - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(first + 26), bytes));
+    _mm256_storeu_si256(block, _mm256_xor_si256(
+        bytes, _mm256_and_si256(letters, _mm256_set1_epi8(0x20))));
+}
+
+UTILITY_TARGET_AVX2
+void map_avx2(char* data, std::size_t size, bool upper) {
+    const char first = upper ? 'a' : 'A';
+
+    if (size < 32) {
+        map_sse2(data, size, upper);
+        return;
+    }
+
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) map_block_avx2(data + i, first);
+
+    if (i < size) map_block_avx2(data + size - 32, first);
+}
+
+#endif  // UTILITY_CASE_MAP_X86
+
+void map(char* data, std::size_t size, bool upper) {
+    switch (search::active_level()) {
+#ifdef UTILITY_CASE_MAP_X86
+      case search::level::avx2:
+        map_avx2(data, size, upper);
+        break;
+      case search::level::sse2:
+        map_sse2(data, size, upper);
+        break;
+#endif
+      default:
+        map_scalar(data, size, upper);
+    }
+}
+
+}  // namespace
+
+/**
+ * Convert characters to lower case, in place
+ *
+ * @param[in,out] data The characters
+ * @param[in]     size The number of characters
+ */
+void lower(char* data, std::size_t size) noexcept {
+    map(data, size, false);
+}
+
+/**
+ * Convert characters to upper case, in place
+ *
+ * @param[in,out] data The characters
+ * @param[in]     size The number of characters
+ */
+void upper(char* data, std::size_t size) noexcept {
+    map(data, size, true);
+}
+
+}  // namespace case_map
+}  // namespace jfern
@@ -0,0 +1,552 @@
+/**
+ *  \file   csv.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/csv.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ios>
+#include <utility>
+
+#include "bitops/bitops.h"
+#include "superstring/search.h"
+
+/*
+ * As in search.cc, the vector kernels are compiled with per-function target
+ * attributes and picked at run time. They move 64-bit masks in and out of
+ * vector registers, so they are for x86-64 only
+ */
+#if defined(__GNUC__) && defined(__x86_64__)
+#define UTILITY_CSV_X86 1
+#include <immintrin.h>
+#define UTILITY_TARGET_SSE2 __attribute__((target("sse2")))
+#define UTILITY_TARGET_AVX2 __attribute__((target("avx2,pclmul")))
+#endif
+
+namespace jfern {
+
+constexpr std::size_t csv_reader::default_buffer_size;
+constexpr std::size_t csv_reader::window_size;
+
+namespace {
+
+/** The bytes examined together, one per bit of a mask */
+constexpr std::size_t block_size = 64;
+
+/*
+ * What the index kernels look for
+ */
+struct index_options {
+    /** The field delimiter */
+    char delimiter;
+
+    /** The quote character */
+    char quote;
+
+    /** All ones if quoting is on, or zero to ignore quote characters */
+    std::uint64_t quoting;
+};
+
+/*
+ * Write the offsets of one block's separators (delimiters and newlines)
+ * that lie outside quotes. Offsets are written eight at a time whether or not
+ * there are that many, which is quicker than a branch per bit; the extras are
+ * garbage past the end, so \a out needs room for \ref block_size more
+ *
+ * @param[in]  separators The delimiters and newlines in the block
+ * @param[in]  inside     The mask of what lies inside quotes
+ * @param[in]  offset     The offset of the block
+ * @param[out] out        Where to write the offsets
+ *
+ * @return The number of offsets written
+ */
+inline std::size_t flatten(std::uint64_t separators, std::uint64_t inside,
+                           std::uint32_t offset, std::uint32_t* out) noexcept {
+    /* The top bit never changes the lowest bit set, but rules out zero */
+    const std::uint64_t top = std::uint64_t(1) << 63;
+
+    std::uint64_t bits = separators & ~inside;
+    const std::size_t count = bitops::count(bits);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        for (std::size_t j = 0; j < 8; j++) {
+            out[i + j] = offset + bitops::lsb(bits | top);
+            bits &= bits - 1;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Carry the quote state into the next block: all ones if the block ended
+ * inside quotes
+ */
+inline std::uint64_t carry(std::uint64_t inside) noexcept {
+    return static_cast<std::uint64_t>(
+        static_cast<std::int64_t>(inside) >> 63);
+}
+
+/*
+ * Scalar kernel. This also indexes the tails too short for a full block
+ */
+std::size_t index_scalar(const char* data, std::size_t size,
+                         std::uint32_t offset, const index_options& options,
+                         std::uint64_t* inside, std::uint32_t* out) {
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < size; i += block_size) {
+        const std::size_t length = std::min(block_size, size - i);
+
+        std::uint64_t quotes = 0, separators = 0;
+        for (std::size_t j = 0; j < length; j++) {
+            const char c = data[i + j];
+            quotes     |= std::uint64_t(c == options.quote) << j;
+            separators |= std::uint64_t(c == options.delimiter ||
+                                        c == '\n') << j;
+        }
+
+        const std::uint64_t mask =
+            bitops::prefix_xor(quotes & options.quoting) ^ *inside;
+
+        count += flatten(separators, mask,
+                         offset + static_cast<std::uint32_t>(i), out + count);
+        *inside = carry(mask);
+    }
+
+    return count;
+}
+
+#ifdef UTILITY_CSV_X86
+
+/*
+ * Vector kernels. These index whole blocks only, and return the number of
+ * bytes indexed in \a indexed
+ */
+
+UTILITY_TARGET_SSE2
+std::size_t index_sse2(const char* data, std::size_t size,
+                       std::uint32_t offset, const index_options& options,
+                       std::uint64_t* inside, std::uint32_t* out,
+                       std::size_t* indexed) {
+    const __m128i quote     = _mm_set1_epi8(options.quote);
+    const __m128i delimiter = _mm_set1_epi8(options.delimiter);
+    const __m128i newline   = _mm_set1_epi8('\n');
+
+    std::size_t count = 0, i = 0;
+    for (; i + block_size <= size; i += block_size) {
+        std::uint64_t quotes = 0, separators = 0;
+
+        for (int j = 0; j < 4; j++) {
+            const __m128i chunk = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(data + i + 16 * j));
+
+            const std::uint64_t q = static_cast<unsigned int>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)));
+            const std::uint64_t s = static_cast<unsigned int>(
+                _mm_movemask_epi8(
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, delimiter),
+                                 _mm_cmpeq_epi8(chunk, newline))));
+
+            quotes     |= q << (16 * j);
+            separators |= s << (16 * j);
+        }
+
+        const std::uint64_t mask =
+            bitops::prefix_xor(quotes & options.quoting) ^ *inside;
+
+        count += flatten(separators, mask,
+                         offset + static_cast<std::uint32_t>(i), out + count);
+        *inside = carry(mask);
+    }
+
+    *indexed = i;
+    return count;
+}
+
+UTILITY_TARGET_AVX2
+std::size_t index_avx2(const char* data, std::size_t size,
+                       std::uint32_t offset, const index_options& options,
+                       std::uint64_t* inside, std::uint32_t* out,
+                       std::size_t* indexed) {
+    const __m256i quote     = _mm256_set1_epi8(options.quote);
+    const __m256i delimiter = _mm256_set1_epi8(options.delimiter);
+    const __m256i newline   = _mm256_set1_epi8('\n');
+    const __m128i ones      = _mm_set1_epi8(-1);
+
+    std::size_t count = 0, i = 0;
+    for (; i + block_size <= size; i += block_size) {
+        const __m256i lo =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i hi = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i + 32));
+
+        const std::uint64_t quotes_lo = static_cast<unsigned int>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, quote)));
+        const std::uint64_t quotes_hi = static_cast<unsigned int>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, quote)));
+
+        const std::uint64_t separators_lo = static_cast<unsigned int>(
+            _mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(lo, delimiter),
+                                _mm256_cmpeq_epi8(lo, newline))));
+        const std::uint64_t separators_hi = static_cast<unsigned int>(
+            _mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(hi, delimiter),
+                                _mm256_cmpeq_epi8(hi, newline))));
+
+        const std::uint64_t quotes =
+            (quotes_lo | quotes_hi << 32) & options.quoting;
+        const std::uint64_t separators = separators_lo | separators_hi << 32;
+
+        /* Multiplying by all ones without carries is a prefix XOR */
+        const std::uint64_t mask = static_cast<std::uint64_t>(
+            _mm_cvtsi128_si64(_mm_clmulepi64_si128(
+                _mm_cvtsi64_si128(static_cast<long long>(quotes)),  // NOLINT
+                ones, 0))) ^ *inside;
+
+        count += flatten(separators, mask,
+                         offset + static_cast<std::uint32_t>(i), out + count);
+        *inside = carry(mask);
+    }
+
+    *indexed = i;
+    return count;
+}
+
+/*
+ * Check for the carry-less multiply the AVX2 kernel also needs
+ */
+bool has_clmul() noexcept {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("pclmul") != 0;
+    }();
+
+    return supported;
+}
+
+#endif  // UTILITY_CSV_X86
+
+/*
+ * Dispatch
+ */
+
+std::size_t build_index(const char* data, std::size_t size,
+                        const index_options& options, std::uint64_t* inside,
+                        std::uint32_t* out) {
+    std::size_t indexed = 0, count = 0;
+
+    switch (search::active_level()) {
+#ifdef UTILITY_CSV_X86
+      case search::level::avx2:
+        if (has_clmul()) {
+            count = index_avx2(data, size, 0, options, inside, out,
+                               &indexed);
+            break;
+        }
+        // fall through
+      case search::level::sse2:
+        count = index_sse2(data, size, 0, options, inside, out, &indexed);
+        break;
+#endif
+      default:
+        break;
+    }
+
+    return count + index_scalar(data + indexed, size - indexed,
+                                static_cast<std::uint32_t>(indexed), options,
+                                inside, out + count);
+}
+
+/*
+ * Make a field from its raw characters, removing the carriage return of a
+ * "\r\n" line ending and any enclosing quotes
+ *
+ * @param[in] data  The input
+ * @param[in] size  The size of the input
+ * @param[in] begin The offset of the field
+ * @param[in] end   The offset of the delimiter or newline after it
+ * @param[in] quote The quote character, or '\0'
+ *
+ * @return The field
+ */
+inline csv_field make_field(const char* data, std::size_t size,
+                            std::size_t begin, std::size_t end,
+                            char quote) noexcept {
+    if (end > begin && data[end - 1] == '\r' &&
+        (end == size || data[end] == '\n'))
+        end--;
+
+    if (quote != '\0' && end - begin >= 2 && data[begin] == quote &&
+        data[end - 1] == quote) {
+        const superstring_view text(data + begin + 1, end - begin - 2);
+        const bool escaped =
+            std::memchr(text.data(), quote, text.size()) != nullptr;
+
+        return csv_field(text, escaped ? quote : '\0');
+    }
+
+    return csv_field(superstring_view(data + begin, end - begin), '\0');
+}
+
+}  // namespace
+
+/**
+ * Default constructor. Creates an empty field
+ */
+csv_field::csv_field() noexcept : m_text(), m_quote('\0') {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text  The field's characters, without enclosing quotes
+ * @param[in] quote The quote character if \a text contains escaped quotes,
+ *                  or '\0' otherwise
+ */
+csv_field::csv_field(superstring_view text, char quote) noexcept
+    : m_text(text), m_quote(quote) {
+}
+
+/**
+ * @return The field's value, with escaped quotes undone
+ */
+std::string csv_field::str() const {
+    if (!escaped()) return std::string(m_text.data(), m_text.size());
+
+    std::string value;
+    value.reserve(m_text.size());
+
+    for (std::size_t i = 0; i < m_text.size(); i++) {
+        value.push_back(m_text[i]);
+        if (m_text[i] == m_quote) i++;
+    }
+
+    return value;
+}
+
+/**
+ * Default constructor. Creates a record with no fields
+ */
+csv_record::csv_record() noexcept : m_fields(nullptr), m_size(0) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] fields The first field
+ * @param[in] size   The number of fields
+ */
+csv_record::csv_record(const csv_field* fields, std::size_t size) noexcept
+    : m_fields(fields), m_size(size) {
+}
+
+/**
+ * Construct a reader over text in memory. Nothing is copied, so the text
+ * must outlive the reader and the records it returns
+ *
+ * @param[in] text      The text
+ * @param[in] delimiter The character that separates fields
+ * @param[in] quote     The quote character, or '\0' for none
+ */
+csv_reader::csv_reader(superstring_view text, char delimiter, char quote)
+    : csv_reader(delimiter, quote) {
+    m_data = text.data();
+    m_size = text.size();
+}
+
+/**
+ * Construct a reader over a stream, which is read a buffer at a time
+ *
+ * @param[in] stream      The stream, which must outlive the reader
+ * @param[in] delimiter   The character that separates fields
+ * @param[in] quote       The quote character, or '\0' for none
+ * @param[in] buffer_size The initial size of the buffer
+ */
+csv_reader::csv_reader(std::istream& stream, char delimiter, char quote,
+                       std::size_t buffer_size)
+    : csv_reader(delimiter, quote) {
+    m_stream   = &stream;
+    m_capacity = std::max<std::size_t>(buffer_size, 1);
+    m_buffer.reset(new char[m_capacity]);
+    m_data     = m_buffer.get();
+}
+
+/**
+ * Constructor for the members common to both sources
+ *
+ * @param[in] delimiter The character that separates fields
+ * @param[in] quote     The quote character, or '\0' for none
+ */
+csv_reader::csv_reader(char delimiter, char quote)
+    : m_stream(nullptr),
+      m_buffer(),
+      m_capacity(0),
+      m_eof(false),
+      m_data(nullptr),
+      m_size(0),
+      m_indexed(0),
+      m_inside(0),
+      m_window(0),
+      m_index(new std::uint32_t[window_size + block_size]),
+      m_index_size(0),
+      m_next(0),
+      m_start(0),
+      m_fields(),
+      m_records(0),
+      m_delimiter(delimiter),
+      m_quote(quote) {
+}
+
+/**
+ * Read the next record
+ *
+ * @param[out] record The record, whose fields are valid until the next call
+ *
+ * @return True on success, or false at the end of the input
+ *
+ * @throws std::invalid_argument if the input ends inside a quoted field, or
+ *         std::ios_base::failure if reading the stream fails
+ */
+bool csv_reader::next(csv_record* record) {
+    std::size_t fields = 0;
+    std::size_t field = m_start;
+
+    while (true) {
+        if (m_next == m_index_size) {
+            if (m_indexed < m_size) {
+                index_window();
+                continue;
+            }
+
+            /* Refilling moves the record being read, so start it over */
+            if (refill()) {
+                fields = 0;
+                field = m_start;
+                continue;
+            }
+
+            if (m_inside)
+                throw std::invalid_argument(
+                    "csv_reader: input ends inside a quoted field");
+
+            if (field == m_size && fields == 0) return false;
+
+            if (m_fields.size() == fields) m_fields.resize(fields + 1);
+            m_fields[fields++] =
+                make_field(m_data, m_size, field, m_size, m_quote);
+
+            m_start = m_size;
+            break;
+        }
+
+        /* Make room for every field left in the window, at most */
+        const std::size_t room = fields + m_index_size - m_next;
+        if (m_fields.size() < room)
+            m_fields.resize(std::max(room, 2 * m_fields.size()));
+
+        /* Keep the hot state in locals, where stores can't alias it */
+        const char* const data = m_data;
+        const std::size_t size = m_size;
+        const char quote = m_quote;
+        const std::uint32_t* const index = m_index.get();
+        const std::size_t window = m_window;
+        const std::size_t count = m_index_size;
+        csv_field* const out = m_fields.data();
+        std::size_t next = m_next;
+        bool ended = false;
+
+        while (next < count && !ended) {
+            const std::size_t end = window + index[next++];
+            out[fields++] = make_field(data, size, field, end, quote);
+            field = end + 1;
+            ended = data[end] == '\n';
+        }
+
+        m_next = next;
+        if (ended) {
+            m_start = field;
+            break;
+        }
+    }
+
+    m_records++;
+    *record = csv_record(m_fields.data(), fields);
+    return true;
+}
+
+/**
+ * @return The number of records read so far
+ */
+std::size_t csv_reader::records() const noexcept {
+    return m_records;
+}
+
+/**
+ * Index the next window of input
+ */
+void csv_reader::index_window() {
+    const std::size_t size = std::min(window_size, m_size - m_indexed);
+
+    const index_options options = {
+        m_delimiter, m_quote,
+        m_quote == '\0' ? std::uint64_t(0) : ~std::uint64_t(0)
+    };
+
+    m_index_size = build_index(m_data + m_indexed, size, options, &m_inside,
+                               m_index.get());
+    m_window = m_indexed;
+    m_next   = 0;
+    m_indexed += size;
+}
+
+/**
+ * Read more of the stream into the buffer. What is left of the current
+ * record moves to the front, and is indexed again from its start, which is
+ * outside quotes. If it fills the buffer, the buffer doubles in size
+ *
+ * @return True if the buffer was refilled, or false if there is no stream or
+ *         it has been read to the end
+ */
+bool csv_reader::refill() {
+    if (!m_stream || m_eof) return false;
+
+    const std::size_t kept = m_size - m_start;
+
+    if (kept == m_capacity) {
+        std::unique_ptr<char[]> buffer(new char[2 * m_capacity]);
+        std::memcpy(buffer.get(), m_buffer.get(), kept);
+
+        m_buffer = std::move(buffer);
+        m_capacity *= 2;
+    } else if (m_start > 0) {
+        std::memmove(m_buffer.get(), m_buffer.get() + m_start, kept);
+    }
+
+    m_stream->read(m_buffer.get() + kept,
+                   static_cast<std::streamsize>(m_capacity - kept));
+    if (m_stream->bad())
+        throw std::ios_base::failure("csv_reader: read failed");
+
+    m_eof = !*m_stream;
+
+    m_data       = m_buffer.get();
+    m_size       = kept + static_cast<std::size_t>(m_stream->gcount());
+    m_start      = 0;
+    m_indexed    = 0;
+    m_inside     = 0;
+    m_index_size = 0;
+    m_next       = 0;
+
+    return true;
+}
+
+}  // namespace jfern
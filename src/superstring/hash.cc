@@ -0,0 +1,346 @@
+/**
+ *  \file   hash.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/hash.h"
+
+#include "superstring/search.h"
+
+/*
+ * As in search.cc, the vector kernels carry their own target attributes and
+ * are only called when search::active_level() says the CPU has them
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILITY_HASH_X86 1
+#include <immintrin.h>
+#define UTILITY_TARGET_SSE2 __attribute__((target("sse2")))
+#define UTILITY_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace jfern {
+namespace detail {
+
+namespace {
+
+/** Keys longer than this go to the accumulators */
+constexpr std::size_t medium_size = 1024;
+
+/** The bytes taken into the accumulators at a time */
+constexpr std::size_t stripe_size = 64;
+
+/** The stripes taken between scrambles of the accumulators */
+constexpr std::size_t block_stripes = 16;
+
+
+/*
+ * Each stripe is XOR-ed with eight words of the secret, starting one word
+ * further in than for the stripe before; the scramble uses the eight words
+ * after that
+ */
+constexpr std::size_t secret_words = block_stripes + 8;
+
+/** The secret words for the last stripe */
+constexpr std::size_t last_stripe_key = 13;
+
+/** The secret words for merging the accumulators */
+constexpr std::size_t merge_key = 2;
+
+/** The secret, from a splitmix64 sequence */
+constexpr std::uint64_t secret[secret_words] = {
+    0x2cb0f69f4abea221ull, 0x9417034723148989ull, 0xdd555950609dfe03ull,
+    0xdbafb150deb12800ull, 0x7e789b2e6c442cb6ull, 0xf41e5636c7e4f8c4ull,
+    0x0959d150f8fba7e4ull, 0xa97316f13cdb9eeaull, 0x74cd8258f9520068ull,
+    0x55c74a62e116868bull, 0xd2f4c799a2023cbdull, 0xdf98cb79a37b51b9ull,
+    0x396f5885524f3905ull, 0xaf1d56386ca3b276ull, 0xa9ffbe6b5104e85aull,
+    0x6bd0c51b9fd533b3ull, 0x980ce91c50ab4b56ull, 0x28ac395780fe62c5ull,
+    0x768912e3a6bcedc7ull, 0x50b3e8c9332c7c88ull, 0xce3bbfe520bd47daull,
+    0xcba6c8e8e0bb7c4full, 0xbf194db8434a346dull, 0x7d8f2a7b60416d7full
+};
+
+/** The primes of xxHash */
+constexpr std::uint32_t prime32_1 = 0x9e3779b1u;
+constexpr std::uint32_t prime32_2 = 0x85ebca77u;
+constexpr std::uint32_t prime32_3 = 0xc2b2ae3du;
+constexpr std::uint64_t prime64_1 = 0x9e3779b185ebca87ull;
+constexpr std::uint64_t prime64_2 = 0xc2b2ae3d27d4eb4full;
+constexpr std::uint64_t prime64_3 = 0x165667b19e3779f9ull;
+constexpr std::uint64_t prime64_4 = 0x85ebca77c2b2ae63ull;
+constexpr std::uint64_t prime64_5 = 0x27d4eb2f165667c5ull;
+
+std::uint64_t read8(const unsigned char* data) noexcept {
+    std::uint64_t word;
+    std::memcpy(&word, data, 8);
+    return word;
+}
+
+/*
+ * wyhash's rounds: three lanes of 16 bytes at a time while more than 48
+ * bytes are left, then one lane, finishing with the last 16 bytes
+ */
+std::uint64_t hash_medium(const unsigned char* data, std::size_t size,
+                          std::uint64_t seed) noexcept {
+    const std::size_t total = size;
+
+    seed ^= hash_mix(seed ^ hash_k0, hash_k1);
+
+    if (size > 48) {
+        std::uint64_t lane1 = seed, lane2 = seed;
+        do {
+            seed  = hash_mix(read8(data)      ^ hash_k1,
+                             read8(data + 8)  ^ seed);
+            lane1 = hash_mix(read8(data + 16) ^ hash_k2,
+                             read8(data + 24) ^ lane1);
+            lane2 = hash_mix(read8(data + 32) ^ hash_k3,
+                             read8(data + 40) ^ lane2);
+            data += 48;
+            size -= 48;
+        } while (size > 48);
+
+        seed ^= lane1 ^ lane2;
+    }
+
+    for (; size > 16; data += 16, size -= 16)
+        seed = hash_mix(read8(data) ^ hash_k1, read8(data + 8) ^ seed);
+
+    return hash_finish(read8(data + size - 16), read8(data + size - 8), seed,
+                       total);
+}
+
+/*
+ * The accumulator kernels. Each takes every stripe of the key into the eight
+ * accumulators: the stripe's words, XOR-ed with the secret, have their
+ * halves multiplied together, and each word is also added to its neighbor's
+ * accumulator so that no input is lost when a product is zero. After each
+ * block of stripes, the accumulators are scrambled. A last stripe, which may
+ * overlap the one before it, covers the end of the key
+ *
+ * The stripes are all taken in one loop, so that the accumulators stay in
+ * registers
+ */
+
+/*
+ * The number of whole stripes before the last one, which, as a stripe
+ * taken from the end of the key, may overlap them
+ */
+std::size_t leading_stripes(std::size_t size) noexcept {
+    return (size - 1) / stripe_size;
+}
+
+void accumulate_scalar(std::uint64_t* acc, const unsigned char* data,
+                       std::size_t size, const std::uint64_t* key) noexcept {
+    const std::size_t stripes = leading_stripes(size);
+
+    for (std::size_t n = 0; n <= stripes; n++) {
+        const bool last = n == stripes;
+        const std::size_t s = n % block_stripes;
+
+        const unsigned char* const stripe =
+            last ? data + size - stripe_size : data + n * stripe_size;
+        const std::uint64_t* const stripe_key =
+            key + (last ? last_stripe_key : s);
+
+        for (std::size_t i = 0; i < 8; i++) {
+            const std::uint64_t word = read8(stripe + 8 * i);
+            const std::uint64_t keyed = word ^ stripe_key[i];
+
+            acc[i ^ 1] += word;
+            acc[i] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+        }
+
+        if (s == block_stripes - 1 && !last) {
+            for (std::size_t i = 0; i < 8; i++) {
+                acc[i] ^= acc[i] >> 47;
+                acc[i] ^= key[block_stripes + i];
+                acc[i] *= prime32_1;
+            }
+        }
+    }
+}
+
+#ifdef UTILITY_HASH_X86
+
+UTILITY_TARGET_SSE2
+void accumulate_sse2(std::uint64_t* acc_out, const unsigned char* data,
+                     std::size_t size, const std::uint64_t* key) noexcept {
+    __m128i acc[4];
+    for (int i = 0; i < 4; i++) {
+        acc[i] = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(acc_out + 2 * i));
+    }
+
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(prime32_1));
+    const std::size_t stripes = leading_stripes(size);
+
+    for (std::size_t n = 0; n <= stripes; n++) {
+        const bool last = n == stripes;
+        const std::size_t s = n % block_stripes;
+
+        const unsigned char* const stripe =
+            last ? data + size - stripe_size : data + n * stripe_size;
+        const std::uint64_t* const stripe_key =
+            key + (last ? last_stripe_key : s);
+
+        for (int i = 0; i < 4; i++) {
+            const __m128i word = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(stripe + 16 * i));
+            const __m128i keyed = _mm_xor_si128(word, _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(stripe_key + 2 * i)));
+
+            const __m128i product =
+                _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+            const __m128i swapped =
+                _mm_shuffle_epi32(word, _MM_SHUFFLE(1, 0, 3, 2));
+
+            acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(product, swapped));
+        }
+
+        if (s == block_stripes - 1 && !last) {
+            for (int i = 0; i < 4; i++) {
+                __m128i value =
+                    _mm_xor_si128(acc[i], _mm_srli_epi64(acc[i], 47));
+                value = _mm_xor_si128(value, _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(
+                        key + block_stripes + 2 * i)));
+
+                /* A 64x32-bit multiply, from the two 32x32-bit halves */
+                const __m128i low  = _mm_mul_epu32(value, prime);
+                const __m128i high =
+                    _mm_mul_epu32(_mm_srli_epi64(value, 32), prime);
+                acc[i] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc_out + 2 * i), acc[i]);
+}
+
+UTILITY_TARGET_AVX2
+void accumulate_avx2(std::uint64_t* acc_out, const unsigned char* data,
+                     std::size_t size, const std::uint64_t* key) noexcept {
+    __m256i acc[2];
+    for (int i = 0; i < 2; i++) {
+        acc[i] = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(acc_out + 4 * i));
+    }
+
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(prime32_1));
+    const std::size_t stripes = leading_stripes(size);
+
+    for (std::size_t n = 0; n <= stripes; n++) {
+        const bool last = n == stripes;
+        const std::size_t s = n % block_stripes;
+
+        const unsigned char* const stripe =
+            last ? data + size - stripe_size : data + n * stripe_size;
+        const std::uint64_t* const stripe_key =
+            key + (last ? last_stripe_key : s);
+
+        for (int i = 0; i < 2; i++) {
+            const __m256i word = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(stripe + 32 * i));
+            const __m256i keyed = _mm256_xor_si256(word, _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(stripe_key + 4 * i)));
+
+            const __m256i product =
+                _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+            const __m256i swapped =
+                _mm256_shuffle_epi32(word, _MM_SHUFFLE(1, 0, 3, 2));
+
+            acc[i] =
+                _mm256_add_epi64(acc[i], _mm256_add_epi64(product, swapped));
+        }
+
+        if (s == block_stripes - 1 && !last) {
+            for (int i = 0; i < 2; i++) {
+                __m256i value =
+                    _mm256_xor_si256(acc[i], _mm256_srli_epi64(acc[i], 47));
+                value = _mm256_xor_si256(value, _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(
+                        key + block_stripes + 4 * i)));
+
+                const __m256i low  = _mm256_mul_epu32(value, prime);
+                const __m256i high =
+                    _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+                acc[i] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+            }
+        }
+    }
+
+    for (int i = 0; i < 2; i++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc_out + 4 * i),
+                            acc[i]);
+    }
+}
+
+#endif  // UTILITY_HASH_X86
+
+/*
+ * Keys too long for wyhash's rounds to keep up with memory
+ */
+std::uint64_t hash_accumulate(const unsigned char* data, std::size_t size,
+                              std::uint64_t seed) noexcept {
+    /* A seed moves the secret, as in XXH3 */
+    std::uint64_t seeded[secret_words];
+    const std::uint64_t* key = secret;
+    if (seed != 0) {
+        for (std::size_t i = 0; i < secret_words; i += 2) {
+            seeded[i]     = secret[i]     + seed;
+            seeded[i + 1] = secret[i + 1] - seed;
+        }
+        key = seeded;
+    }
+
+    std::uint64_t acc[8] = {prime32_3, prime64_1, prime64_2, prime64_3,
+                            prime64_4, prime32_2, prime64_5, prime32_1};
+
+    switch (search::active_level()) {
+#ifdef UTILITY_HASH_X86
+      case search::level::avx2:
+        accumulate_avx2(acc, data, size, key);
+        break;
+      case search::level::sse2:
+        accumulate_sse2(acc, data, size, key);
+        break;
+#endif
+      default:
+        accumulate_scalar(acc, data, size, key);
+    }
+
+    std::uint64_t hash = size * prime64_1;
+    for (std::size_t i = 0; i < 8; i += 2) {
+        hash += hash_mix(acc[i]     ^ key[merge_key + i],
+                         acc[i + 1] ^ key[merge_key + i + 1]);
+    }
+
+    /* XXH3's avalanche */
+    hash ^= hash >> 37;
+    hash *= 0x165667919e3779f9ull;
+    return hash ^ (hash >> 32);
+}
+
+}  // namespace
+
+/**
+ * Hash a key too long to hash inline
+ *
+ * @param[in] data The key
+ * @param[in] size The size of the key, more than \ref hash_short_size
+ * @param[in] seed The seed
+ *
+ * @return The hash
+ */
+std::uint64_t hash_long(const unsigned char* data, std::size_t size,
+                        std::uint64_t seed) noexcept {
+    return size <= medium_size ? hash_medium(data, size, seed)
+                               : hash_accumulate(data, size, seed);
+}
+
+}  // namespace detail
+}  // namespace jfern
@@ -0,0 +1,329 @@
+/**
+ *  \file   intern_pool.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/intern_pool.h"
+
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+#include "bitops/bitops.h"
+#include "superstring/hash.h"
+
+namespace jfern {
+
+constexpr intern_pool::id_type intern_pool::npos;
+constexpr std::size_t intern_pool::default_shards;
+constexpr std::size_t intern_pool::first_segment;
+constexpr std::size_t intern_pool::max_segments;
+
+namespace {
+
+/** The most shards a pool may have */
+constexpr std::size_t max_shards = 256;
+
+/** Each shard's strings are copied into blocks of this size */
+constexpr std::size_t storage_block_size = 16 * 1024;
+
+/** The number of slots in a shard's first table */
+constexpr std::size_t first_table = 64;
+
+/*
+ * The low bits of a string's hash select a shard, the middle bits a slot,
+ * and the top half is kept in the slot to rule out most mismatches without
+ * touching the string
+ */
+std::uint64_t hash_of(superstring_view str) noexcept {
+    return hash64(str);
+}
+
+}  // namespace
+
+/**
+ * Constructor
+ *
+ * @param[in] capacity The number of slots, a power of two
+ */
+intern_pool::table::table(std::size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<std::uint64_t>[capacity]) {
+    for (std::size_t i = 0; i < capacity; i++)
+        slots[i].store(0, std::memory_order_relaxed);
+}
+
+/**
+ * Constructor
+ */
+intern_pool::shard::shard()
+    : mutex(),
+      storage(storage_block_size),
+      current(nullptr),
+      tables(),
+      count(0),
+      bytes(0) {
+    for (auto& segment : segments) segment.store(nullptr);
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] shards The number of shards, which is rounded up to a power of
+ *                   two. More shards mean less contention but fewer IDs per
+ *                   shard (2^32 in all)
+ *
+ * @throws std::invalid_argument if \a shards is zero or more than 256
+ */
+intern_pool::intern_pool(std::size_t shards) : m_shards(), m_shard_bits(0) {
+    if (shards == 0 || shards > max_shards)
+        throw std::invalid_argument("intern_pool: between 1 and 256 shards");
+
+    while ((std::size_t(1) << m_shard_bits) < shards) m_shard_bits++;
+
+    m_shards.reset(new shard[std::size_t(1) << m_shard_bits]);
+}
+
+/**
+ * Destructor
+ */
+intern_pool::~intern_pool() {
+    for (std::size_t i = 0; i < (std::size_t(1) << m_shard_bits); i++) {
+        for (auto& segment : m_shards[i].segments)
+            delete[] segment.load();
+    }
+}
+
+/**
+ * Get the ID of a string, adding it to the pool if it is not already there.
+ * If it is, no lock is taken
+ *
+ * @param[in] str The string. It is copied if added
+ *
+ * @return The ID
+ *
+ * @throws std::length_error if the pool is out of IDs
+ */
+intern_pool::id_type intern_pool::intern(superstring_view str) {
+    const std::uint64_t hash = hash_of(str);
+    shard& part = m_shards[hash & ((std::size_t(1) << m_shard_bits) - 1)];
+
+    std::size_t index = lookup(part, hash, str);
+    if (index != superstring_view::npos) return make_id(hash, index);
+
+    std::lock_guard<std::mutex> lock(part.mutex);
+
+    /* Another thread may have added it since the lookup */
+    index = lookup(part, hash, str);
+    if (index != superstring_view::npos) return make_id(hash, index);
+
+    index = part.count.load(std::memory_order_relaxed);
+    if (index >= (std::size_t(npos) >> m_shard_bits))
+        throw std::length_error("intern_pool: out of IDs");
+
+    std::size_t segment, offset;
+    locate(index, &segment, &offset);
+
+    superstring_view* entries = part.segments[segment].load(
+        std::memory_order_relaxed);
+    if (!entries) {
+        entries = new superstring_view[first_segment << segment];
+        part.segments[segment].store(entries, std::memory_order_release);
+    }
+
+    char* copy = static_cast<char*>(part.storage.allocate(str.size(), 1));
+    if (!str.empty()) std::memcpy(copy, str.data(), str.size());
+
+    entries[offset] = superstring_view(copy, str.size());
+    insert(&part, hash, index);
+
+    part.bytes.fetch_add(str.size(), std::memory_order_relaxed);
+    part.count.store(index + 1, std::memory_order_release);
+
+    return make_id(hash, index);
+}
+
+/**
+ * Get the ID of a string without adding it. This takes no lock
+ *
+ * @param[in] str The string
+ *
+ * @return The ID, or \ref npos if the string has not been interned
+ */
+intern_pool::id_type intern_pool::find(superstring_view str) const noexcept {
+    const std::uint64_t hash = hash_of(str);
+    const shard& part =
+        m_shards[hash & ((std::size_t(1) << m_shard_bits) - 1)];
+
+    const std::size_t index = lookup(part, hash, str);
+
+    return index == superstring_view::npos ? npos : make_id(hash, index);
+}
+
+/**
+ * Get the string with a given ID. This takes no lock; it is safe to call
+ * concurrently with intern(), for any ID that has been returned by intern()
+ * or find()
+ *
+ * @param[in] id The ID
+ *
+ * @return A view of the string, valid for the life of the pool
+ *
+ * @throws std::out_of_range if no string has this ID
+ */
+superstring_view intern_pool::view(id_type id) const {
+    const shard& part = m_shards[id & ((1u << m_shard_bits) - 1)];
+    const std::size_t index = id >> m_shard_bits;
+
+    if (id == npos || index >= part.count.load(std::memory_order_acquire))
+        throw std::out_of_range("intern_pool: no string has that ID");
+
+    return entry(part, index);
+}
+
+/**
+ * @return The number of distinct strings in the pool
+ */
+std::size_t intern_pool::size() const noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < (std::size_t(1) << m_shard_bits); i++)
+        total += m_shards[i].count.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+/**
+ * @return The number of characters stored, i.e. the total length of the
+ *         distinct strings
+ */
+std::size_t intern_pool::bytes() const noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < (std::size_t(1) << m_shard_bits); i++)
+        total += m_shards[i].bytes.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+/**
+ * Search a shard's current table. A reader may see a table that has since
+ * been replaced, which can only cause a miss; intern() then tries again under
+ * the lock
+ *
+ * @param[in] part The shard
+ * @param[in] hash The string's hash
+ * @param[in] str  The string
+ *
+ * @return The string's index within the shard, or superstring_view::npos
+ */
+std::size_t intern_pool::lookup(const shard& part, std::uint64_t hash,
+                                superstring_view str) const noexcept {
+    const table* slots = part.current.load(std::memory_order_acquire);
+    if (!slots) return superstring_view::npos;
+
+    const std::uint64_t tag = hash >> 32;
+
+    for (std::size_t i = (hash >> 8) & slots->mask;;
+         i = (i + 1) & slots->mask) {
+        const std::uint64_t slot =
+            slots->slots[i].load(std::memory_order_acquire);
+        if (slot == 0) return superstring_view::npos;
+
+        if ((slot >> 32) == tag) {
+            const std::size_t index = (slot & 0xffffffffu) - 1;
+            if (entry(part, index) == str) return index;
+        }
+    }
+}
+
+/**
+ * Add a string, already stored, to its shard's table. The table is doubled
+ * whenever it would become more than half full. Call with the shard locked
+ *
+ * @param[in] part  The shard
+ * @param[in] hash  The string's hash
+ * @param[in] index The string's index within the shard
+ */
+void intern_pool::insert(shard* part, std::uint64_t hash, std::size_t index) {
+    auto place = [](table* slots, std::uint64_t hash, std::size_t index,
+                    std::memory_order order) {
+        std::size_t i = (hash >> 8) & slots->mask;
+        while (slots->slots[i].load(std::memory_order_relaxed) != 0)
+            i = (i + 1) & slots->mask;
+
+        slots->slots[i].store(((hash >> 32) << 32) | (index + 1), order);
+    };
+
+    table* slots = part->current.load(std::memory_order_relaxed);
+
+    if (!slots || 2 * (index + 1) > slots->mask + 1) {
+        const std::size_t capacity = slots ? 2 * (slots->mask + 1)
+                                           : first_table;
+
+        /*
+         * Readers may still be searching the old table, so it is kept until
+         * the pool is destroyed. The old tables add up to less than the
+         * current one
+         */
+        part->tables.emplace_back(new table(capacity));
+        slots = part->tables.back().get();
+
+        for (std::size_t i = 0; i < index; i++) {
+            place(slots, hash_of(entry(*part, i)), i,
+                  std::memory_order_relaxed);
+        }
+
+        part->current.store(slots, std::memory_order_release);
+    }
+
+    place(slots, hash, index, std::memory_order_release);
+}
+
+/**
+ * Get a stored string
+ *
+ * @param[in] part  The shard
+ * @param[in] index The string's index within the shard
+ *
+ * @return The string
+ */
+superstring_view intern_pool::entry(const shard& part, std::size_t index) const
+    noexcept {
+    std::size_t segment, offset;
+    locate(index, &segment, &offset);
+
+    return part.segments[segment].load(std::memory_order_acquire)[offset];
+}
+
+/**
+ * Build an ID
+ *
+ * @param[in] hash  The string's hash, whose low bits select its shard
+ * @param[in] index The string's index within the shard
+ *
+ * @return The ID
+ */
+intern_pool::id_type intern_pool::make_id(std::uint64_t hash,
+                                          std::size_t index) const noexcept {
+    return static_cast<id_type>(
+        (index << m_shard_bits) | (hash & ((1u << m_shard_bits) - 1)));
+}
+
+/**
+ * Find where a shard keeps the string with a given local index. Segment k
+ * holds first_segment * 2^k entries
+ *
+ * @param[in]  index   The local index
+ * @param[out] segment The segment
+ * @param[out] offset  The position within the segment
+ */
+void intern_pool::locate(std::size_t index, std::size_t* segment,
+                         std::size_t* offset) noexcept {
+    *segment = bitops::msb(index / first_segment + 1);
+    *offset  = index - first_segment * ((std::size_t(1) << *segment) - 1);
+}
+
+}  // namespace jfern
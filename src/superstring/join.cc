@@ -0,0 +1,175 @@
+/**
+ *  \file   join.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/join.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace jfern {
+
+constexpr std::size_t fd_sink::default_chunk_size;
+
+/**
+ * Constructor
+ *
+ * @param[in] data     The buffer to write into. Must outlive this sink
+ * @param[in] capacity The size of the buffer
+ */
+buffer_sink::buffer_sink(char* data, std::size_t capacity) noexcept
+    : m_data(data), m_capacity(capacity), m_size(0) {
+}
+
+/**
+ * Check that characters about to be written will fit
+ *
+ * @param[in] size The number of characters
+ *
+ * @throws std::length_error if they will not
+ */
+void buffer_sink::reserve(std::size_t size) const {
+    if (size > m_capacity - m_size)
+        throw std::length_error("buffer_sink: output exceeds the buffer");
+}
+
+/**
+ * Copy characters into the buffer
+ *
+ * @param[in] data The characters
+ * @param[in] size The number of characters
+ *
+ * @throws std::length_error if they do not fit, in which case nothing is
+ *         written
+ */
+void buffer_sink::write(const char* data, std::size_t size) {
+    reserve(size);
+
+    if (size > 0) std::memcpy(m_data + m_size, data, size);
+    m_size += size;
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] stream The stream to write to. Must outlive this sink
+ */
+ostream_sink::ostream_sink(std::ostream& stream) noexcept
+    : m_stream(stream) {
+}
+
+/**
+ * Write characters to the stream
+ *
+ * @param[in] data The characters
+ * @param[in] size The number of characters
+ */
+void ostream_sink::write(const char* data, std::size_t size) {
+    m_stream.write(data, static_cast<std::streamsize>(size));
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] fd         An open file descriptor. It is not closed by this
+ *                       sink
+ * @param[in] chunk_size Characters are gathered until there are this many,
+ *                       then written with a single system call
+ *
+ * @throws std::invalid_argument if \a chunk_size is zero
+ */
+fd_sink::fd_sink(int fd, std::size_t chunk_size)
+    : m_fd(fd), m_buffer(), m_chunk_size(chunk_size), m_size(0) {
+    if (chunk_size == 0)
+        throw std::invalid_argument("fd_sink: chunk size must be nonzero");
+
+    m_buffer.reset(new char[chunk_size]);
+}
+
+/**
+ * Destructor. Writes anything still buffered; errors at this point cannot
+ * be reported, so call flush() first to see them
+ */
+fd_sink::~fd_sink() {
+    try {
+        flush();
+    } catch (const std::system_error&) {
+    }
+}
+
+/**
+ * Write characters. They are buffered unless they fill a whole chunk on
+ * their own, in which case they are written directly
+ *
+ * @param[in] data The characters
+ * @param[in] size The number of characters
+ *
+ * @throws std::system_error if a write fails
+ */
+void fd_sink::write(const char* data, std::size_t size) {
+    if (size > m_chunk_size - m_size) flush();
+
+    if (size >= m_chunk_size) {
+        write_fully(data, size);
+    } else {
+        std::memcpy(m_buffer.get() + m_size, data, size);
+        m_size += size;
+    }
+}
+
+/**
+ * Write out whatever is buffered
+ *
+ * @throws std::system_error if the write fails
+ */
+void fd_sink::flush() {
+    const std::size_t size = m_size;
+    m_size = 0;
+
+    write_fully(m_buffer.get(), size);
+}
+
+/**
+ * Write characters to the file descriptor, retrying after partial writes
+ * and interruptions
+ *
+ * @param[in] data The characters
+ * @param[in] size The number of characters
+ *
+ * @throws std::system_error if a write fails
+ */
+void fd_sink::write_fully(const char* data, std::size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        const unsigned int request =
+            size > 0x40000000 ? 0x40000000 : static_cast<unsigned int>(size);
+        const int written = ::_write(m_fd, data, request);
+#else
+        const ssize_t written = ::write(m_fd, data, size);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::system_error(errno, std::generic_category(),
+                                    "fd_sink: write failed");
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+}  // namespace jfern
@@ -0,0 +1,384 @@
+/**
+ *  \file   matcher.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/matcher.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace jfern {
+
+constexpr std::size_t   match::npos;
+constexpr std::uint32_t matcher::match_bit;
+
+namespace {
+
+/** Marks a missing trie edge while the automaton is being built */
+constexpr std::uint32_t no_state = ~std::uint32_t(0);
+
+/*
+ * With prefilter::automatic, each use of the prefilter earns the number of
+ * bytes it skipped, less min_skip for the cost of the call. If the balance
+ * drops to -max_debt, the prefilter sits out the next backoff bytes
+ */
+constexpr std::ptrdiff_t min_skip = 8;
+constexpr std::ptrdiff_t max_debt = 16 * min_skip;
+constexpr std::size_t    backoff  = 4096;
+
+/*
+ * Bytes roughly from most to least common in text, logs and source code.
+ * Anything not listed is taken to be rarer than everything that is
+ */
+const char byte_ranking[] =
+    " etaoinsrhldcumfpgwybv\n.,-_=:/0123456789kx\"'()ETAOINSRHLDCUMFPGWYBVjqz"
+    "KXJQZ;[]{}<>@#$%&*+?!|\\^`~\t\r";
+
+/*
+ * Rank every byte by how common it is; lower is more common
+ */
+struct byte_ranks {
+    byte_ranks() {
+        for (std::size_t i = 0; i < 256; i++) rank[i] = 255;
+        for (std::size_t i = 0; i + 1 < sizeof(byte_ranking); i++)
+            rank[static_cast<unsigned char>(byte_ranking[i])] = i;
+    }
+
+    std::uint8_t rank[256];
+};
+
+const byte_ranks ranks;
+
+}  // namespace
+
+/**
+ * Check two matches for equality
+ *
+ * @param[in] a The first match
+ * @param[in] b The second match
+ *
+ * @return True if they are for the same pattern at the same position
+ */
+bool operator==(const match& a, const match& b) noexcept {
+    return a.pattern  == b.pattern  &&
+           a.position == b.position &&
+           a.length   == b.length;
+}
+
+/**
+ * Check two matches for inequality
+ *
+ * @param[in] a The first match
+ * @param[in] b The second match
+ *
+ * @return True if they differ
+ */
+bool operator!=(const match& a, const match& b) noexcept {
+    return !(a == b);
+}
+
+/**
+ * Constructor. Compiles the patterns
+ *
+ * @param[in] patterns The patterns, which are copied
+ * @param[in] mode     When to use the prefilter
+ *
+ * @throws std::length_error if the automaton is too large to index
+ */
+matcher::matcher(std::initializer_list<superstring_view> patterns,
+                 prefilter mode)
+    : matcher(patterns.begin(), patterns.end(), mode) {
+}
+
+/**
+ * Get one of the patterns
+ *
+ * @param[in] index The index of the pattern, in the order given
+ *
+ * @return The pattern
+ *
+ * @throws std::out_of_range if \a index is not less than size()
+ */
+superstring_view matcher::pattern(std::size_t index) const {
+    if (index >= size())
+        throw std::out_of_range("matcher: no pattern at that index");
+
+    return superstring_view(m_text.data() + m_offsets[index],
+                            m_offsets[index + 1] - m_offsets[index]);
+}
+
+/**
+ * Check if any pattern occurs in a text
+ *
+ * @param[in] text The text to search
+ *
+ * @return True if there is at least one match
+ */
+bool matcher::contains(superstring_view text) const noexcept {
+    return find_first(text).pattern != match::npos;
+}
+
+/**
+ * Find the first match in a text, stopping as soon as it is seen. This is
+ * the match that ends first; if several patterns end at the same position,
+ * the one given first to the constructor is reported
+ *
+ * @param[in] text The text to search
+ *
+ * @return The match, or one whose pattern is \ref match::npos if there is
+ *         none
+ */
+match matcher::find_first(superstring_view text) const noexcept {
+    match first = {match::npos, match::npos, 0};
+
+    auto report = [&](std::uint32_t row, std::size_t end) {
+        const std::size_t state = row / m_width;
+        const std::uint32_t pattern = m_outputs[m_output_offsets[state]];
+        const std::size_t length =
+            m_offsets[pattern + 1] - m_offsets[pattern];
+
+        first = {pattern, end + 1 - length, length};
+        return false;
+    };
+
+    if (m_mode != prefilter::off) {
+        scan<true>(text, report);
+    } else {
+        scan<false>(text, report);
+    }
+
+    return first;
+}
+
+/**
+ * Find every match in a text, including ones that overlap
+ *
+ * @param[in] text The text to search
+ *
+ * @return The matches, ordered by where they end and then by pattern index
+ */
+std::vector<match> matcher::find_all(superstring_view text) const {
+    std::vector<match> matches;
+
+    auto report = [&](std::uint32_t row, std::size_t end) {
+        const std::size_t state = row / m_width;
+
+        for (std::uint32_t i = m_output_offsets[state];
+             i < m_output_offsets[state + 1]; i++) {
+            const std::uint32_t pattern = m_outputs[i];
+            const std::size_t length =
+                m_offsets[pattern + 1] - m_offsets[pattern];
+
+            matches.push_back({pattern, end + 1 - length, length});
+        }
+
+        return true;
+    };
+
+    if (m_mode != prefilter::off) {
+        scan<true>(text, report);
+    } else {
+        scan<false>(text, report);
+    }
+
+    return matches;
+}
+
+/**
+ * Build the automaton
+ *
+ * @param[in] patterns The patterns. Empty ones never match
+ */
+void matcher::compile(const std::vector<superstring_view>& patterns) {
+    /*
+     * Copy the patterns, and give each distinct byte its own column. Column
+     * 0 stands for every byte that appears in no pattern
+     */
+    m_offsets.push_back(0);
+    for (superstring_view pattern : patterns) {
+        m_text.append(pattern.data(), pattern.size());
+        m_offsets.push_back(m_text.size());
+
+        if (pattern.empty()) continue;
+
+        std::size_t rarest = 0;
+        for (std::size_t i = 1; i < pattern.size(); i++) {
+            if (ranks.rank[static_cast<unsigned char>(pattern[i])] >
+                ranks.rank[static_cast<unsigned char>(pattern[rarest])])
+                rarest = i;
+        }
+
+        m_rare.insert(pattern[rarest]);
+        m_rare_offset = std::max(m_rare_offset, rarest);
+    }
+
+    m_width = 1;
+    for (char c : m_text) {
+        const auto byte = static_cast<unsigned char>(c);
+        if (m_columns[byte] == 0) m_columns[byte] = m_width++;
+    }
+
+    /* Build the trie. Each state is a row of m_width entries */
+    std::vector<std::uint32_t> next(m_width, no_state);
+    std::vector<std::vector<std::uint32_t>> outputs(1);
+
+    for (std::size_t i = 0; i < patterns.size(); i++) {
+        if (patterns[i].empty()) continue;
+
+        std::size_t state = 0;
+        for (char c : pattern(i)) {
+            const auto byte = static_cast<unsigned char>(c);
+            const std::size_t column = m_columns[byte];
+            const std::size_t edge = state * m_width + column;
+
+            if (next[edge] == no_state) {
+                next[edge] = outputs.size();
+                outputs.emplace_back();
+                next.resize(next.size() + m_width, no_state);
+            }
+
+            state = next[edge];
+        }
+
+        outputs[state].push_back(i);
+    }
+
+    const std::size_t count = outputs.size();
+    if (count * m_width >= match_bit)
+        throw std::length_error("matcher: too many states");
+
+    /*
+     * Visit the states breadth first, so that each state's failure link
+     * (the state for its longest proper suffix that is also in the trie) has
+     * been completed before the state itself. Missing edges are then filled
+     * in from the failure link, turning the trie into a DFA
+     */
+    std::vector<std::uint32_t> fail(count, 0);
+    std::vector<std::uint32_t> queue;
+    queue.reserve(count);
+
+    for (std::size_t column = 0; column < m_width; column++) {
+        std::uint32_t& target = next[column];
+        if (target == no_state) {
+            target = 0;
+        } else {
+            queue.push_back(target);
+        }
+    }
+
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        const std::uint32_t state = queue[head];
+
+        /* Patterns ending at the failure link also end here */
+        std::vector<std::uint32_t>& out = outputs[state];
+        const std::vector<std::uint32_t>& inherited = outputs[fail[state]];
+        std::vector<std::uint32_t> merged;
+        std::merge(out.begin(), out.end(), inherited.begin(), inherited.end(),
+                   std::back_inserter(merged));
+        out.swap(merged);
+
+        for (std::size_t column = 0; column < m_width; column++) {
+            std::uint32_t& target = next[state * m_width + column];
+            const std::uint32_t fallback =
+                next[fail[state] * m_width + column];
+
+            if (target == no_state) {
+                target = fallback;
+            } else {
+                fail[target] = fallback;
+                queue.push_back(target);
+            }
+        }
+    }
+
+    /* Store row offsets, flagging the states where some pattern ends */
+    m_table.resize(next.size());
+    for (std::size_t i = 0; i < next.size(); i++) {
+        m_table[i] = next[i] * m_width;
+        if (!outputs[next[i]].empty()) m_table[i] |= match_bit;
+    }
+
+    m_output_offsets.reserve(count + 1);
+    for (const std::vector<std::uint32_t>& out : outputs) {
+        m_output_offsets.push_back(m_outputs.size());
+        m_outputs.insert(m_outputs.end(), out.begin(), out.end());
+    }
+    m_output_offsets.push_back(m_outputs.size());
+}
+
+/**
+ * Run the automaton over a text
+ *
+ * @tparam Prefilter True to skip ahead with the prefilter whenever the
+ *                   automaton is back in its initial state
+ *
+ * @param[in] text   The text to scan
+ * @param[in] report Called with the row offset of each state where a
+ *                   pattern ends, and the position of the pattern's last
+ *                   byte. Scanning stops if this returns false
+ */
+template <bool Prefilter, class Report>
+void matcher::scan(superstring_view text, Report report) const {
+    const std::uint32_t* table = m_table.data();
+    const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+    const std::size_t size = text.size();
+
+    /* Where the prefilter may next be used */
+    std::size_t horizon = 0;
+    std::ptrdiff_t balance = 0;
+
+    std::uint32_t row = 0;
+    std::size_t i = 0;
+    while (i < size) {
+        if (Prefilter && row == 0 && i >= horizon) {
+            const std::size_t hit = search::find_first_of(
+                superstring_view(text.data() + i, size - i), m_rare);
+
+            /* Every match contains one of the rare bytes */
+            if (hit == superstring_view::npos) return;
+
+            /*
+             * Nothing can match until a rare byte is reached, and it is at
+             * most m_rare_offset bytes into the match. There is no need to
+             * look again until past it
+             */
+            const std::size_t skip =
+                hit > m_rare_offset ? hit - m_rare_offset : 0;
+
+            i += skip;
+            horizon = i + (hit - skip) + 1;
+
+            if (m_mode == prefilter::automatic) {
+                balance = std::min(balance + static_cast<std::ptrdiff_t>(skip)
+                                   - min_skip, max_debt);
+                if (balance <= -max_debt) {
+                    balance = 0;
+                    horizon = i + backoff;
+                }
+            }
+        }
+
+        /*
+         * Step the automaton up to the point where the prefilter may next
+         * be used, or a single byte if that has been reached
+         */
+        const std::size_t stop =
+            Prefilter ? std::min(size, std::max(horizon, i + 1)) : size;
+
+        for (; i < stop; i++) {
+            const std::uint32_t entry = table[row + m_columns[data[i]]];
+            row = entry & ~match_bit;
+
+            if ((entry & match_bit) && !report(row, i)) return;
+        }
+    }
+}
+
+}  // namespace jfern
@@ -0,0 +1,278 @@
+/**
+ *  \file   parallel.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/parallel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "superstring/case_map.h"
+#include "superstring/tokenizer.h"
+
+namespace jfern {
+namespace parallel {
+
+namespace {
+
+/** Chunks per thread, so that one slow chunk does not hold up the rest */
+constexpr std::size_t chunks_per_thread = 4;
+
+/*
+ * Choose how many chunks to divide an input into
+ */
+std::size_t chunk_count(const thread_pool& pool, std::size_t size) noexcept {
+    return std::max<std::size_t>(
+        1, std::min(pool.size() * chunks_per_thread, size / min_chunk_size));
+}
+
+/*
+ * Check if two occurrences of a separator can overlap, i.e. if some proper
+ * prefix of it is also a suffix (as in "aa" or "abab"). If so, an occurrence
+ * found by searching from an arbitrary position may not be one the
+ * sequential scan would split at
+ */
+bool overlaps_itself(superstring_view separator) noexcept {
+    for (std::size_t k = 1; k < separator.size(); k++) {
+        if (std::memcmp(separator.data(),
+                        separator.data() + separator.size() - k, k) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+/*
+ * Split a string as superstring::split() does, passing each token through
+ * a transform first. Chunk boundaries are placed just past an occurrence of
+ * the separator, so that each chunk splits into exactly the tokens the whole
+ * string has there
+ */
+template <class Transform>
+superstring::vector_type split_chunks(thread_pool& pool,
+                                      const superstring& str,
+                                      superstring_view separator,
+                                      Transform transform) {
+    const superstring_view text = str.view();
+    const std::size_t chunks = chunk_count(pool, text.size());
+
+    superstring::vector_type tokens;
+
+    if (separator.empty()) {
+        const superstring_view token = transform(text);
+        tokens.emplace_back(token.data(), token.size());
+        return tokens;
+    }
+
+    const delimiter delim(separator);
+
+    if (chunks == 1 || overlaps_itself(separator)) {
+        for (superstring_view token : tokenize(text, delim)) {
+            const superstring_view transformed = transform(token);
+            tokens.emplace_back(transformed.data(), transformed.size());
+        }
+
+        return tokens;
+    }
+
+    /* Each boundary is the end of the first separator after an even split */
+    std::vector<std::size_t> bounds(chunks + 1, text.size());
+    bounds[0] = 0;
+
+    pool.run(chunks - 1, [&](std::size_t i) {
+        std::size_t length = 0;
+        const std::size_t pos =
+            delim.find(text, (i + 1) * (text.size() / chunks), &length);
+
+        if (pos != superstring_view::npos) bounds[i + 1] = pos + length;
+    });
+
+    /* Find each chunk's tokens, then copy them into place */
+    std::vector<std::vector<superstring_view>> found(chunks);
+
+    pool.run(chunks, [&](std::size_t i) {
+        const superstring_view chunk(text.data() + bounds[i],
+                                     bounds[i + 1] - bounds[i]);
+
+        for (superstring_view token : tokenize(chunk, delim))
+            found[i].push_back(transform(token));
+    });
+
+    std::vector<std::size_t> offsets(chunks + 1, 0);
+    for (std::size_t i = 0; i < chunks; i++)
+        offsets[i + 1] = offsets[i] + found[i].size();
+
+    tokens.resize(offsets[chunks]);
+
+    pool.run(chunks, [&](std::size_t i) {
+        for (std::size_t j = 0; j < found[i].size(); j++)
+            tokens[offsets[i] + j].assign(found[i][j].data(),
+                                          found[i][j].size());
+    });
+
+    return tokens;
+}
+
+/*
+ * Apply a case mapping to a string in place, in chunks whose boundaries are
+ * 64-byte aligned so that no two threads write to the same cache line
+ */
+void map_chunks(thread_pool& pool, std::string* str,
+                void (*mapping)(char*, std::size_t)) {
+    const std::size_t size = str->size();
+    const std::size_t chunks = chunk_count(pool, size);
+
+    if (chunks == 1) {
+        if (size > 0) mapping(&(*str)[0], size);
+        return;
+    }
+
+    char* data = &(*str)[0];
+    const std::size_t alignment = 64;
+
+    pool.run(chunks, [&](std::size_t i) {
+        const std::size_t begin = i * (size / chunks) & ~(alignment - 1);
+        const std::size_t end = i + 1 == chunks
+            ? size : (i + 1) * (size / chunks) & ~(alignment - 1);
+
+        mapping(data + begin, end - begin);
+    });
+}
+
+}  // namespace
+
+/**
+ * Split a string into tokens, on several threads. The result is the same as
+ * that of superstring::split()
+ *
+ * @param[in] pool      The threads to use
+ * @param[in] str       The string to split
+ * @param[in] separator The delimiter. If its occurrences can overlap one
+ *                      another (as with "aa"), the string is split on the
+ *                      calling thread
+ *
+ * @return The tokens
+ */
+superstring::vector_type split(thread_pool& pool, const superstring& str,
+                               superstring_view separator) {
+    return split_chunks(pool, str, separator,
+                        [](superstring_view token) { return token; });
+}
+
+/**
+ * Split a string into tokens of a fixed size, on several threads. The result
+ * is the same as that of superstring::split(std::size_t)
+ *
+ * @param[in] pool The threads to use
+ * @param[in] str  The string to split
+ * @param[in] size The size of each token
+ *
+ * @return The tokens
+ */
+superstring::vector_type split(thread_pool& pool, const superstring& str,
+                               std::size_t size) {
+    const superstring_view text = str.view();
+    const std::size_t chunks = chunk_count(pool, text.size());
+
+    if (size == 0 || size == superstring_view::npos || chunks == 1)
+        return str.split(size);
+
+    superstring::vector_type tokens((text.size() + size - 1) / size);
+
+    pool.run(chunks, [&](std::size_t i) {
+        const std::size_t first = i * tokens.size() / chunks;
+        const std::size_t last  = (i + 1) * tokens.size() / chunks;
+
+        for (std::size_t j = first; j < last; j++) {
+            const superstring_view token = text.substr(j * size, size);
+            tokens[j].assign(token.data(), token.size());
+        }
+    });
+
+    return tokens;
+}
+
+/**
+ * Split a string into tokens and trim whitespace from each, on several
+ * threads. The result is the same as calling superstring::split() and then
+ * trimming each token, so a token of only whitespace becomes empty rather
+ * than being dropped
+ *
+ * @param[in] pool      The threads to use
+ * @param[in] str       The string to split
+ * @param[in] separator The delimiter
+ *
+ * @return The trimmed tokens
+ */
+superstring::vector_type split_trimmed(thread_pool& pool,
+                                       const superstring& str,
+                                       superstring_view separator) {
+    return split_chunks(pool, str, separator,
+                        [](superstring_view token) { return token.trim(); });
+}
+
+/**
+ * Convert a string to lower case, on several threads
+ *
+ * @param[in] pool The threads to use
+ * @param[in] str  The string
+ *
+ * @return The same as str.to_lower()
+ */
+superstring to_lower(thread_pool& pool, const superstring& str) {
+    return to_lower(pool, superstring(str));
+}
+
+/**
+ * Convert a string to lower case in place, on several threads
+ *
+ * @param[in] pool The threads to use
+ * @param[in] str  The string, whose storage is reused
+ *
+ * @return The same as str.to_lower()
+ */
+superstring to_lower(thread_pool& pool, superstring&& str) {
+    std::string data = std::move(str).get();
+    map_chunks(pool, &data, &case_map::lower);
+
+    return superstring(std::move(data));
+}
+
+/**
+ * Convert a string to upper case, on several threads
+ *
+ * @param[in] pool The threads to use
+ * @param[in] str  The string
+ *
+ * @return The same as str.to_upper()
+ */
+superstring to_upper(thread_pool& pool, const superstring& str) {
+    return to_upper(pool, superstring(str));
+}
+
+/**
+ * Convert a string to upper case in place, on several threads
+ *
+ * @param[in] pool The threads to use
+ * @param[in] str  The string, whose storage is reused
+ *
+ * @return The same as str.to_upper()
+ */
+superstring to_upper(thread_pool& pool, superstring&& str) {
+    std::string data = std::move(str).get();
+    map_chunks(pool, &data, &case_map::upper);
+
+    return superstring(std::move(data));
+}
+
+}  // namespace parallel
+}  // namespace jfern
@@ -0,0 +1,910 @@
+/**
+ *  \file   rope.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/rope.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include "superstring/join.h"
+#else
+#include <limits.h>
+#include <sys/uio.h>
+#endif
+
+namespace jfern {
+
+namespace detail {
+
+/**
+ * A node of a rope's tree: either a leaf, which is a slice of a chunk, or a
+ * branch, which is the concatenation of its two children. The tree is kept
+ * AVL-balanced, so the heights of a branch's children differ by at most one
+ */
+struct rope_node {
+    /** The number of characters under this node */
+    std::size_t length;
+
+    /** The height of the subtree; leaves have height 0 */
+    std::size_t height;
+
+    /** The left child of a branch */
+    std::shared_ptr<const rope_node> left;
+
+    /** The right child of a branch */
+    std::shared_ptr<const rope_node> right;
+
+    /** The characters of a leaf, which may be shared with other leaves */
+    std::shared_ptr<const std::string> chunk;
+
+    /** Where a leaf's characters start in \ref chunk */
+    std::size_t offset;
+};
+
+}  // namespace detail
+
+constexpr std::size_t rope::npos;
+constexpr std::size_t rope::flat_size;
+
+namespace {
+
+using node     = detail::rope_node;
+using node_ptr = std::shared_ptr<const node>;
+
+/** Two adjacent leaves shorter than this in all are merged into one */
+constexpr std::size_t merge_size = 128;
+
+#ifndef _WIN32
+/** The most chunks passed to a single writev(2) */
+#ifdef IOV_MAX
+constexpr std::size_t max_iovecs = IOV_MAX;
+#else
+constexpr std::size_t max_iovecs = 16;
+#endif
+#endif
+
+std::size_t length(const node_ptr& tree) noexcept {
+    return tree ? tree->length : 0;
+}
+
+node_ptr make_leaf(std::shared_ptr<const std::string> chunk,
+                   std::size_t offset, std::size_t length) {
+    auto leaf = std::make_shared<node>();
+    leaf->length = length;
+    leaf->height = 0;
+    leaf->chunk  = std::move(chunk);
+    leaf->offset = offset;
+
+    return leaf;
+}
+
+/*
+ * Copy a string into a chunk of its own
+ */
+node_ptr make_leaf(superstring_view str) {
+    if (str.empty()) return nullptr;
+
+    return make_leaf(std::make_shared<const std::string>(str.data(),
+                                                         str.size()),
+                     0, str.size());
+}
+
+node_ptr make_branch(node_ptr left, node_ptr right) {
+    auto branch = std::make_shared<node>();
+    branch->length = left->length + right->length;
+    branch->height = std::max(left->height, right->height) + 1;
+    branch->left   = std::move(left);
+    branch->right  = std::move(right);
+    branch->offset = 0;
+
+    return branch;
+}
+
+/*
+ * (x, (y, z)) becomes ((x, y), z)
+ */
+node_ptr rotate_left(const node_ptr& tree) {
+    const node_ptr& right = tree->right;
+    return make_branch(make_branch(tree->left, right->left), right->right);
+}
+
+/*
+ * ((x, y), z) becomes (x, (y, z))
+ */
+node_ptr rotate_right(const node_ptr& tree) {
+    const node_ptr& left = tree->left;
+    return make_branch(left->left, make_branch(left->right, tree->right));
+}
+
+/*
+ * Concatenate two trees when the left one is more than one level taller,
+ * by walking down its right spine to a subtree of about the same height as
+ * the right one, and rebalancing on the way back up. See Blelloch, Ferizovic
+ * and Sun, "Just Join for Parallel Ordered Sets" (2016)
+ */
+node_ptr join_right(const node_ptr& a, const node_ptr& b) {
+    const node_ptr& left  = a->left;
+    const node_ptr& inner = a->right;
+
+    if (inner->height <= b->height + 1) {
+        const node_ptr joined = make_branch(inner, b);
+        if (joined->height <= left->height + 1)
+            return make_branch(left, joined);
+
+        return rotate_left(make_branch(left, rotate_right(joined)));
+    }
+
+    const node_ptr joined = join_right(inner, b);
+    if (joined->height <= left->height + 1)
+        return make_branch(left, joined);
+
+    return rotate_left(make_branch(left, joined));
+}
+
+/*
+ * The mirror image of join_right(), for when the right tree is taller
+ */
+node_ptr join_left(const node_ptr& a, const node_ptr& b) {
+    const node_ptr& inner = b->left;
+    const node_ptr& right = b->right;
+
+    if (inner->height <= a->height + 1) {
+        const node_ptr joined = make_branch(a, inner);
+        if (joined->height <= right->height + 1)
+            return make_branch(joined, right);
+
+        return rotate_right(make_branch(rotate_left(joined), right));
+    }
+
+    const node_ptr joined = join_left(a, inner);
+    if (joined->height <= right->height + 1)
+        return make_branch(joined, right);
+
+    return rotate_right(make_branch(joined, right));
+}
+
+/*
+ * Concatenate two trees, either of which may be empty, in O(log n) time
+ */
+node_ptr join(const node_ptr& a, const node_ptr& b) {
+    if (!a) return b;
+    if (!b) return a;
+
+    if (a->height == 0 && b->height == 0 &&
+        a->length + b->length < merge_size) {
+        auto chunk = std::make_shared<std::string>();
+        chunk->reserve(a->length + b->length);
+        chunk->append(a->chunk->data() + a->offset, a->length);
+        chunk->append(b->chunk->data() + b->offset, b->length);
+
+        return make_leaf(std::move(chunk), 0, a->length + b->length);
+    }
+
+    if (a->height > b->height + 1) return join_right(a, b);
+    if (b->height > a->height + 1) return join_left(a, b);
+
+    return make_branch(a, b);
+}
+
+/*
+ * Get the characters in [begin, end) of a tree, in O(log n) time. Only the
+ * nodes along the two boundaries are rebuilt; everything between them is
+ * shared
+ */
+node_ptr slice(const node_ptr& tree, std::size_t begin, std::size_t end) {
+    if (begin >= end) return nullptr;
+    if (begin == 0 && end == tree->length) return tree;
+
+    if (tree->height == 0)
+        return make_leaf(tree->chunk, tree->offset + begin, end - begin);
+
+    const std::size_t middle = tree->left->length;
+
+    if (end <= middle) return slice(tree->left, begin, end);
+    if (begin >= middle)
+        return slice(tree->right, begin - middle, end - middle);
+
+    return join(slice(tree->left, begin, middle),
+                slice(tree->right, 0, end - middle));
+}
+
+/*
+ * Copy the characters in [begin, end) of a tree
+ */
+void copy_range(const node* tree, std::size_t begin, std::size_t end,
+                char* dest) {
+    if (tree->height == 0) {
+        std::memcpy(dest, tree->chunk->data() + tree->offset + begin,
+                    end - begin);
+        return;
+    }
+
+    const std::size_t middle = tree->left->length;
+
+    if (begin < middle)
+        copy_range(tree->left.get(), begin, std::min(end, middle), dest);
+
+    if (end > middle) {
+        const std::size_t skipped = begin < middle ? middle - begin : 0;
+        copy_range(tree->right.get(), begin > middle ? begin - middle : 0,
+                   end - middle, dest + skipped);
+    }
+}
+
+}  // namespace
+
+/**
+ * Default constructor. Creates an empty rope
+ */
+rope::rope() noexcept : m_root(), m_tail() {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] str The initial contents, which are copied
+ */
+rope::rope(superstring_view str) : rope() {
+    append(str);
+}
+
+/**
+ * Constructor. A long string becomes a chunk as is, without being copied
+ *
+ * @param[in] str The initial contents
+ */
+rope::rope(std::string&& str) : rope() {
+    append(std::move(str));
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] str The initial contents, which are copied
+ */
+rope::rope(const superstring& str) : rope(str.view()) {
+}
+
+/**
+ * Constructor. A long string becomes a chunk as is, without being copied
+ *
+ * @param[in] str The initial contents
+ */
+rope::rope(superstring&& str) : rope(std::move(str).get()) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] root The tree
+ */
+rope::rope(node_ptr root) noexcept : m_root(std::move(root)), m_tail() {
+}
+
+/**
+ * @return The number of characters
+ */
+std::size_t rope::size() const noexcept {
+    return length(m_root) + (m_tail ? m_tail->size() : 0);
+}
+
+/**
+ * @return The height of the tree of chunks, which grows logarithmically with
+ *         their number. A rope with at most one chunk has depth 0
+ */
+std::size_t rope::depth() const noexcept {
+    return m_root ? m_root->height : 0;
+}
+
+/**
+ * Get a character, in O(log n) time
+ *
+ * @param[in] pos The position of the character
+ *
+ * @return The character
+ *
+ * @throws std::out_of_range if \a pos is not less than size()
+ */
+char rope::at(std::size_t pos) const {
+    if (pos >= size()) throw std::out_of_range("rope: position out of range");
+
+    if (pos >= length(m_root)) return (*m_tail)[pos - length(m_root)];
+
+    const node* tree = m_root.get();
+    while (tree->height > 0) {
+        if (pos < tree->left->length) {
+            tree = tree->left.get();
+        } else {
+            pos -= tree->left->length;
+            tree = tree->right.get();
+        }
+    }
+
+    return (*tree->chunk)[tree->offset + pos];
+}
+
+/**
+ * Get part of the rope. The result shares this rope's chunks
+ *
+ * @param[in] pos   The position of the first character
+ * @param[in] count The number of characters. If this runs past the end, the
+ *                  rest of the rope is taken
+ *
+ * @return The characters in [pos, pos + count)
+ *
+ * @throws std::out_of_range if \a pos is greater than size()
+ */
+rope rope::substr(std::size_t pos, std::size_t count) const {
+    if (pos > size()) throw std::out_of_range("rope: position out of range");
+
+    const std::size_t end  = pos + std::min(count, size() - pos);
+    const std::size_t root = length(m_root);
+
+    rope result(slice(m_root, std::min(pos, root), std::min(end, root)));
+
+    /* Unflushed appends are copied, so that they stay writable */
+    if (end > root) {
+        const std::size_t begin = std::max(pos, root);
+        result.append(superstring_view(m_tail->data() + begin - root,
+                                       end - begin));
+    }
+
+    return result;
+}
+
+/**
+ * Append a string. Short strings are gathered in a buffer; long ones are
+ * copied into a chunk of their own
+ *
+ * @param[in] str The string to append
+ *
+ * @return *this
+ */
+rope& rope::append(superstring_view str) {
+    if (str.empty()) return *this;
+
+    if (str.size() >= flat_size) {
+        flush();
+        m_root = join(m_root, make_leaf(str));
+        return *this;
+    }
+
+    if (!m_tail || m_tail.use_count() > 1) {
+        auto tail = std::make_shared<std::string>();
+        tail->reserve(flat_size);
+        if (m_tail) tail->append(*m_tail);
+
+        m_tail = std::move(tail);
+    }
+
+    const std::size_t room = flat_size - m_tail->size();
+    if (str.size() > room) {
+        m_tail->append(str.data(), room);
+        str = str.substr(room);
+
+        flush();
+        m_tail = std::make_shared<std::string>();
+        m_tail->reserve(flat_size);
+    }
+
+    m_tail->append(str.data(), str.size());
+    return *this;
+}
+
+/**
+ * Append a string. A long string becomes a chunk as is, without being copied
+ *
+ * @param[in] str The string to append
+ *
+ * @return *this
+ */
+rope& rope::append(std::string&& str) {
+    if (str.size() < flat_size) return append(superstring_view(str));
+
+    const std::size_t size = str.size();
+
+    flush();
+    m_root = join(m_root, make_leaf(
+        std::make_shared<const std::string>(std::move(str)), 0, size));
+
+    return *this;
+}
+
+/**
+ * Append another rope, which may be this one. Its chunks are shared, not
+ * copied
+ *
+ * @param[in] other The rope to append
+ *
+ * @return *this
+ */
+rope& rope::append(const rope& other) {
+    if (!other.m_root) {
+        if (other.m_tail) append(superstring_view(*other.m_tail));
+        return *this;
+    }
+
+    const node_ptr root = other.m_root;
+    const std::shared_ptr<std::string> tail = other.m_tail;
+
+    flush();
+    m_root = join(m_root, root);
+
+    if (tail) append(superstring_view(*tail));
+
+    return *this;
+}
+
+/**
+ * Insert a string, in O(log n) time
+ *
+ * @param[in] pos The position to insert at
+ * @param[in] str The string, which is copied
+ *
+ * @return *this
+ *
+ * @throws std::out_of_range if \a pos is greater than size()
+ */
+rope& rope::insert(std::size_t pos, superstring_view str) {
+    if (pos > size()) throw std::out_of_range("rope: position out of range");
+    if (pos == size()) return append(str);
+
+    flush();
+
+    const node_ptr left  = slice(m_root, 0, pos);
+    const node_ptr right = slice(m_root, pos, m_root->length);
+
+    m_root = join(join(left, make_leaf(str)), right);
+    return *this;
+}
+
+/**
+ * Insert another rope, which may be this one, in O(log n) time. Its chunks
+ * are shared, not copied
+ *
+ * @param[in] pos   The position to insert at
+ * @param[in] other The rope to insert
+ *
+ * @return *this
+ *
+ * @throws std::out_of_range if \a pos is greater than size()
+ */
+rope& rope::insert(std::size_t pos, const rope& other) {
+    if (pos > size()) throw std::out_of_range("rope: position out of range");
+    if (pos == size()) return append(other);
+
+    const node_ptr inserted = other.tree();
+
+    flush();
+
+    const node_ptr left  = slice(m_root, 0, pos);
+    const node_ptr right = slice(m_root, pos, m_root->length);
+
+    m_root = join(join(left, inserted), right);
+    return *this;
+}
+
+/**
+ * Erase characters, in O(log n) time
+ *
+ * @param[in] pos   The position of the first character to erase
+ * @param[in] count The number of characters. If this runs past the end, the
+ *                  rest of the rope is erased
+ *
+ * @return *this
+ *
+ * @throws std::out_of_range if \a pos is greater than size()
+ */
+rope& rope::erase(std::size_t pos, std::size_t count) {
+    if (pos > size()) throw std::out_of_range("rope: position out of range");
+
+    count = std::min(count, size() - pos);
+    if (count == 0) return *this;
+
+    /* Erasing from the unflushed appends alone needs no tree surgery */
+    const std::size_t root = length(m_root);
+    if (pos >= root && m_tail.use_count() == 1) {
+        m_tail->erase(pos - root, count);
+        return *this;
+    }
+
+    flush();
+
+    m_root = join(slice(m_root, 0, pos),
+                  slice(m_root, pos + count, m_root->length));
+    return *this;
+}
+
+/**
+ * Erase everything
+ */
+void rope::clear() noexcept {
+    m_root.reset();
+    m_tail.reset();
+}
+
+/**
+ * @return The chunks, in order. None of them is empty
+ */
+rope::chunk_range rope::chunks() const {
+    return chunk_range(m_root.get(), m_tail.get());
+}
+
+/**
+ * Copy characters out of the rope, in O(log n) time plus the time to copy
+ * them
+ *
+ * @param[out] dest  Where to copy them. This is not null-terminated
+ * @param[in]  count The number of characters to copy. If this runs past the
+ *                   end, only the rest of the rope is copied
+ * @param[in]  pos   The position of the first character to copy
+ *
+ * @return The number of characters copied
+ *
+ * @throws std::out_of_range if \a pos is greater than size()
+ */
+std::size_t rope::copy(char* dest, std::size_t count, std::size_t pos) const {
+    if (pos > size()) throw std::out_of_range("rope: position out of range");
+
+    count = std::min(count, size() - pos);
+
+    const std::size_t end  = pos + count;
+    const std::size_t root = length(m_root);
+
+    if (pos < root)
+        copy_range(m_root.get(), pos, std::min(end, root), dest);
+
+    if (end > root) {
+        const std::size_t begin = std::max(pos, root);
+        std::memcpy(dest + (begin - pos), m_tail->data() + begin - root,
+                    end - begin);
+    }
+
+    return count;
+}
+
+/**
+ * @return The contents as a single contiguous string
+ */
+std::string rope::str() const {
+    std::string flat(size(), '\0');
+    copy(&flat[0], flat.size());
+
+    return flat;
+}
+
+/**
+ * Write the rope to a file descriptor, passing the chunks to writev(2) as
+ * they are rather than copying them into one buffer first. Partial writes
+ * and interruptions are retried
+ *
+ * @param[in] fd An open file descriptor
+ *
+ * @throws std::system_error if a write fails
+ */
+void rope::writev(int fd) const {
+#ifdef _WIN32
+    /* There is no writev(); gather the chunks into large writes instead */
+    fd_sink sink(fd);
+    write(sink);
+    sink.flush();
+#else
+    std::vector<iovec> batch;
+    batch.reserve(max_iovecs);
+
+    const chunk_range range = chunks();
+    for (auto iter = range.begin(), end = range.end(); iter != end;) {
+        batch.clear();
+        for (; iter != end && batch.size() < max_iovecs; ++iter) {
+            batch.push_back({const_cast<char*>(iter->data()), iter->size()});
+        }
+
+        std::size_t first = 0;
+        while (first < batch.size()) {
+            const ssize_t written = ::writev(
+                fd, batch.data() + first,
+                static_cast<int>(batch.size() - first));
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::system_error(errno, std::generic_category(),
+                                        "rope: writev failed");
+            }
+
+            /* Skip whatever was written, which may end mid-chunk */
+            std::size_t done = static_cast<std::size_t>(written);
+            while (first < batch.size() && done >= batch[first].iov_len)
+                done -= batch[first++].iov_len;
+
+            if (done > 0) {
+                batch[first].iov_base =
+                    static_cast<char*>(batch[first].iov_base) + done;
+                batch[first].iov_len -= done;
+            }
+        }
+    }
+#endif
+}
+
+/**
+ * @return The contents as a superstring
+ */
+rope::operator superstring() const {
+    return superstring(str());
+}
+
+/**
+ * Add the unflushed appends to the tree
+ */
+void rope::flush() {
+    if (!m_tail) return;
+
+    const std::size_t size = m_tail->size();
+    if (size > 0) {
+        /* The tree keeps the chunk for good, so don't waste its capacity */
+        if (m_tail.use_count() == 1 && size < flat_size / 2)
+            m_tail->shrink_to_fit();
+
+        m_root = join(m_root, make_leaf(std::move(m_tail), 0, size));
+    }
+
+    m_tail.reset();
+}
+
+/**
+ * @return The whole rope as a tree, with the unflushed appends copied into a
+ *         chunk of their own
+ */
+rope::node_ptr rope::tree() const {
+    return m_tail ? join(m_root, make_leaf(superstring_view(*m_tail)))
+                  : m_root;
+}
+
+/**
+ * Constructor. Creates an end iterator
+ */
+rope::chunk_iterator::chunk_iterator() noexcept
+    : m_pending(), m_tail(nullptr), m_chunk(), m_position(0) {
+}
+
+/**
+ * Constructor. Creates an iterator to the first chunk
+ *
+ * @param[in] root The rope's tree, which may be null
+ * @param[in] tail The rope's unflushed appends, which may be null
+ */
+rope::chunk_iterator::chunk_iterator(const detail::rope_node* root,
+                                     const std::string* tail)
+    : m_pending(), m_tail(tail), m_chunk(), m_position(0) {
+    if (root) {
+        m_pending.reserve(root->height + 1);
+        m_pending.push_back(root);
+    }
+
+    advance();
+}
+
+/**
+ * @return The current chunk
+ */
+rope::chunk_iterator::reference rope::chunk_iterator::operator*() const
+    noexcept {
+    return m_chunk;
+}
+
+/**
+ * @return The current chunk
+ */
+rope::chunk_iterator::pointer rope::chunk_iterator::operator->() const
+    noexcept {
+    return &m_chunk;
+}
+
+/**
+ * Move to the next chunk
+ *
+ * @return *this
+ */
+rope::chunk_iterator& rope::chunk_iterator::operator++() {
+    m_position += m_chunk.size();
+    advance();
+
+    return *this;
+}
+
+/**
+ * Move to the next chunk
+ *
+ * @return A copy of this iterator from before it was moved
+ */
+rope::chunk_iterator rope::chunk_iterator::operator++(int) {
+    chunk_iterator copy(*this);
+    ++*this;
+
+    return copy;
+}
+
+/**
+ * Check two iterators over the same rope for equality
+ *
+ * @param[in] other The other iterator
+ *
+ * @return True if both point to the same chunk, or both are at the end
+ */
+bool rope::chunk_iterator::operator==(const chunk_iterator& other) const
+    noexcept {
+    return m_chunk.data() == other.m_chunk.data() &&
+           (m_chunk.data() == nullptr || m_position == other.m_position);
+}
+
+/**
+ * Check two iterators over the same rope for inequality
+ *
+ * @param[in] other The other iterator
+ *
+ * @return True if they point to different chunks
+ */
+bool rope::chunk_iterator::operator!=(const chunk_iterator& other) const
+    noexcept {
+    return !(*this == other);
+}
+
+/**
+ * Find the next chunk: the leftmost leaf of the next pending subtree, or
+ * failing that the unflushed appends
+ */
+void rope::chunk_iterator::advance() {
+    if (!m_pending.empty()) {
+        const detail::rope_node* tree = m_pending.back();
+        m_pending.pop_back();
+
+        while (tree->height > 0) {
+            m_pending.push_back(tree->right.get());
+            tree = tree->left.get();
+        }
+
+        m_chunk = superstring_view(tree->chunk->data() + tree->offset,
+                                   tree->length);
+    } else if (m_tail && !m_tail->empty()) {
+        m_chunk = superstring_view(m_tail->data(), m_tail->size());
+        m_tail  = nullptr;
+    } else {
+        m_chunk = superstring_view();
+        m_tail  = nullptr;
+    }
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] root The rope's tree
+ * @param[in] tail The rope's unflushed appends
+ */
+rope::chunk_range::chunk_range(const detail::rope_node* root,
+                               const std::string* tail) noexcept
+    : m_root(root), m_tail(tail) {
+}
+
+/**
+ * @return An iterator to the first chunk
+ */
+rope::chunk_iterator rope::chunk_range::begin() const {
+    return chunk_iterator(m_root, m_tail);
+}
+
+/**
+ * @return An iterator past the last chunk
+ */
+rope::chunk_iterator rope::chunk_range::end() const noexcept {
+    return chunk_iterator();
+}
+
+/**
+ * Concatenate two ropes, sharing their chunks
+ *
+ * @param[in] lhs The first rope
+ * @param[in] rhs The second rope
+ *
+ * @return The concatenation
+ */
+rope operator+(rope lhs, const rope& rhs) {
+    lhs += rhs;
+    return lhs;
+}
+
+/**
+ * Compare two ropes, however their text is divided into chunks
+ *
+ * @param[in] a The first rope
+ * @param[in] b The second rope
+ *
+ * @return True if they hold the same characters
+ */
+bool operator==(const rope& a, const rope& b) {
+    if (a.size() != b.size()) return false;
+
+    const rope::chunk_range left = a.chunks(), right = b.chunks();
+    auto i = left.begin();
+    auto j = right.begin();
+
+    /* Offsets into the current chunks, which end at different places */
+    std::size_t x = 0, y = 0;
+
+    for (const auto end = left.end(); i != end;) {
+        const std::size_t size = std::min(i->size() - x, j->size() - y);
+        if (std::memcmp(i->data() + x, j->data() + y, size) != 0)
+            return false;
+
+        x += size;
+        y += size;
+
+        if (x == i->size()) {
+            ++i;
+            x = 0;
+        }
+        if (y == j->size()) {
+            ++j;
+            y = 0;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Compare two ropes
+ *
+ * @param[in] a The first rope
+ * @param[in] b The second rope
+ *
+ * @return True if they differ
+ */
+bool operator!=(const rope& a, const rope& b) {
+    return !(a == b);
+}
+
+/**
+ * Compare a rope to a string
+ *
+ * @param[in] a The rope
+ * @param[in] b The string
+ *
+ * @return True if they hold the same characters
+ */
+bool operator==(const rope& a, superstring_view b) {
+    if (a.size() != b.size()) return false;
+
+    std::size_t offset = 0;
+    for (superstring_view chunk : a.chunks()) {
+        if (std::memcmp(chunk.data(), b.data() + offset, chunk.size()) != 0)
+            return false;
+        offset += chunk.size();
+    }
+
+    return true;
+}
+
+/**
+ * Compare a rope to a string
+ *
+ * @param[in] a The rope
+ * @param[in] b The string
+ *
+ * @return True if they differ
+ */
+bool operator!=(const rope& a, superstring_view b) {
+    return !(a == b);
+}
+
+}  // namespace jfern
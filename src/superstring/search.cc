@@ -0,0 +1,587 @@
+/**
+ *  \file   search.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/search.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * The vector kernels are compiled with per-function target attributes, so
+ * they exist even when the rest of the library is built for a baseline CPU
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILITY_SEARCH_X86 1
+#include <immintrin.h>
+#define UTILITY_TARGET_SSE2 __attribute__((target("sse2")))
+#define UTILITY_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace jfern {
+namespace search {
+
+constexpr std::size_t char_class::max_listed;
+
+namespace {
+
+constexpr std::size_t npos = superstring_view::npos;
+
+/** The kernel level in use, or -1 before the CPU has been checked */
+std::atomic<int> g_level(-1);
+
+/*
+ * Scalar kernels. These also finish off the tails that are too short for a
+ * full vector
+ */
+
+std::size_t find_scalar(const char* data, std::size_t size, char c) {
+    const void* match = std::memchr(data, c, size);
+    return match ? static_cast<const char*>(match) - data : npos;
+}
+
+std::size_t find_scalar(const char* data, std::size_t size,
+                        const char* needle, std::size_t length) {
+    if (length > size) return npos;
+
+    /* Jump between occurrences of the first character with memchr */
+    const std::size_t last = size - length;
+    for (std::size_t i = 0; i <= last; i++) {
+        const std::size_t ind = find_scalar(data + i, last + 1 - i, needle[0]);
+        if (ind == npos) return npos;
+
+        i += ind;
+        if (std::memcmp(data + i, needle, length) == 0) return i;
+    }
+
+    return npos;
+}
+
+std::size_t find_class_scalar(const char* data, std::size_t size,
+                              const char_class& chars, bool member) {
+    for (std::size_t i = 0; i < size; i++) {
+        if (chars.contains(data[i]) == member) return i;
+    }
+
+    return npos;
+}
+
+std::size_t rfind_class_scalar(const char* data, std::size_t size,
+                               const char_class& chars, bool member) {
+    for (std::size_t i = size; i-- > 0;) {
+        if (chars.contains(data[i]) == member) return i;
+    }
+
+    return npos;
+}
+
+#ifdef UTILITY_SEARCH_X86
+
+/*
+ * SSE2 kernels, 16 bytes at a time. SSE2 has no byte shuffle, so character
+ * classes are matched by comparing against each member; larger classes use
+ * the scalar kernel
+ */
+
+UTILITY_TARGET_SSE2
+std::size_t find_sse2(const char* data, std::size_t size, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    const std::size_t ind = find_scalar(data + i, size - i, c);
+    return ind == npos ? npos : i + ind;
+}
+
+UTILITY_TARGET_SSE2
+std::size_t find_sse2(const char* data, std::size_t size,
+                      const char* needle, std::size_t length) {
+    if (length > size) return npos;
+
+    /* Filter candidates by their first and last bytes, then verify */
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last  = _mm_set1_epi8(needle[length - 1]);
+
+    std::size_t i = 0;
+    for (; i + length - 1 + 16 <= size; i += 16) {
+        const __m128i head =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i tail = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i + length - 1));
+
+        unsigned int mask = _mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last)));
+
+        while (mask != 0) {
+            const std::size_t ind = i + __builtin_ctz(mask);
+            if (std::memcmp(data + ind + 1, needle + 1, length - 2) == 0)
+                return ind;
+            mask &= mask - 1;
+        }
+    }
+
+    const std::size_t ind = find_scalar(data + i, size - i, needle, length);
+    return ind == npos ? npos : i + ind;
+}
+
+UTILITY_TARGET_SSE2
+inline unsigned int class_mask_sse2(__m128i block, const __m128i* members,
+                                    std::size_t count) {
+    __m128i match = _mm_setzero_si128();
+    for (std::size_t j = 0; j < count; j++)
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(block, members[j]));
+
+    return _mm_movemask_epi8(match);
+}
+
+UTILITY_TARGET_SSE2
+std::size_t find_class_sse2(const char* data, std::size_t size,
+                            const char_class& chars, bool member) {
+    if (chars.size() == 0 || chars.size() > char_class::max_listed)
+        return find_class_scalar(data, size, chars, member);
+
+    __m128i members[char_class::max_listed];
+    for (std::size_t j = 0; j < chars.size(); j++)
+        members[j] = _mm_set1_epi8(chars.members()[j]);
+
+    const unsigned int flip = member ? 0 : 0xffff;
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const unsigned int mask =
+            class_mask_sse2(block, members, chars.size()) ^ flip;
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    const std::size_t ind =
+        find_class_scalar(data + i, size - i, chars, member);
+    return ind == npos ? npos : i + ind;
+}
+
+UTILITY_TARGET_SSE2
+std::size_t rfind_class_sse2(const char* data, std::size_t size,
+                             const char_class& chars, bool member) {
+    if (chars.size() == 0 || chars.size() > char_class::max_listed)
+        return rfind_class_scalar(data, size, chars, member);
+
+    __m128i members[char_class::max_listed];
+    for (std::size_t j = 0; j < chars.size(); j++)
+        members[j] = _mm_set1_epi8(chars.members()[j]);
+
+    const unsigned int flip = member ? 0 : 0xffff;
+
+    std::size_t i = size;
+    for (; i >= 16; i -= 16) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 16));
+        const unsigned int mask =
+            class_mask_sse2(block, members, chars.size()) ^ flip;
+        if (mask != 0) return i - 16 + 31 - __builtin_clz(mask);
+    }
+
+    return rfind_class_scalar(data, i, chars, member);
+}
+
+/*
+ * AVX2 kernels, 32 bytes at a time. Character classes of any size are
+ * matched with two nibble table lookups (W. Muła's "SIMD-ized check which
+ * bytes are in a set"), so the cost does not grow with the class
+ */
+
+UTILITY_TARGET_AVX2
+std::size_t find_avx2(const char* data, std::size_t size, char c) {
+    const __m256i needle = _mm256_set1_epi8(c);
+
+    std::size_t i = 0;
+
+    /* Delimiters are usually close, so try one vector before unrolling */
+    if (size >= 32) {
+        const unsigned int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            needle,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data))));
+        if (mask != 0) return __builtin_ctz(mask);
+        i = 32;
+    }
+
+    /* Test 64 bytes per iteration, and only locate a match once found */
+    for (; i + 64 <= size; i += 64) {
+        const __m256i eq0 = _mm256_cmpeq_epi8(needle, _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i)));
+        const __m256i eq1 = _mm256_cmpeq_epi8(needle, _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i + 32)));
+
+        if (!_mm256_testz_si256(_mm256_or_si256(eq0, eq1),
+                                _mm256_or_si256(eq0, eq1))) {
+            const std::uint64_t mask =
+                static_cast<std::uint32_t>(_mm256_movemask_epi8(eq0)) |
+                static_cast<std::uint64_t>(_mm256_movemask_epi8(eq1)) << 32;
+            return i + __builtin_ctzll(mask);
+        }
+    }
+
+    for (; i + 32 <= size; i += 32) {
+        const unsigned int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            needle,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i))));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    const std::size_t ind = find_scalar(data + i, size - i, c);
+    return ind == npos ? npos : i + ind;
+}
+
+UTILITY_TARGET_AVX2
+std::size_t find_avx2(const char* data, std::size_t size,
+                      const char* needle, std::size_t length) {
+    if (length > size) return npos;
+
+    /* Filter candidates by their first and last bytes, then verify */
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last  = _mm256_set1_epi8(needle[length - 1]);
+
+    std::size_t i = 0;
+    for (; i + length - 1 + 32 <= size; i += 32) {
+        const __m256i head =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i tail = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i + length - 1));
+
+        unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last)));
+
+        while (mask != 0) {
+            const std::size_t ind = i + __builtin_ctz(mask);
+            if (std::memcmp(data + ind + 1, needle + 1, length - 2) == 0)
+                return ind;
+            mask &= mask - 1;
+        }
+    }
+
+    const std::size_t ind = find_scalar(data + i, size - i, needle, length);
+    return ind == npos ? npos : i + ind;
+}
+
+/*
+ * The tables for class_mask_avx2(). Each 16-byte table is repeated in both
+ * 128-bit lanes because VPSHUFB looks up within a lane
+ */
+struct class_tables_avx2 {
+    __m256i row0;
+    __m256i row1;
+    __m256i bits;
+};
+
+UTILITY_TARGET_AVX2
+inline class_tables_avx2 make_tables_avx2(const char_class& chars) {
+    const std::uint8_t* rows = chars.nibble_rows();
+
+    class_tables_avx2 tables;
+    tables.row0 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows)));
+    tables.row1 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + 16)));
+    tables.bits = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    return tables;
+}
+
+UTILITY_TARGET_AVX2
+inline unsigned int class_mask_avx2(__m256i block,
+                                    const class_tables_avx2& tables) {
+    const __m256i low_nibbles = _mm256_set1_epi8(0x0f);
+
+    const __m256i lo = _mm256_and_si256(block, low_nibbles);
+    const __m256i hi =
+        _mm256_and_si256(_mm256_srli_epi16(block, 4), low_nibbles);
+
+    /* Bytes with the top bit set take their row from the second table */
+    const __m256i row = _mm256_blendv_epi8(
+        _mm256_shuffle_epi8(tables.row0, lo),
+        _mm256_shuffle_epi8(tables.row1, lo), block);
+    const __m256i bit = _mm256_shuffle_epi8(tables.bits, hi);
+
+    return _mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+}
+
+UTILITY_TARGET_AVX2
+std::size_t find_class_avx2(const char* data, std::size_t size,
+                            const char_class& chars, bool member) {
+    const class_tables_avx2 tables = make_tables_avx2(chars);
+    const unsigned int flip = member ? 0 : 0xffffffff;
+
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const unsigned int mask = class_mask_avx2(block, tables) ^ flip;
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    const std::size_t ind =
+        find_class_scalar(data + i, size - i, chars, member);
+    return ind == npos ? npos : i + ind;
+}
+
+UTILITY_TARGET_AVX2
+std::size_t rfind_class_avx2(const char* data, std::size_t size,
+                             const char_class& chars, bool member) {
+    const class_tables_avx2 tables = make_tables_avx2(chars);
+    const unsigned int flip = member ? 0 : 0xffffffff;
+
+    std::size_t i = size;
+    for (; i >= 32; i -= 32) {
+        const __m256i block = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i - 32));
+        const unsigned int mask = class_mask_avx2(block, tables) ^ flip;
+        if (mask != 0) return i - 32 + 31 - __builtin_clz(mask);
+    }
+
+    return rfind_class_scalar(data, i, chars, member);
+}
+
+#endif  // UTILITY_SEARCH_X86
+
+/*
+ * Dispatch
+ */
+
+std::size_t find_class(superstring_view text, const char_class& chars,
+                       bool member) {
+    switch (active_level()) {
+#ifdef UTILITY_SEARCH_X86
+      case level::avx2:
+        return find_class_avx2(text.data(), text.size(), chars, member);
+      case level::sse2:
+        return find_class_sse2(text.data(), text.size(), chars, member);
+#endif
+      default:
+        return find_class_scalar(text.data(), text.size(), chars, member);
+    }
+}
+
+std::size_t rfind_class(superstring_view text, const char_class& chars,
+                        bool member) {
+    switch (active_level()) {
+#ifdef UTILITY_SEARCH_X86
+      case level::avx2:
+        return rfind_class_avx2(text.data(), text.size(), chars, member);
+      case level::sse2:
+        return rfind_class_sse2(text.data(), text.size(), chars, member);
+#endif
+      default:
+        return rfind_class_scalar(text.data(), text.size(), chars, member);
+    }
+}
+
+}  // namespace
+
+/**
+ * Default constructor. Creates an empty set
+ */
+char_class::char_class() noexcept
+    : m_bits{0, 0, 0, 0}, m_rows{{0}, {0}}, m_members{0}, m_size(0) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] chars The members of the set. Duplicates are ignored
+ */
+char_class::char_class(superstring_view chars) noexcept : char_class() {
+    for (char c : chars) insert(c);
+}
+
+/**
+ * Add a byte to the set
+ *
+ * @param[in] c The byte to add
+ */
+void char_class::insert(char c) noexcept {
+    if (contains(c)) return;
+
+    const auto byte = static_cast<unsigned char>(c);
+
+    m_bits[byte / 64] |= std::uint64_t(1) << (byte % 64);
+    m_rows[byte >> 7][byte & 15] |= 1u << ((byte >> 4) % 8);
+
+    if (m_size < max_listed) m_members[m_size] = c;
+    m_size++;
+}
+
+/**
+ * @return The number of distinct members
+ */
+std::size_t char_class::size() const noexcept {
+    return m_size;
+}
+
+/**
+ * @return The first min(size(), \ref max_listed) members, in the order they
+ *         were inserted
+ */
+const char* char_class::members() const noexcept {
+    return m_members;
+}
+
+/**
+ * @return The nibble lookup tables, two rows of 16 bytes
+ */
+const std::uint8_t* char_class::nibble_rows() const noexcept {
+    return m_rows[0];
+}
+
+/**
+ * Get the best kernel level this CPU supports
+ *
+ * @return The level
+ */
+level supported_level() noexcept {
+#ifdef UTILITY_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return level::avx2;
+    if (__builtin_cpu_supports("sse2")) return level::sse2;
+#endif
+    return level::scalar;
+}
+
+/**
+ * Get the kernel level the search functions use. On first use this is the
+ * best one the CPU supports
+ *
+ * @return The level
+ */
+level active_level() noexcept {
+    int isa = g_level.load(std::memory_order_relaxed);
+
+    if (isa < 0) {
+        isa = static_cast<int>(supported_level());
+        g_level.store(isa, std::memory_order_relaxed);
+    }
+
+    return static_cast<level>(isa);
+}
+
+/**
+ * Choose the kernels the search functions use. This is meant for tests and
+ * benchmarks that compare the kernels against each other
+ *
+ * @param[in] isa The level to use
+ *
+ * @throws std::invalid_argument if the CPU does not support \a isa
+ */
+void set_active_level(level isa) {
+    if (static_cast<int>(isa) > static_cast<int>(supported_level()))
+        throw std::invalid_argument("search level not supported by this CPU");
+
+    g_level.store(static_cast<int>(isa), std::memory_order_relaxed);
+}
+
+/**
+ * Find the first occurrence of a byte
+ *
+ * @param[in] text The text to search
+ * @param[in] c    The byte to find
+ *
+ * @return The position of \a c, or superstring_view::npos if not found
+ */
+std::size_t find(superstring_view text, char c) noexcept {
+    switch (active_level()) {
+#ifdef UTILITY_SEARCH_X86
+      case level::avx2:
+        return find_avx2(text.data(), text.size(), c);
+      case level::sse2:
+        return find_sse2(text.data(), text.size(), c);
+#endif
+      default:
+        return find_scalar(text.data(), text.size(), c);
+    }
+}
+
+/**
+ * Find the first occurrence of a substring. Candidates are filtered on their
+ * first and last bytes a vector at a time, and only those are compared in
+ * full
+ *
+ * @param[in] text   The text to search
+ * @param[in] needle The substring to find
+ *
+ * @return The position of \a needle, or superstring_view::npos if not found.
+ *         An empty needle is found at position 0
+ */
+std::size_t find(superstring_view text, superstring_view needle) noexcept {
+    if (needle.empty()) return 0;
+    if (needle.size() == 1) return find(text, needle[0]);
+
+    switch (active_level()) {
+#ifdef UTILITY_SEARCH_X86
+      case level::avx2:
+        return find_avx2(text.data(), text.size(), needle.data(),
+                         needle.size());
+      case level::sse2:
+        return find_sse2(text.data(), text.size(), needle.data(),
+                         needle.size());
+#endif
+      default:
+        return find_scalar(text.data(), text.size(), needle.data(),
+                           needle.size());
+    }
+}
+
+/**
+ * Find the first byte that is in a set
+ *
+ * @param[in] text  The text to search
+ * @param[in] chars The set of bytes
+ *
+ * @return The position of the byte, or superstring_view::npos if not found
+ */
+std::size_t find_first_of(superstring_view text,
+                          const char_class& chars) noexcept {
+    return find_class(text, chars, true);
+}
+
+/**
+ * Find the first byte that is not in a set
+ *
+ * @param[in] text  The text to search
+ * @param[in] chars The set of bytes
+ *
+ * @return The position of the byte, or superstring_view::npos if not found
+ */
+std::size_t find_first_not_of(superstring_view text,
+                              const char_class& chars) noexcept {
+    return find_class(text, chars, false);
+}
+
+/**
+ * Find the last byte that is not in a set
+ *
+ * @param[in] text  The text to search
+ * @param[in] chars The set of bytes
+ *
+ * @return The position of the byte, or superstring_view::npos if not found
+ */
+std::size_t find_last_not_of(superstring_view text,
+                             const char_class& chars) noexcept {
+    return rfind_class(text, chars, false);
+}
+
+}  // namespace search
+}  // namespace jfern
@@ -0,0 +1,357 @@
+/**
+ *  \file   superstring_view.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/superstring_view.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "superstring/search.h"
+
+namespace jfern {
+
+namespace {
+
+/**
+ * @return The whitespace characters removed by the trim functions
+ */
+const search::char_class& whitespace() {
+    static const search::char_class chars(
+        superstring_view("\t\n\v\f\r ", 6));
+    return chars;
+}
+
+/**
+ * Shift a position found in the suffix of a view starting at \a pos back to
+ * a position in the whole view
+ */
+std::size_t offset(std::size_t ind, std::size_t pos) {
+    return ind == superstring_view::npos ? ind : ind + pos;
+}
+
+}  // namespace
+
+constexpr std::size_t superstring_view::npos;
+
+/**
+ * Get part of the view
+ *
+ * @param[in] pos The position of the first character
+ * @param[in] n   The maximum number of characters
+ *
+ * @return A view of [pos, pos + n), clipped to the end of this view
+ *
+ * @throws std::out_of_range if \a pos exceeds size()
+ */
+superstring_view superstring_view::substr(std::size_t pos,
+                                          std::size_t n) const {
+    if (pos > m_size)
+        throw std::out_of_range("superstring_view::substr");
+
+    return superstring_view(m_data + pos, std::min(n, m_size - pos));
+}
+
+/**
+ * Compare lexicographically with another view
+ *
+ * @param[in] other The other view
+ *
+ * @return A negative value, zero or a positive value if this view sorts
+ *         before, equal to or after \a other
+ */
+int superstring_view::compare(superstring_view other) const noexcept {
+    const std::size_t n = std::min(m_size, other.m_size);
+
+    const int result = n == 0 ? 0 : std::memcmp(m_data, other.m_data, n);
+    if (result != 0) return result;
+
+    return m_size < other.m_size ? -1 : (m_size > other.m_size ? 1 : 0);
+}
+
+/**
+ * Find the first occurrence of a character
+ *
+ * @param[in] c   The character
+ * @param[in] pos Where to begin searching
+ *
+ * @return The position of the character, or \ref npos if not found
+ */
+std::size_t superstring_view::find(char c, std::size_t pos) const noexcept {
+    if (pos >= m_size) return npos;
+
+    const superstring_view rest(m_data + pos, m_size - pos);
+    return offset(search::find(rest, c), pos);
+}
+
+/**
+ * Find the first occurrence of a substring
+ *
+ * @param[in] str The substring
+ * @param[in] pos Where to begin searching
+ *
+ * @return The position of the substring, or \ref npos if not found
+ */
+std::size_t superstring_view::find(superstring_view str,
+                                   std::size_t pos) const noexcept {
+    if (str.m_size == 0) return pos <= m_size ? pos : npos;
+    if (pos >= m_size) return npos;
+
+    const superstring_view rest(m_data + pos, m_size - pos);
+    return offset(search::find(rest, str), pos);
+}
+
+/**
+ * Find the last occurrence of a character
+ *
+ * @param[in] c   The character
+ * @param[in] pos Only consider positions at or before this one
+ *
+ * @return The position of the character, or \ref npos if not found
+ */
+std::size_t superstring_view::rfind(char c, std::size_t pos) const noexcept {
+    if (m_size == 0) return npos;
+
+    for (std::size_t i = std::min(pos, m_size - 1) + 1; i-- > 0;) {
+        if (m_data[i] == c) return i;
+    }
+
+    return npos;
+}
+
+/**
+ * Find the first character that is in a set
+ *
+ * @param[in] chars The set of characters
+ * @param[in] pos   Where to begin searching
+ *
+ * @return The position of the character, or \ref npos if not found
+ */
+std::size_t superstring_view::find_first_of(superstring_view chars,
+                                            std::size_t pos) const noexcept {
+    if (pos >= m_size) return npos;
+
+    const superstring_view rest(m_data + pos, m_size - pos);
+    return offset(search::find_first_of(rest, search::char_class(chars)),
+                  pos);
+}
+
+/**
+ * Find the first character that is not in a set
+ *
+ * @param[in] chars The set of characters
+ * @param[in] pos   Where to begin searching
+ *
+ * @return The position of the character, or \ref npos if not found
+ */
+std::size_t superstring_view::find_first_not_of(superstring_view chars,
+                                                std::size_t pos) const
+    noexcept {
+    if (pos >= m_size) return npos;
+
+    const superstring_view rest(m_data + pos, m_size - pos);
+    return offset(search::find_first_not_of(rest, search::char_class(chars)),
+                  pos);
+}
+
+/**
+ * Find the last character that is not in a set
+ *
+ * @param[in] chars The set of characters
+ * @param[in] pos   Only consider positions at or before this one
+ *
+ * @return The position of the character, or \ref npos if not found
+ */
+std::size_t superstring_view::find_last_not_of(superstring_view chars,
+                                               std::size_t pos) const
+    noexcept {
+    if (m_size == 0) return npos;
+
+    const superstring_view prefix(m_data, std::min(pos, m_size - 1) + 1);
+    return search::find_last_not_of(prefix, search::char_class(chars));
+}
+
+/**
+ * Check if the view ends with a phrase. As with \ref superstring, an empty
+ * phrase never matches
+ *
+ * @param[in] suffix Check if the view ends with this
+ *
+ * @return True if the view ends with \a suffix
+ */
+bool superstring_view::ends_with(superstring_view suffix) const noexcept {
+    if (suffix.empty() || suffix.m_size > m_size) return false;
+
+    return std::memcmp(m_data + m_size - suffix.m_size, suffix.m_data,
+                       suffix.m_size) == 0;
+}
+
+/**
+ * Check if the view starts with a phrase. As with \ref superstring, an empty
+ * phrase never matches
+ *
+ * @param[in] prefix Check if the view starts with this
+ *
+ * @return True if the view starts with \a prefix
+ */
+bool superstring_view::starts_with(superstring_view prefix) const noexcept {
+    if (prefix.empty() || prefix.m_size > m_size) return false;
+
+    return std::memcmp(m_data, prefix.m_data, prefix.m_size) == 0;
+}
+
+/**
+ * Remove leading whitespace. This includes the character set " \t\n\v\f\r"
+ *
+ * @return A view without the leading whitespace
+ */
+superstring_view superstring_view::ltrim() const noexcept {
+    const std::size_t start = search::find_first_not_of(*this, whitespace());
+
+    if (start == npos) return superstring_view(m_data + m_size, 0);
+
+    return superstring_view(m_data + start, m_size - start);
+}
+
+/**
+ * Remove trailing whitespace. This includes the character set " \t\n\v\f\r"
+ *
+ * @return A view without the trailing whitespace
+ */
+superstring_view superstring_view::rtrim() const noexcept {
+    const std::size_t stop = search::find_last_not_of(*this, whitespace());
+
+    if (stop == npos) return superstring_view(m_data, 0);
+
+    return superstring_view(m_data, stop + 1);
+}
+
+/**
+ * Remove leading and trailing whitespace. This includes the character set
+ * " \t\n\v\f\r"
+ *
+ * @return A view without the leading and trailing whitespace
+ */
+superstring_view superstring_view::trim() const noexcept {
+    return ltrim().rtrim();
+}
+
+/**
+ * Split the view into tokens separated by a delimiter. As with
+ * \ref superstring::split(), empty tokens are dropped
+ *
+ * @param[in] delimiter The delimiter
+ *
+ * @return Views of each token
+ */
+std::vector<superstring_view>
+superstring_view::split(superstring_view delimiter) const {
+    std::vector<superstring_view> tokens;
+
+    if (delimiter.empty()) {
+        tokens.push_back(*this);
+        return tokens;
+    }
+
+    std::size_t ind, start = 0;
+    while ((ind = find(delimiter, start)) != npos) {
+        if (ind > start)
+            tokens.emplace_back(m_data + start, ind - start);
+        start = ind + delimiter.m_size;
+    }
+
+    /* Final token */
+
+    if (start < m_size)
+        tokens.emplace_back(m_data + start, m_size - start);
+
+    return tokens;
+}
+
+/**
+ * Split the view into evenly sized tokens, each one \a size characters in
+ * length. The final token contains the characters remaining
+ *
+ * @param[in] size The desired size of each token
+ *
+ * @return Views of each token
+ */
+std::vector<superstring_view> superstring_view::split(std::size_t size) const {
+    std::vector<superstring_view> tokens;
+
+    if (size == 0 || size == npos) {
+        if (size == npos)
+            tokens.push_back(*this);
+        return tokens;
+    }
+
+    tokens.reserve((m_size + size - 1) / size);
+
+    std::size_t start = 0;
+    do {
+        tokens.push_back(substr(start, size));
+        start += size;
+    } while (start < m_size);
+
+    return tokens;
+}
+
+/**
+ * Copy the viewed characters into a string
+ *
+ * @return The copy
+ */
+std::string superstring_view::to_string() const {
+    return std::string(m_data, m_size);
+}
+
+/**
+ * Type conversion to a std::string. This copies, so it must be explicit
+ *
+ * @return A copy of the viewed characters
+ */
+superstring_view::operator std::string() const {
+    return to_string();
+}
+
+/**
+ * @return True if two views have the same characters
+ */
+bool operator==(superstring_view a, superstring_view b) noexcept {
+    return a.size() == b.size() && a.compare(b) == 0;
+}
+
+/**
+ * @return True if two views differ
+ */
+bool operator!=(superstring_view a, superstring_view b) noexcept {
+    return !(a == b);
+}
+
+/**
+ * @return True if \a a sorts before \a b
+ */
+bool operator<(superstring_view a, superstring_view b) noexcept {
+    return a.compare(b) < 0;
+}
+
+/**
+ * Write the viewed characters to a stream
+ *
+ * @param[in] stream The stream
+ * @param[in] view   The view
+ *
+ * @return \a stream
+ */
+std::ostream& operator<<(std::ostream& stream, superstring_view view) {
+    return stream.write(view.data(),
+                        static_cast<std::streamsize>(view.size()));
+}
+
+}  // namespace jfern
@@ -0,0 +1,154 @@
+/**
+ *  \file   thread_pool.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/thread_pool.h"
+
+#include <utility>
+
+namespace jfern {
+
+/**
+ * Constructor
+ *
+ * @param[in] threads The number of threads to run tasks on, including the
+ *                    one that calls run(). Zero is taken to mean one
+ */
+thread_pool::thread_pool(std::size_t threads)
+    : m_threads(),
+      m_run_mutex(),
+      m_mutex(),
+      m_start(),
+      m_done(),
+      m_task(nullptr),
+      m_tasks(0),
+      m_next(0),
+      m_pending(0),
+      m_batch(0),
+      m_error(),
+      m_stop(false) {
+    for (std::size_t i = 1; i < threads; i++)
+        m_threads.emplace_back(&thread_pool::work, this);
+}
+
+/**
+ * Destructor. Waits for the threads to exit
+ */
+thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+/**
+ * @return The number of threads tasks run on, including the caller of run()
+ */
+std::size_t thread_pool::size() const noexcept {
+    return m_threads.size() + 1;
+}
+
+/**
+ * Run a batch of tasks, and wait for them to finish. The calling thread runs
+ * tasks too
+ *
+ * @param[in] tasks The number of tasks
+ * @param[in] task  Called once with each number in [0, tasks), in no
+ *                  particular order and from any of the threads
+ *
+ * @throws The first exception thrown by a task, once the rest have finished
+ */
+void thread_pool::run(std::size_t tasks,
+                      const std::function<void(std::size_t)>& task) {
+    if (tasks == 0) return;
+
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task    = &task;
+        m_tasks   = tasks;
+        m_next    = 0;
+        m_pending = tasks;
+        m_error   = nullptr;
+        m_batch++;
+    }
+    m_start.notify_all();
+
+    take_tasks();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_pending == 0; });
+
+        m_task = nullptr;
+        error = std::move(m_error);
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+
+/**
+ * @return The number of hardware threads, or 1 if that is not known
+ */
+std::size_t thread_pool::default_threads() noexcept {
+    const unsigned int threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+/**
+ * The body of each thread: wait for a batch, help run it, repeat
+ */
+void thread_pool::work() {
+    std::size_t batch = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [&] { return m_stop || m_batch != batch; });
+
+            if (m_stop) return;
+            batch = m_batch;
+        }
+
+        take_tasks();
+    }
+}
+
+/**
+ * Run tasks from the current batch until there are none left to hand out
+ */
+void thread_pool::take_tasks() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_task && m_next < m_tasks) {
+        const std::function<void(std::size_t)>& task = *m_task;
+        const std::size_t index = m_next++;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            task(index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (error && !m_error) m_error = std::move(error);
+
+        if (--m_pending == 0) m_done.notify_one();
+    }
+}
+
+}  // namespace jfern
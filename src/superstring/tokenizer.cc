@@ -0,0 +1,252 @@
+/**
+ *  \file   tokenizer.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/tokenizer.h"
+
+namespace jfern {
+
+/**
+ * Constructor
+ *
+ * @param[in] c Tokens are separated by this character
+ */
+delimiter::delimiter(char c) noexcept : delimiter() {
+    m_kind = kind::character;
+    m_char = c;
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] str Tokens are separated by this null-terminated string
+ */
+delimiter::delimiter(const char* str) noexcept
+    : delimiter(superstring_view(str)) {
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] str Tokens are separated by this string
+ */
+delimiter::delimiter(const std::string& str) noexcept
+    : delimiter(superstring_view(str)) {
+}
+
+/**
+ * Constructor. A one-character string is searched for as a character
+ *
+ * @param[in] str Tokens are separated by this string. An empty string never
+ *                matches, leaving the whole text as a single token
+ */
+delimiter::delimiter(superstring_view str) noexcept : delimiter() {
+    if (str.size() == 1) {
+        m_kind = kind::character;
+        m_char = str[0];
+    } else {
+        m_kind = kind::substring;
+        m_str  = str;
+    }
+}
+
+/**
+ * Default constructor. Sets an empty string delimiter
+ */
+delimiter::delimiter() noexcept
+    : m_kind(kind::substring), m_char('\0'), m_str(), m_set() {
+}
+
+/**
+ * Create a delimiter that matches any single character from a set
+ *
+ * @param[in] chars The set of characters. If empty, nothing matches
+ *
+ * @return The delimiter
+ */
+delimiter delimiter::any_of(superstring_view chars) noexcept {
+    delimiter delim;
+    delim.m_kind = kind::any_of;
+    delim.m_set  = search::char_class(chars);
+
+    return delim;
+}
+
+/**
+ * Find the next occurrence of this delimiter
+ *
+ * @param[in]  text   The text to search
+ * @param[in]  pos    Where to begin searching
+ * @param[out] length The number of characters matched, if found
+ *
+ * @return The position of the delimiter, or superstring_view::npos if it was
+ *         not found
+ */
+std::size_t delimiter::find(superstring_view text, std::size_t pos,
+                            std::size_t* length) const noexcept {
+    if (pos >= text.size()) return superstring_view::npos;
+
+    const superstring_view rest(text.data() + pos, text.size() - pos);
+    std::size_t ind = superstring_view::npos;
+
+    switch (m_kind) {
+      case kind::character:
+        *length = 1;
+        ind = search::find(rest, m_char);
+        break;
+      case kind::substring:
+        if (m_str.empty()) return superstring_view::npos;
+        *length = m_str.size();
+        ind = search::find(rest, m_str);
+        break;
+      case kind::any_of:
+        *length = 1;
+        ind = search::find_first_of(rest, m_set);
+    }
+
+    return ind == superstring_view::npos ? ind : ind + pos;
+}
+
+/**
+ * Constructor
+ *
+ * @param[in] text       The text to split
+ * @param[in] delim      What separates the tokens
+ * @param[in] empties    Whether to report empty tokens
+ * @param[in] max_tokens Stop after this many tokens, the last of which holds
+ *                       the remainder of \a text, delimiters and all
+ */
+tokenizer::tokenizer(superstring_view text, delimiter delim,
+                     empty_tokens empties, std::size_t max_tokens) noexcept
+    : m_text(text),
+      m_delimiter(delim),
+      m_empties(empties),
+      m_max_tokens(max_tokens) {
+}
+
+/**
+ * @return An iterator to the first token. Finding it scans only as far as
+ *         the first delimiter
+ */
+tokenizer::iterator tokenizer::begin() const noexcept {
+    if (m_max_tokens == 0) return end();
+
+    return iterator(this);
+}
+
+/**
+ * @return An iterator past the last token
+ */
+tokenizer::iterator tokenizer::end() const noexcept {
+    return iterator();
+}
+
+/**
+ * Default constructor. Creates a past-the-end iterator
+ */
+tokenizer::iterator::iterator() noexcept
+    : m_range(nullptr), m_token(), m_next(superstring_view::npos),
+      m_count(0) {
+}
+
+/**
+ * Constructor. Positions the iterator on the first token
+ *
+ * @param[in] range The range to iterate
+ */
+tokenizer::iterator::iterator(const tokenizer* range) noexcept
+    : m_range(range), m_token(), m_next(0), m_count(0) {
+    advance();
+}
+
+/**
+ * Find the next token, becoming a past-the-end iterator if there is none
+ */
+void tokenizer::iterator::advance() noexcept {
+    const superstring_view text = m_range->m_text;
+    const bool keep = m_range->m_empties == empty_tokens::keep;
+
+    std::size_t length;
+
+    while (m_next != superstring_view::npos) {
+        const std::size_t start = m_next;
+
+        if (m_count + 1 == m_range->m_max_tokens) {
+            /*
+             * Final field: the rest of the text. When dropping empty tokens,
+             * step over any delimiters that would have produced them
+             */
+            std::size_t first = start;
+            while (!keep &&
+                   m_range->m_delimiter.find(text, first, &length) == first)
+                first += length;
+
+            m_next = superstring_view::npos;
+            if (keep || first < text.size()) {
+                m_token = superstring_view(text.data() + first,
+                                           text.size() - first);
+                m_count++;
+                return;
+            }
+
+            break;
+        }
+
+        const std::size_t ind = m_range->m_delimiter.find(text, start, &length);
+
+        if (ind == superstring_view::npos) {
+            m_token = superstring_view(text.data() + start,
+                                       text.size() - start);
+            m_next  = superstring_view::npos;
+        } else {
+            m_token = superstring_view(text.data() + start, ind - start);
+            m_next  = ind + length;
+        }
+
+        if (keep || !m_token.empty()) {
+            m_count++;
+            return;
+        }
+    }
+
+    m_range = nullptr;
+}
+
+/**
+ * Lazily split a string into tokens
+ *
+ * @param[in] text    The text to split. Must outlive the returned range
+ * @param[in] delim   What separates the tokens
+ * @param[in] empties Whether to report empty tokens. Dropping them matches
+ *                    \ref superstring::split()
+ *
+ * @return A range over the tokens
+ */
+tokenizer tokenize(superstring_view text, delimiter delim,
+                   empty_tokens empties) noexcept {
+    return tokenizer(text, delim, empties);
+}
+
+/**
+ * Lazily split a string into at most \a n tokens. The last one holds the
+ * remainder of the text, unsplit
+ *
+ * @param[in] text    The text to split. Must outlive the returned range
+ * @param[in] n       The maximum number of tokens
+ * @param[in] delim   What separates the tokens
+ * @param[in] empties Whether to report empty tokens
+ *
+ * @return A range over the tokens
+ */
+tokenizer split_n(superstring_view text, std::size_t n, delimiter delim,
+                  empty_tokens empties) noexcept {
+    return tokenizer(text, delim, empties, n);
+}
+
+}  // namespace jfern
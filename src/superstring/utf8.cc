@@ -0,0 +1,1265 @@
+/**
+ *  \file   utf8.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include "superstring/utf8.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "bitops/bitops.h"
+#include "superstring/case_map.h"
+#include "superstring/search.h"
+
+/*
+ * As in search.cc, the vector kernels carry their own target attributes and
+ * are only called when search::active_level() says the CPU has them
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILITY_UTF8_X86 1
+#include <immintrin.h>
+#define UTILITY_TARGET_SSE2 __attribute__((target("sse2")))
+#define UTILITY_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace jfern {
+namespace utf8 {
+
+namespace {
+
+constexpr std::size_t npos = superstring_view::npos;
+
+/*
+ * A run of code points with the same case mapping: \a count code points
+ * starting at \a first, \a stride apart, each of which maps to itself plus
+ * \a delta. Stride 2 covers the alphabets that alternate upper and lower
+ * case, such as Latin Extended-A
+ */
+struct case_run {
+    std::uint32_t first;
+    std::uint16_t count;
+    std::uint8_t  stride;
+    std::int32_t  delta;
+};
+
+/*
+ * The tables below are generated from the Unicode Character Database,
+ * version 14.0 (CaseFolding.txt, statuses C and S, and the simple mappings
+ * of UnicodeData.txt). ASCII is left out, and handled directly
+ */
+
+/** Simple case folding */
+constexpr case_run fold_runs[] = {
+    {0x000B5,     1, 1,    775},
+    {0x000C0,    23, 1,     32},
+    {0x000D8,     7, 1,     32},
+    {0x00100,    24, 2,      1},
+    {0x00132,     3, 2,      1},
+    {0x00139,     8, 2,      1},
+    {0x0014A,    23, 2,      1},
+    {0x00178,     1, 1,   -121},
+    {0x00179,     3, 2,      1},
+    {0x0017F,     1, 1,   -268},
+    {0x00181,     1, 1,    210},
+    {0x00182,     2, 2,      1},
+    {0x00186,     1, 1,    206},
+    {0x00187,     1, 1,      1},
+    {0x00189,     2, 1,    205},
+    {0x0018B,     1, 1,      1},
+    {0x0018E,     1, 1,     79},
+    {0x0018F,     1, 1,    202},
+    {0x00190,     1, 1,    203},
+    {0x00191,     1, 1,      1},
+    {0x00193,     1, 1,    205},
+    {0x00194,     1, 1,    207},
+    {0x00196,     1, 1,    211},
+    {0x00197,     1, 1,    209},
+    {0x00198,     1, 1,      1},
+    {0x0019C,     1, 1,    211},
+    {0x0019D,     1, 1,    213},
+    {0x0019F,     1, 1,    214},
+    {0x001A0,     3, 2,      1},
+    {0x001A6,     1, 1,    218},
+    {0x001A7,     1, 1,      1},
+    {0x001A9,     1, 1,    218},
+    {0x001AC,     1, 1,      1},
+    {0x001AE,     1, 1,    218},
+    {0x001AF,     1, 1,      1},
+    {0x001B1,     2, 1,    217},
+    {0x001B3,     2, 2,      1},
+    {0x001B7,     1, 1,    219},
+    {0x001B8,     1, 1,      1},
+    {0x001BC,     1, 1,      1},
+    {0x001C4,     1, 1,      2},
+    {0x001C5,     1, 1,      1},
+    {0x001C7,     1, 1,      2},
+    {0x001C8,     1, 1,      1},
+    {0x001CA,     1, 1,      2},
+    {0x001CB,     9, 2,      1},
+    {0x001DE,     9, 2,      1},
+    {0x001F1,     1, 1,      2},
+    {0x001F2,     2, 2,      1},
+    {0x001F6,     1, 1,    -97},
+    {0x001F7,     1, 1,    -56},
+    {0x001F8,    20, 2,      1},
+    {0x00220,     1, 1,   -130},
+    {0x00222,     9, 2,      1},
+    {0x0023A,     1, 1,  10795},
+    {0x0023B,     1, 1,      1},
+    {0x0023D,     1, 1,   -163},
+    {0x0023E,     1, 1,  10792},
+    {0x00241,     1, 1,      1},
+    {0x00243,     1, 1,   -195},
+    {0x00244,     1, 1,     69},
+    {0x00245,     1, 1,     71},
+    {0x00246,     5, 2,      1},
+    {0x00345,     1, 1,    116},
+    {0x00370,     2, 2,      1},
+    {0x00376,     1, 1,      1},
+    {0x0037F,     1, 1,    116},
+    {0x00386,     1, 1,     38},
+    {0x00388,     3, 1,     37},
+    {0x0038C,     1, 1,     64},
+    {0x0038E,     2, 1,     63},
+    {0x00391,    17, 1,     32},
+    {0x003A3,     9, 1,     32},
+    {0x003C2,     1, 1,      1},
+    {0x003CF,     1, 1,      8},
+    {0x003D0,     1, 1,    -30},
+    {0x003D1,     1, 1,    -25},
+    {0x003D5,     1, 1,    -15},
+    {0x003D6,     1, 1,    -22},
+    {0x003D8,    12, 2,      1},
+    {0x003F0,     1, 1,    -54},
+    {0x003F1,     1, 1,    -48},
+    {0x003F4,     1, 1,    -60},
+    {0x003F5,     1, 1,    -64},
+    {0x003F7,     1, 1,      1},
+    {0x003F9,     1, 1,     -7},
+    {0x003FA,     1, 1,      1},
+    {0x003FD,     3, 1,   -130},
+    {0x00400,    16, 1,     80},
+    {0x00410,    32, 1,     32},
+    {0x00460,    17, 2,      1},
+    {0x0048A,    27, 2,      1},
+    {0x004C0,     1, 1,     15},
+    {0x004C1,     7, 2,      1},
+    {0x004D0,    48, 2,      1},
+    {0x00531,    38, 1,     48},
+    {0x010A0,    38, 1,   7264},
+    {0x010C7,     1, 1,   7264},
+    {0x010CD,     1, 1,   7264},
+    {0x013F8,     6, 1,     -8},
+    {0x01C80,     1, 1,  -6222},
+    {0x01C81,     1, 1,  -6221},
+    {0x01C82,     1, 1,  -6212},
+    {0x01C83,     2, 1,  -6210},
+    {0x01C85,     1, 1,  -6211},
+    {0x01C86,     1, 1,  -6204},
+    {0x01C87,     1, 1,  -6180},
+    {0x01C88,     1, 1,  35267},
+    {0x01C90,    43, 1,  -3008},
+    {0x01CBD,     3, 1,  -3008},
+    {0x01E00,    75, 2,      1},
+    {0x01E9B,     1, 1,    -58},
+    {0x01E9E,     1, 1,  -7615},
+    {0x01EA0,    48, 2,      1},
+    {0x01F08,     8, 1,     -8},
+    {0x01F18,     6, 1,     -8},
+    {0x01F28,     8, 1,     -8},
+    {0x01F38,     8, 1,     -8},
+    {0x01F48,     6, 1,     -8},
+    {0x01F59,     4, 2,     -8},
+    {0x01F68,     8, 1,     -8},
+    {0x01F88,     8, 1,     -8},
+    {0x01F98,     8, 1,     -8},
+    {0x01FA8,     8, 1,     -8},
+    {0x01FB8,     2, 1,     -8},
+    {0x01FBA,     2, 1,    -74},
+    {0x01FBC,     1, 1,     -9},
+    {0x01FBE,     1, 1,  -7173},
+    {0x01FC8,     4, 1,    -86},
+    {0x01FCC,     1, 1,     -9},
+    {0x01FD8,     2, 1,     -8},
+    {0x01FDA,     2, 1,   -100},
+    {0x01FE8,     2, 1,     -8},
+    {0x01FEA,     2, 1,   -112},
+    {0x01FEC,     1, 1,     -7},
+    {0x01FF8,     2, 1,   -128},
+    {0x01FFA,     2, 1,   -126},
+    {0x01FFC,     1, 1,     -9},
+    {0x02126,     1, 1,  -7517},
+    {0x0212A,     1, 1,  -8383},
+    {0x0212B,     1, 1,  -8262},
+    {0x02132,     1, 1,     28},
+    {0x02160,    16, 1,     16},
+    {0x02183,     1, 1,      1},
+    {0x024B6,    26, 1,     26},
+    {0x02C00,    48, 1,     48},
+    {0x02C60,     1, 1,      1},
+    {0x02C62,     1, 1, -10743},
+    {0x02C63,     1, 1,  -3814},
+    {0x02C64,     1, 1, -10727},
+    {0x02C67,     3, 2,      1},
+    {0x02C6D,     1, 1, -10780},
+    {0x02C6E,     1, 1, -10749},
+    {0x02C6F,     1, 1, -10783},
+    {0x02C70,     1, 1, -10782},
+    {0x02C72,     1, 1,      1},
+    {0x02C75,     1, 1,      1},
+    {0x02C7E,     2, 1, -10815},
+    {0x02C80,    50, 2,      1},
+    {0x02CEB,     2, 2,      1},
+    {0x02CF2,     1, 1,      1},
+    {0x0A640,    23, 2,      1},
+    {0x0A680,    14, 2,      1},
+    {0x0A722,     7, 2,      1},
+    {0x0A732,    31, 2,      1},
+    {0x0A779,     2, 2,      1},
+    {0x0A77D,     1, 1, -35332},
+    {0x0A77E,     5, 2,      1},
+    {0x0A78B,     1, 1,      1},
+    {0x0A78D,     1, 1, -42280},
+    {0x0A790,     2, 2,      1},
+    {0x0A796,    10, 2,      1},
+    {0x0A7AA,     1, 1, -42308},
+    {0x0A7AB,     1, 1, -42319},
+    {0x0A7AC,     1, 1, -42315},
+    {0x0A7AD,     1, 1, -42305},
+    {0x0A7AE,     1, 1, -42308},
+    {0x0A7B0,     1, 1, -42258},
+    {0x0A7B1,     1, 1, -42282},
+    {0x0A7B2,     1, 1, -42261},
+    {0x0A7B3,     1, 1,    928},
+    {0x0A7B4,     8, 2,      1},
+    {0x0A7C4,     1, 1,    -48},
+    {0x0A7C5,     1, 1, -42307},
+    {0x0A7C6,     1, 1, -35384},
+    {0x0A7C7,     2, 2,      1},
+    {0x0A7D0,     1, 1,      1},
+    {0x0A7D6,     2, 2,      1},
+    {0x0A7F5,     1, 1,      1},
+    {0x0AB70,    80, 1, -38864},
+    {0x0FF21,    26, 1,     32},
+    {0x10400,    40, 1,     40},
+    {0x104B0,    36, 1,     40},
+    {0x10570,    11, 1,     39},
+    {0x1057C,    15, 1,     39},
+    {0x1058C,     7, 1,     39},
+    {0x10594,     2, 1,     39},
+    {0x10C80,    51, 1,     64},
+    {0x118A0,    32, 1,     32},
+    {0x16E40,    32, 1,     32},
+    {0x1E900,    34, 1,     34},
+};
+
+/** Simple lower case mappings */
+constexpr case_run lower_runs[] = {
+    {0x000C0,    23, 1,     32},
+    {0x000D8,     7, 1,     32},
+    {0x00100,    24, 2,      1},
+    {0x00130,     1, 1,   -199},
+    {0x00132,     3, 2,      1},
+    {0x00139,     8, 2,      1},
+    {0x0014A,    23, 2,      1},
+    {0x00178,     1, 1,   -121},
+    {0x00179,     3, 2,      1},
+    {0x00181,     1, 1,    210},
+    {0x00182,     2, 2,      1},
+    {0x00186,     1, 1,    206},
+    {0x00187,     1, 1,      1},
+    {0x00189,     2, 1,    205},
+    {0x0018B,     1, 1,      1},
+    {0x0018E,     1, 1,     79},
+    {0x0018F,     1, 1,    202},
+    {0x00190,     1, 1,    203},
+    {0x00191,     1, 1,      1},
+    {0x00193,     1, 1,    205},
+    {0x00194,     1, 1,    207},
+    {0x00196,     1, 1,    211},
+    {0x00197,     1, 1,    209},
+    {0x00198,     1, 1,      1},
+    {0x0019C,     1, 1,    211},
+    {0x0019D,     1, 1,    213},
+    {0x0019F,     1, 1,    214},
+    {0x001A0,     3, 2,      1},
+    {0x001A6,     1, 1,    218},
+    {0x001A7,     1, 1,      1},
+    {0x001A9,     1, 1,    218},
+    {0x001AC,     1, 1,      1},
+    {0x001AE,     1, 1,    218},
+    {0x001AF,     1, 1,      1},
+    {0x001B1,     2, 1,    217},
+    {0x001B3,     2, 2,      1},
+    {0x001B7,     1, 1,    219},
+    {0x001B8,     1, 1,      1},
+    {0x001BC,     1, 1,      1},
+    {0x001C4,     1, 1,      2},
+    {0x001C5,     1, 1,      1},
+    {0x001C7,     1, 1,      2},
+    {0x001C8,     1, 1,      1},
+    {0x001CA,     1, 1,      2},
+    {0x001CB,     9, 2,      1},
+    {0x001DE,     9, 2,      1},
+    {0x001F1,     1, 1,      2},
+    {0x001F2,     2, 2,      1},
+    {0x001F6,     1, 1,    -97},
+    {0x001F7,     1, 1,    -56},
+    {0x001F8,    20, 2,      1},
+    {0x00220,     1, 1,   -130},
+    {0x00222,     9, 2,      1},
+    {0x0023A,     1, 1,  10795},
+    {0x0023B,     1, 1,      1},
+    {0x0023D,     1, 1,   -163},
+    {0x0023E,     1, 1,  10792},
+    {0x00241,     1, 1,      1},
+    {0x00243,     1, 1,   -195},
+    {0x00244,     1, 1,     69},
+    {0x00245,     1, 1,     71},
+    {0x00246,     5, 2,      1},
+    {0x00370,     2, 2,      1},
+    {0x00376,     1, 1,      1},
+    {0x0037F,     1, 1,    116},
+    {0x00386,     1, 1,     38},
+    {0x00388,     3, 1,     37},
+    {0x0038C,     1, 1,     64},
+    {0x0038E,     2, 1,     63},
+    {0x00391,    17, 1,     32},
+    {0x003A3,     9, 1,     32},
+    {0x003CF,     1, 1,      8},
+    {0x003D8,    12, 2,      1},
+    {0x003F4,     1, 1,    -60},
+    {0x003F7,     1, 1,      1},
+    {0x003F9,     1, 1,     -7},
+    {0x003FA,     1, 1,      1},
+    {0x003FD,     3, 1,   -130},
+    {0x00400,    16, 1,     80},
+    {0x00410,    32, 1,     32},
+    {0x00460,    17, 2,      1},
+    {0x0048A,    27, 2,      1},
+    {0x004C0,     1, 1,     15},
+    {0x004C1,     7, 2,      1},
+    {0x004D0,    48, 2,      1},
+    {0x00531,    38, 1,     48},
+    {0x010A0,    38, 1,   7264},
+    {0x010C7,     1, 1,   7264},
+    {0x010CD,     1, 1,   7264},
+    {0x013A0,    80, 1,  38864},
+    {0x013F0,     6, 1,      8},
+    {0x01C90,    43, 1,  -3008},
+    {0x01CBD,     3, 1,  -3008},
+    {0x01E00,    75, 2,      1},
+    {0x01E9E,     1, 1,  -7615},
+    {0x01EA0,    48, 2,      1},
+    {0x01F08,     8, 1,     -8},
+    {0x01F18,     6, 1,     -8},
+    {0x01F28,     8, 1,     -8},
+    {0x01F38,     8, 1,     -8},
+    {0x01F48,     6, 1,     -8},
+    {0x01F59,     4, 2,     -8},
+    {0x01F68,     8, 1,     -8},
+    {0x01F88,     8, 1,     -8},
+    {0x01F98,     8, 1,     -8},
+    {0x01FA8,     8, 1,     -8},
+    {0x01FB8,     2, 1,     -8},
+    {0x01FBA,     2, 1,    -74},
+    {0x01FBC,     1, 1,     -9},
+    {0x01FC8,     4, 1,    -86},
+    {0x01FCC,     1, 1,     -9},
+    {0x01FD8,     2, 1,     -8},
+    {0x01FDA,     2, 1,   -100},
+    {0x01FE8,     2, 1,     -8},
+    {0x01FEA,     2, 1,   -112},
+    {0x01FEC,     1, 1,     -7},
+    {0x01FF8,     2, 1,   -128},
+    {0x01FFA,     2, 1,   -126},
+    {0x01FFC,     1, 1,     -9},
+    {0x02126,     1, 1,  -7517},
+    {0x0212A,     1, 1,  -8383},
+    {0x0212B,     1, 1,  -8262},
+    {0x02132,     1, 1,     28},
+    {0x02160,    16, 1,     16},
+    {0x02183,     1, 1,      1},
+    {0x024B6,    26, 1,     26},
+    {0x02C00,    48, 1,     48},
+    {0x02C60,     1, 1,      1},
+    {0x02C62,     1, 1, -10743},
+    {0x02C63,     1, 1,  -3814},
+    {0x02C64,     1, 1, -10727},
+    {0x02C67,     3, 2,      1},
+    {0x02C6D,     1, 1, -10780},
+    {0x02C6E,     1, 1, -10749},
+    {0x02C6F,     1, 1, -10783},
+    {0x02C70,     1, 1, -10782},
+    {0x02C72,     1, 1,      1},
+    {0x02C75,     1, 1,      1},
+    {0x02C7E,     2, 1, -10815},
+    {0x02C80,    50, 2,      1},
+    {0x02CEB,     2, 2,      1},
+    {0x02CF2,     1, 1,      1},
+    {0x0A640,    23, 2,      1},
+    {0x0A680,    14, 2,      1},
+    {0x0A722,     7, 2,      1},
+    {0x0A732,    31, 2,      1},
+    {0x0A779,     2, 2,      1},
+    {0x0A77D,     1, 1, -35332},
+    {0x0A77E,     5, 2,      1},
+    {0x0A78B,     1, 1,      1},
+    {0x0A78D,     1, 1, -42280},
+    {0x0A790,     2, 2,      1},
+    {0x0A796,    10, 2,      1},
+    {0x0A7AA,     1, 1, -42308},
+    {0x0A7AB,     1, 1, -42319},
+    {0x0A7AC,     1, 1, -42315},
+    {0x0A7AD,     1, 1, -42305},
+    {0x0A7AE,     1, 1, -42308},
+    {0x0A7B0,     1, 1, -42258},
+    {0x0A7B1,     1, 1, -42282},
+    {0x0A7B2,     1, 1, -42261},
+    {0x0A7B3,     1, 1,    928},
+    {0x0A7B4,     8, 2,      1},
+    {0x0A7C4,     1, 1,    -48},
+    {0x0A7C5,     1, 1, -42307},
+    {0x0A7C6,     1, 1, -35384},
+    {0x0A7C7,     2, 2,      1},
+    {0x0A7D0,     1, 1,      1},
+    {0x0A7D6,     2, 2,      1},
+    {0x0A7F5,     1, 1,      1},
+    {0x0FF21,    26, 1,     32},
+    {0x10400,    40, 1,     40},
+    {0x104B0,    36, 1,     40},
+    {0x10570,    11, 1,     39},
+    {0x1057C,    15, 1,     39},
+    {0x1058C,     7, 1,     39},
+    {0x10594,     2, 1,     39},
+    {0x10C80,    51, 1,     64},
+    {0x118A0,    32, 1,     32},
+    {0x16E40,    32, 1,     32},
+    {0x1E900,    34, 1,     34},
+};
+
+/** Simple upper case mappings */
+constexpr case_run upper_runs[] = {
+    {0x000B5,     1, 1,    743},
+    {0x000E0,    23, 1,    -32},
+    {0x000F8,     7, 1,    -32},
+    {0x000FF,     1, 1,    121},
+    {0x00101,    24, 2,     -1},
+    {0x00131,     1, 1,   -232},
+    {0x00133,     3, 2,     -1},
+    {0x0013A,     8, 2,     -1},
+    {0x0014B,    23, 2,     -1},
+    {0x0017A,     3, 2,     -1},
+    {0x0017F,     1, 1,   -300},
+    {0x00180,     1, 1,    195},
+    {0x00183,     2, 2,     -1},
+    {0x00188,     1, 1,     -1},
+    {0x0018C,     1, 1,     -1},
+    {0x00192,     1, 1,     -1},
+    {0x00195,     1, 1,     97},
+    {0x00199,     1, 1,     -1},
+    {0x0019A,     1, 1,    163},
+    {0x0019E,     1, 1,    130},
+    {0x001A1,     3, 2,     -1},
+    {0x001A8,     1, 1,     -1},
+    {0x001AD,     1, 1,     -1},
+    {0x001B0,     1, 1,     -1},
+    {0x001B4,     2, 2,     -1},
+    {0x001B9,     1, 1,     -1},
+    {0x001BD,     1, 1,     -1},
+    {0x001BF,     1, 1,     56},
+    {0x001C5,     1, 1,     -1},
+    {0x001C6,     1, 1,     -2},
+    {0x001C8,     1, 1,     -1},
+    {0x001C9,     1, 1,     -2},
+    {0x001CB,     1, 1,     -1},
+    {0x001CC,     1, 1,     -2},
+    {0x001CE,     8, 2,     -1},
+    {0x001DD,     1, 1,    -79},
+    {0x001DF,     9, 2,     -1},
+    {0x001F2,     1, 1,     -1},
+    {0x001F3,     1, 1,     -2},
+    {0x001F5,     1, 1,     -1},
+    {0x001F9,    20, 2,     -1},
+    {0x00223,     9, 2,     -1},
+    {0x0023C,     1, 1,     -1},
+    {0x0023F,     2, 1,  10815},
+    {0x00242,     1, 1,     -1},
+    {0x00247,     5, 2,     -1},
+    {0x00250,     1, 1,  10783},
+    {0x00251,     1, 1,  10780},
+    {0x00252,     1, 1,  10782},
+    {0x00253,     1, 1,   -210},
+    {0x00254,     1, 1,   -206},
+    {0x00256,     2, 1,   -205},
+    {0x00259,     1, 1,   -202},
+    {0x0025B,     1, 1,   -203},
+    {0x0025C,     1, 1,  42319},
+    {0x00260,     1, 1,   -205},
+    {0x00261,     1, 1,  42315},
+    {0x00263,     1, 1,   -207},
+    {0x00265,     1, 1,  42280},
+    {0x00266,     1, 1,  42308},
+    {0x00268,     1, 1,   -209},
+    {0x00269,     1, 1,   -211},
+    {0x0026A,     1, 1,  42308},
+    {0x0026B,     1, 1,  10743},
+    {0x0026C,     1, 1,  42305},
+    {0x0026F,     1, 1,   -211},
+    {0x00271,     1, 1,  10749},
+    {0x00272,     1, 1,   -213},
+    {0x00275,     1, 1,   -214},
+    {0x0027D,     1, 1,  10727},
+    {0x00280,     1, 1,   -218},
+    {0x00282,     1, 1,  42307},
+    {0x00283,     1, 1,   -218},
+    {0x00287,     1, 1,  42282},
+    {0x00288,     1, 1,   -218},
+    {0x00289,     1, 1,    -69},
+    {0x0028A,     2, 1,   -217},
+    {0x0028C,     1, 1,    -71},
+    {0x00292,     1, 1,   -219},
+    {0x0029D,     1, 1,  42261},
+    {0x0029E,     1, 1,  42258},
+    {0x00345,     1, 1,     84},
+    {0x00371,     2, 2,     -1},
+    {0x00377,     1, 1,     -1},
+    {0x0037B,     3, 1,    130},
+    {0x003AC,     1, 1,    -38},
+    {0x003AD,     3, 1,    -37},
+    {0x003B1,    17, 1,    -32},
+    {0x003C2,     1, 1,    -31},
+    {0x003C3,     9, 1,    -32},
+    {0x003CC,     1, 1,    -64},
+    {0x003CD,     2, 1,    -63},
+    {0x003D0,     1, 1,    -62},
+    {0x003D1,     1, 1,    -57},
+    {0x003D5,     1, 1,    -47},
+    {0x003D6,     1, 1,    -54},
+    {0x003D7,     1, 1,     -8},
+    {0x003D9,    12, 2,     -1},
+    {0x003F0,     1, 1,    -86},
+    {0x003F1,     1, 1,    -80},
+    {0x003F2,     1, 1,      7},
+    {0x003F3,     1, 1,   -116},
+    {0x003F5,     1, 1,    -96},
+    {0x003F8,     1, 1,     -1},
+    {0x003FB,     1, 1,     -1},
+    {0x00430,    32, 1,    -32},
+    {0x00450,    16, 1,    -80},
+    {0x00461,    17, 2,     -1},
+    {0x0048B,    27, 2,     -1},
+    {0x004C2,     7, 2,     -1},
+    {0x004CF,     1, 1,    -15},
+    {0x004D1,    48, 2,     -1},
+    {0x00561,    38, 1,    -48},
+    {0x010D0,    43, 1,   3008},
+    {0x010FD,     3, 1,   3008},
+    {0x013F8,     6, 1,     -8},
+    {0x01C80,     1, 1,  -6254},
+    {0x01C81,     1, 1,  -6253},
+    {0x01C82,     1, 1,  -6244},
+    {0x01C83,     2, 1,  -6242},
+    {0x01C85,     1, 1,  -6243},
+    {0x01C86,     1, 1,  -6236},
+    {0x01C87,     1, 1,  -6181},
+    {0x01C88,     1, 1,  35266},
+    {0x01D79,     1, 1,  35332},
+    {0x01D7D,     1, 1,   3814},
+    {0x01D8E,     1, 1,  35384},
+    {0x01E01,    75, 2,     -1},
+    {0x01E9B,     1, 1,    -59},
+    {0x01EA1,    48, 2,     -1},
+    {0x01F00,     8, 1,      8},
+    {0x01F10,     6, 1,      8},
+    {0x01F20,     8, 1,      8},
+    {0x01F30,     8, 1,      8},
+    {0x01F40,     6, 1,      8},
+    {0x01F51,     4, 2,      8},
+    {0x01F60,     8, 1,      8},
+    {0x01F70,     2, 1,     74},
+    {0x01F72,     4, 1,     86},
+    {0x01F76,     2, 1,    100},
+    {0x01F78,     2, 1,    128},
+    {0x01F7A,     2, 1,    112},
+    {0x01F7C,     2, 1,    126},
+    {0x01F80,     8, 1,      8},
+    {0x01F90,     8, 1,      8},
+    {0x01FA0,     8, 1,      8},
+    {0x01FB0,     2, 1,      8},
+    {0x01FB3,     1, 1,      9},
+    {0x01FBE,     1, 1,  -7205},
+    {0x01FC3,     1, 1,      9},
+    {0x01FD0,     2, 1,      8},
+    {0x01FE0,     2, 1,      8},
+    {0x01FE5,     1, 1,      7},
+    {0x01FF3,     1, 1,      9},
+    {0x0214E,     1, 1,    -28},
+    {0x02170,    16, 1,    -16},
+    {0x02184,     1, 1,     -1},
+    {0x024D0,    26, 1,    -26},
+    {0x02C30,    48, 1,    -48},
+    {0x02C61,     1, 1,     -1},
+    {0x02C65,     1, 1, -10795},
+    {0x02C66,     1, 1, -10792},
+    {0x02C68,     3, 2,     -1},
+    {0x02C73,     1, 1,     -1},
+    {0x02C76,     1, 1,     -1},
+    {0x02C81,    50, 2,     -1},
+    {0x02CEC,     2, 2,     -1},
+    {0x02CF3,     1, 1,     -1},
+    {0x02D00,    38, 1,  -7264},
+    {0x02D27,     1, 1,  -7264},
+    {0x02D2D,     1, 1,  -7264},
+    {0x0A641,    23, 2,     -1},
+    {0x0A681,    14, 2,     -1},
+    {0x0A723,     7, 2,     -1},
+    {0x0A733,    31, 2,     -1},
+    {0x0A77A,     2, 2,     -1},
+    {0x0A77F,     5, 2,     -1},
+    {0x0A78C,     1, 1,     -1},
+    {0x0A791,     2, 2,     -1},
+    {0x0A794,     1, 1,     48},
+    {0x0A797,    10, 2,     -1},
+    {0x0A7B5,     8, 2,     -1},
+    {0x0A7C8,     2, 2,     -1},
+    {0x0A7D1,     1, 1,     -1},
+    {0x0A7D7,     2, 2,     -1},
+    {0x0A7F6,     1, 1,     -1},
+    {0x0AB53,     1, 1,   -928},
+    {0x0AB70,    80, 1, -38864},
+    {0x0FF41,    26, 1,    -32},
+    {0x10428,    40, 1,    -40},
+    {0x104D8,    36, 1,    -40},
+    {0x10597,    11, 1,    -39},
+    {0x105A3,    15, 1,    -39},
+    {0x105B3,     7, 1,    -39},
+    {0x105BB,     2, 1,    -39},
+    {0x10CC0,    51, 1,    -64},
+    {0x118C0,    32, 1,    -32},
+    {0x16E60,    32, 1,    -32},
+    {0x1E922,    34, 1,    -34},
+};
+
+/*
+ * Look up a code point's mapping in a table of runs
+ */
+template <std::size_t N>
+char32_t map(const case_run (&runs)[N], char32_t c) noexcept {
+    const case_run* run = std::upper_bound(
+        runs, runs + N, c, [](char32_t value, const case_run& entry) {
+            return value < entry.first;
+        });
+
+    if (run == runs) return c;
+    run--;
+
+    const char32_t offset = c - run->first;
+    if (offset % run->stride != 0 || offset / run->stride >= run->count)
+        return c;
+
+    return static_cast<char32_t>(static_cast<std::int32_t>(c) + run->delta);
+}
+
+bool is_continuation(char c) noexcept {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+/*
+ * Decode one code point
+ *
+ * @param[in]  data   The bytes
+ * @param[in]  size   The number of bytes, at least 1
+ * @param[out] c      The code point
+ *
+ * @return The length of its encoding, or 0 if the bytes at \a data are not
+ *         a well-formed UTF-8 sequence
+ */
+std::size_t decode(const char* data, std::size_t size, char32_t* c) noexcept {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+    const unsigned int lead = bytes[0];
+
+    if (lead < 0x80) {
+        *c = lead;
+        return 1;
+    }
+
+    /*
+     * The length, and the range of the second byte, from the Unicode
+     * standard's table of well-formed byte sequences
+     */
+    std::size_t length;
+    unsigned int low = 0x80, high = 0xBF;
+    char32_t value;
+
+    if (lead < 0xC2) {
+        return 0;
+    } else if (lead < 0xE0) {
+        length = 2;
+        value = lead & 0x1F;
+    } else if (lead < 0xF0) {
+        length = 3;
+        value = lead & 0x0F;
+        if (lead == 0xE0) low  = 0xA0;
+        if (lead == 0xED) high = 0x9F;
+    } else if (lead < 0xF5) {
+        length = 4;
+        value = lead & 0x07;
+        if (lead == 0xF0) low  = 0x90;
+        if (lead == 0xF4) high = 0x8F;
+    } else {
+        return 0;
+    }
+
+    if (size < length || bytes[1] < low || bytes[1] > high) return 0;
+
+    value = (value << 6) | (bytes[1] & 0x3F);
+    for (std::size_t i = 2; i < length; i++) {
+        if (!is_continuation(data[i])) return 0;
+        value = (value << 6) | (bytes[i] & 0x3F);
+    }
+
+    *c = value;
+    return length;
+}
+
+/*
+ * Encode a code point, which must be valid
+ */
+void encode(char32_t c, std::string* out) {
+    if (c < 0x80) {
+        out->push_back(static_cast<char>(c));
+    } else if (c < 0x800) {
+        out->push_back(static_cast<char>(0xC0 | (c >> 6)));
+        out->push_back(static_cast<char>(0x80 | (c & 0x3F)));
+    } else if (c < 0x10000) {
+        out->push_back(static_cast<char>(0xE0 | (c >> 12)));
+        out->push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (c & 0x3F)));
+    } else {
+        out->push_back(static_cast<char>(0xF0 | (c >> 18)));
+        out->push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (c & 0x3F)));
+    }
+}
+
+/*
+ * Scalar kernels. These also finish off the tails that are too short for a
+ * full vector
+ */
+
+/* The bytes of a word that have the top bit set */
+constexpr std::uint64_t high_bits = 0x8080808080808080ull;
+
+std::size_t ascii_length_scalar(const char* data, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        if (word & high_bits) break;
+    }
+
+    while (i < size && static_cast<unsigned char>(data[i]) < 0x80) i++;
+    return i;
+}
+
+std::size_t length_scalar(const char* data, std::size_t size) {
+    std::size_t continuations = 0, i = 0;
+
+    /* A continuation byte has its top bit set and the next one clear */
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        continuations += bitops::count(word & ~(word << 1) & high_bits);
+    }
+
+    for (; i < size; i++) continuations += is_continuation(data[i]);
+
+    return size - continuations;
+}
+
+/*
+ * Find the first ill-formed sequence by skipping runs of ASCII and decoding
+ * the rest
+ */
+template <class AsciiLength>
+std::size_t find_invalid_sequential(const char* data, std::size_t size,
+                                    AsciiLength ascii_length) {
+    std::size_t i = 0;
+    while (true) {
+        i += ascii_length(data + i, size - i);
+        if (i == size) return npos;
+
+        char32_t c;
+        const std::size_t length = decode(data + i, size - i, &c);
+        if (length == 0) return i;
+
+        i += length;
+    }
+}
+
+#ifdef UTILITY_UTF8_X86
+
+UTILITY_TARGET_SSE2
+std::size_t ascii_length_sse2(const char* data, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const int mask = _mm_movemask_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    return i + ascii_length_scalar(data + i, size - i);
+}
+
+UTILITY_TARGET_SSE2
+std::size_t length_sse2(const char* data, std::size_t size) {
+    /* Bytes above 0xBF, as signed bytes, are those that start a code point */
+    const __m128i last_continuation = _mm_set1_epi8(-65);
+
+    std::size_t starts = 0, i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        starts += bitops::count(static_cast<unsigned int>(_mm_movemask_epi8(
+            _mm_cmpgt_epi8(block, last_continuation))));
+    }
+
+    return starts + length_scalar(data + i, size - i);
+}
+
+UTILITY_TARGET_AVX2
+std::size_t ascii_length_avx2(const char* data, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const unsigned int mask = _mm256_movemask_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    return i + ascii_length_scalar(data + i, size - i);
+}
+
+UTILITY_TARGET_AVX2
+std::size_t length_avx2(const char* data, std::size_t size) {
+    const __m256i last_continuation = _mm256_set1_epi8(-65);
+
+    std::size_t starts = 0, i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        starts += bitops::count(static_cast<unsigned int>(
+            _mm256_movemask_epi8(
+                _mm256_cmpgt_epi8(block, last_continuation))));
+    }
+
+    return starts + length_scalar(data + i, size - i);
+}
+
+/*
+ * The error classes of the lookup method. Each is set in the entries of all
+ * three tables that, together, make a pair of bytes that error
+ */
+constexpr char too_short      = 1 << 0;  // Lead byte, then no continuation
+constexpr char too_long       = 1 << 1;  // ASCII, then a continuation
+constexpr char overlong_3     = 1 << 2;  // E0, then 80-9F
+constexpr char too_large      = 1 << 3;  // F4, then 90-BF, or F5 and up
+constexpr char surrogate      = 1 << 4;  // ED, then A0-BF
+constexpr char overlong_2     = 1 << 5;  // C0 or C1
+constexpr char too_large_1000 = 1 << 6;  // F5 and up, then 80-8F
+constexpr char overlong_4     = 1 << 6;  // F0, then 80-8F
+constexpr char two_conts      = static_cast<char>(1 << 7);
+constexpr char carry          = too_short | too_long | two_conts;
+
+/*
+ * The 32 bytes before each byte of a block, shifted in from the previous
+ * block
+ */
+template <int N>
+UTILITY_TARGET_AVX2
+inline __m256i previous(__m256i block, __m256i previous_block) {
+    return _mm256_alignr_epi8(
+        block, _mm256_permute2x128_si256(previous_block, block, 0x21),
+        16 - N);
+}
+
+UTILITY_TARGET_AVX2
+inline __m256i high_nibbles(__m256i block) {
+    return _mm256_and_si256(_mm256_srli_epi16(block, 4),
+                            _mm256_set1_epi8(0x0F));
+}
+
+/*
+ * Check a block that has some non-ASCII bytes, given the block before it.
+ * Returns nonzero bytes where there are errors
+ */
+UTILITY_TARGET_AVX2
+inline __m256i check_block(__m256i block, __m256i previous_block) {
+    const __m256i byte_1_high = _mm256_setr_epi8(
+        too_long, too_long, too_long, too_long,
+        too_long, too_long, too_long, too_long,
+        two_conts, two_conts, two_conts, two_conts,
+        too_short | overlong_2,
+        too_short,
+        too_short | overlong_3 | surrogate,
+        too_short | too_large | too_large_1000 | overlong_4,
+
+        too_long, too_long, too_long, too_long,
+        too_long, too_long, too_long, too_long,
+        two_conts, two_conts, two_conts, two_conts,
+        too_short | overlong_2,
+        too_short,
+        too_short | overlong_3 | surrogate,
+        too_short | too_large | too_large_1000 | overlong_4);
+
+    const __m256i byte_1_low = _mm256_setr_epi8(
+        carry | overlong_3 | overlong_2 | overlong_4,
+        carry | overlong_2,
+        carry,
+        carry,
+        carry | too_large,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+
+        carry | overlong_3 | overlong_2 | overlong_4,
+        carry | overlong_2,
+        carry,
+        carry,
+        carry | too_large,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000);
+
+    const __m256i byte_2_high = _mm256_setr_epi8(
+        too_short, too_short, too_short, too_short,
+        too_short, too_short, too_short, too_short,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+            overlong_4,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_short, too_short, too_short, too_short,
+
+        too_short, too_short, too_short, too_short,
+        too_short, too_short, too_short, too_short,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+            overlong_4,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_short, too_short, too_short, too_short);
+
+    const __m256i prev1 = previous<1>(block, previous_block);
+
+    const __m256i special_cases = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(byte_1_high, high_nibbles(prev1)),
+            _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(
+                prev1, _mm256_set1_epi8(0x0F)))),
+        _mm256_shuffle_epi8(byte_2_high, high_nibbles(block)));
+
+    /*
+     * Two continuations in a row are fine only as the third or fourth byte
+     * of a sequence, i.e. if the byte two back starts a 3- or 4-byte
+     * sequence, or the byte three back starts a 4-byte one
+     */
+    const __m256i third = _mm256_subs_epu8(
+        previous<2>(block, previous_block), _mm256_set1_epi8(0xE0 - 0x80));
+    const __m256i fourth = _mm256_subs_epu8(
+        previous<3>(block, previous_block), _mm256_set1_epi8(0xF0 - 0x80));
+
+    const __m256i must_continue = _mm256_and_si256(
+        _mm256_or_si256(third, fourth), _mm256_set1_epi8(two_conts));
+
+    return _mm256_xor_si256(must_continue, special_cases);
+}
+
+/*
+ * Check if a block ends partway through a sequence, which the next block
+ * must complete
+ */
+UTILITY_TARGET_AVX2
+inline __m256i is_incomplete(__m256i block) {
+    const __m256i max = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+        static_cast<char>(0xC0 - 1));
+
+    return _mm256_subs_epu8(block, max);
+}
+
+/*
+ * Find the first block with an error. Returns the offset of the block, or
+ * \a size if the input ends partway through a sequence, or npos
+ */
+UTILITY_TARGET_AVX2
+std::size_t find_invalid_block_avx2(const char* data, std::size_t size) {
+    __m256i previous_block = _mm256_setzero_si256();
+    __m256i incomplete     = _mm256_setzero_si256();
+
+    /* Finish with the tail, padded with ASCII */
+    for (std::size_t i = 0; i <= size; i += 32) {
+        __m256i block;
+        if (i + 32 <= size) {
+            block = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data + i));
+        } else {
+            char tail[32] = {0};
+            std::memcpy(tail, data + i, size - i);
+            block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail));
+        }
+
+        __m256i error;
+        if (_mm256_movemask_epi8(block) == 0) {
+            error = incomplete;
+            incomplete = _mm256_setzero_si256();
+        } else {
+            error = check_block(block, previous_block);
+            incomplete = is_incomplete(block);
+        }
+
+        if (!_mm256_testz_si256(error, error)) return std::min(i, size);
+
+        previous_block = block;
+    }
+
+    return npos;
+}
+
+/*
+ * Find the first ill-formed sequence with the lookup method. Blocks are
+ * checked as a whole, so the error within one is found by decoding from the
+ * start of the code point that spans into it
+ */
+UTILITY_TARGET_AVX2
+std::size_t find_invalid_avx2(const char* data, std::size_t size) {
+    const std::size_t block = find_invalid_block_avx2(data, size);
+    if (block == npos) return npos;
+
+    std::size_t start = block;
+    for (std::size_t back = 1; back <= 3 && back <= block; back++) {
+        if (!is_continuation(data[block - back])) {
+            start = block - back;
+            break;
+        }
+    }
+
+    const std::size_t ind = find_invalid_sequential(
+        data + start, size - start, ascii_length_scalar);
+    return ind == npos ? npos : start + ind;
+}
+
+#endif  // UTILITY_UTF8_X86
+
+/*
+ * Dispatch
+ */
+
+std::size_t ascii_length(const char* data, std::size_t size) {
+    switch (search::active_level()) {
+#ifdef UTILITY_UTF8_X86
+      case search::level::avx2:
+        return ascii_length_avx2(data, size);
+      case search::level::sse2:
+        return ascii_length_sse2(data, size);
+#endif
+      default:
+        return ascii_length_scalar(data, size);
+    }
+}
+
+/*
+ * Convert the case of a string: ASCII with \a ascii, a vector at a time, and
+ * everything else with \a mapping, one code point at a time
+ */
+std::string convert(superstring_view text,
+                    void (*ascii)(char*, std::size_t),
+                    char32_t (*mapping)(char32_t)) {
+    std::string out;
+    out.reserve(text.size());
+
+    const char* const data = text.data();
+    const std::size_t size = text.size();
+
+    std::size_t i = 0;
+    while (i < size) {
+        const std::size_t run = ascii_length(data + i, size - i);
+        if (run > 0) {
+            const std::size_t offset = out.size();
+            out.append(data + i, run);
+            ascii(&out[offset], run);
+
+            i += run;
+            if (i == size) break;
+        }
+
+        char32_t c;
+        const std::size_t length = decode(data + i, size - i, &c);
+
+        if (length == 0) {
+            out.push_back(data[i++]);
+        } else {
+            encode(mapping(c), &out);
+            i += length;
+        }
+    }
+
+    return out;
+}
+
+}  // namespace
+
+/**
+ * Check if text is valid UTF-8
+ *
+ * @param[in] text The text
+ *
+ * @return True if it is
+ */
+bool valid(superstring_view text) noexcept {
+    return find_invalid(text) == npos;
+}
+
+/**
+ * Find the first ill-formed sequence in some UTF-8 text
+ *
+ * @param[in] text The text
+ *
+ * @return The offset of the first byte that does not start or continue a
+ *         well-formed sequence, or npos if the text is valid
+ */
+std::size_t find_invalid(superstring_view text) noexcept {
+    switch (search::active_level()) {
+#ifdef UTILITY_UTF8_X86
+      case search::level::avx2:
+        return find_invalid_avx2(text.data(), text.size());
+      case search::level::sse2:
+        return find_invalid_sequential(text.data(), text.size(),
+                                       ascii_length_sse2);
+#endif
+      default:
+        return find_invalid_sequential(text.data(), text.size(),
+                                       ascii_length_scalar);
+    }
+}
+
+/**
+ * Count the code points in some UTF-8 text
+ *
+ * @param[in] text The text, which should be valid. Otherwise, the result is
+ *                 the number of bytes other than continuation bytes
+ *
+ * @return The number of code points
+ */
+std::size_t length(superstring_view text) noexcept {
+    switch (search::active_level()) {
+#ifdef UTILITY_UTF8_X86
+      case search::level::avx2:
+        return length_avx2(text.data(), text.size());
+      case search::level::sse2:
+        return length_sse2(text.data(), text.size());
+#endif
+      default:
+        return length_scalar(text.data(), text.size());
+    }
+}
+
+/**
+ * Case-fold a code point, e.g. for case-insensitive comparison. This is the
+ * simple folding, so e.g. U+00DF (sharp s) folds to itself rather than "ss"
+ *
+ * @param[in] c The code point
+ *
+ * @return Its folded form
+ */
+char32_t fold(char32_t c) noexcept {
+    if (c < 0x80) return c - U'A' < 26 ? c + 32 : c;
+    return map(fold_runs, c);
+}
+
+/**
+ * Convert a code point to lower case
+ *
+ * @param[in] c The code point
+ *
+ * @return Its simple lower case mapping
+ */
+char32_t lower(char32_t c) noexcept {
+    if (c < 0x80) return c - U'A' < 26 ? c + 32 : c;
+    return map(lower_runs, c);
+}
+
+/**
+ * Convert a code point to upper case
+ *
+ * @param[in] c The code point
+ *
+ * @return Its simple upper case mapping
+ */
+char32_t upper(char32_t c) noexcept {
+    if (c < 0x80) return c - U'a' < 26 ? c - 32 : c;
+    return map(upper_runs, c);
+}
+
+/**
+ * Case-fold some UTF-8 text. Strings that are equal when folded are equal
+ * ignoring case
+ *
+ * @param[in] text The text
+ *
+ * @return The text with each code point folded
+ */
+std::string fold_case(superstring_view text) {
+    return convert(text, &case_map::lower, &fold);
+}
+
+/**
+ * Convert some UTF-8 text to lower case
+ *
+ * @param[in] text The text
+ *
+ * @return The text with each code point converted
+ */
+std::string to_lower(superstring_view text) {
+    return convert(text, &case_map::lower, &lower);
+}
+
+/**
+ * Convert some UTF-8 text to upper case
+ *
+ * @param[in] text The text
+ *
+ * @return The text with each code point converted
+ */
+std::string to_upper(superstring_view text) {
+    return convert(text, &case_map::upper, &upper);
+}
+
+}  // namespace utf8
+}  // namespace jfern
@@ -0,0 +1,114 @@
+/**
+ *  \file   arena_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/arena.h"
+
+namespace {
+
+bool is_aligned(const void* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(arena, allocate) {
+    jfern::arena pool(256);
+    EXPECT_EQ(pool.blocks(), 0u);
+    EXPECT_EQ(pool.bytes_used(), 0u);
+    EXPECT_EQ(pool.bytes_reserved(), 0u);
+
+    char* a = static_cast<char*>(pool.allocate(10, 1));
+    char* b = static_cast<char*>(pool.allocate(10, 1));
+    EXPECT_EQ(b, a + 10);
+    EXPECT_EQ(pool.blocks(), 1u);
+    EXPECT_EQ(pool.bytes_used(), 20u);
+
+    for (std::size_t alignment = 1; alignment <= 64; alignment *= 2) {
+        void* ptr = pool.allocate(3, alignment);
+        EXPECT_TRUE(is_aligned(ptr, alignment)) << alignment;
+    }
+
+    /* Too big for a block: it gets one of its own */
+    char* big = static_cast<char*>(pool.allocate(1000, 8));
+    EXPECT_TRUE(is_aligned(big, 8));
+    EXPECT_EQ(pool.blocks(), 2u);
+    EXPECT_GE(pool.bytes_reserved(), 1256u);
+
+    for (std::size_t i = 0; i < 1000; i++) big[i] = 'x';
+}
+
+TEST(arena, deallocate) {
+    jfern::arena pool(256);
+
+    void* a = pool.allocate(16, 8);
+    void* b = pool.allocate(16, 8);
+
+    /* Not the most recent, so this is a no-op */
+    pool.deallocate(a, 16);
+    EXPECT_EQ(pool.bytes_used(), 32u);
+
+    /* The most recent allocation is given back */
+    pool.deallocate(b, 16);
+    EXPECT_EQ(pool.bytes_used(), 16u);
+    EXPECT_EQ(pool.allocate(16, 8), b);
+}
+
+TEST(arena, release) {
+    jfern::arena pool(128);
+
+    for (int i = 0; i < 20; i++) pool.allocate(100, 8);
+    EXPECT_GT(pool.blocks(), 1u);
+
+    pool.release();
+    EXPECT_EQ(pool.blocks(), 1u);
+    EXPECT_EQ(pool.bytes_used(), 0u);
+
+    /* The block that was kept is reused */
+    const std::size_t reserved = pool.bytes_reserved();
+    pool.allocate(100, 8);
+    EXPECT_EQ(pool.blocks(), 1u);
+    EXPECT_EQ(pool.bytes_reserved(), reserved);
+}
+
+TEST(arena, allocator) {
+    jfern::arena pool;
+    jfern::arena other;
+
+    using string_type =
+        std::basic_string<char, std::char_traits<char>,
+                          jfern::arena_allocator<char>>;
+
+    const jfern::arena_allocator<char> alloc(&pool);
+    const jfern::arena_allocator<int>  rebound(alloc);
+    EXPECT_EQ(rebound.source(), &pool);
+    EXPECT_TRUE(alloc == rebound);
+    EXPECT_TRUE(alloc != jfern::arena_allocator<char>(&other));
+
+    std::vector<int, jfern::arena_allocator<int>> numbers(rebound);
+    for (int i = 0; i < 1000; i++) numbers.push_back(i);
+    EXPECT_EQ(numbers[999], 999);
+
+    using pair_type = std::pair<const int, string_type>;
+    std::map<int, string_type, std::less<int>,
+             jfern::arena_allocator<pair_type>> names(alloc);
+
+    names.emplace(1, string_type("a string too long for SSO", alloc));
+    names.emplace(2, string_type("another string in the arena", alloc));
+    EXPECT_EQ(names.at(2), "another string in the arena");
+
+    EXPECT_EQ(other.bytes_used(), 0u);
+    EXPECT_GT(pool.bytes_used(), 1000 * sizeof(int));
+}
+
+}  // namespace
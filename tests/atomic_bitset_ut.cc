@@ -0,0 +1,135 @@
+/**
+ *  \file   atomic_bitset_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/atomic_bitset.h"
+
+namespace {
+
+using jfern::bitops::atomic_bitset;
+
+TEST(atomic_bitset, single_thread) {
+    atomic_bitset bits(130);
+    EXPECT_EQ(bits.size(), 130u);
+    EXPECT_EQ(bits.count(), 0u);
+
+    EXPECT_FALSE(bits.test_and_set(5));
+    EXPECT_TRUE(bits.test_and_set(5));
+    EXPECT_TRUE(bits.test(5));
+
+    EXPECT_TRUE(bits.release(5));
+    EXPECT_FALSE(bits.release(5));
+    EXPECT_FALSE(bits.test(5));
+
+    /* Acquire every bit, starting mid-way through the last word */
+    std::vector<bool> seen(130, false);
+    for (std::size_t i = 0; i < 130; i++) {
+        const std::size_t index = bits.try_acquire_first_free(129);
+        ASSERT_LT(index, 130u);
+        EXPECT_FALSE(seen[index]);
+        seen[index] = true;
+    }
+
+    EXPECT_EQ(bits.count(), 130u);
+    EXPECT_EQ(bits.try_acquire_first_free(), jfern::bitops::npos);
+
+    bits.release(77);
+    EXPECT_EQ(bits.try_acquire_first_free(), 77u);
+
+    atomic_bitset empty(0);
+    EXPECT_EQ(empty.try_acquire_first_free(), jfern::bitops::npos);
+}
+
+TEST(atomic_bitset, stress) {
+    const std::size_t num_threads =
+        std::max(4u, std::thread::hardware_concurrency());
+    constexpr std::size_t slots = 200;
+    constexpr int iterations = 20000;
+
+    atomic_bitset bits(slots);
+
+    /* Each slot records how many threads believe they own it */
+    std::vector<std::atomic<int>> owners(slots);
+    for (auto& owner : owners) owner.store(0);
+
+    std::atomic<int> conflicts(0), acquired(0);
+
+    auto worker = [&]() {
+        std::vector<std::size_t> held;
+        for (int i = 0; i < iterations; i++) {
+            const std::size_t index = bits.try_acquire_first_free();
+            if (index != jfern::bitops::npos) {
+                if (owners[index].fetch_add(1) != 0) conflicts++;
+                held.push_back(index);
+                acquired++;
+            }
+
+            /* Hold up to a few slots so the set is often nearly full */
+            if (held.size() > 4 || (index == jfern::bitops::npos &&
+                                    !held.empty())) {
+                const std::size_t slot = held.front();
+                held.erase(held.begin());
+
+                owners[slot].fetch_sub(1);
+                if (!bits.release(slot)) conflicts++;
+            }
+        }
+
+        for (std::size_t slot : held) {
+            owners[slot].fetch_sub(1);
+            if (!bits.release(slot)) conflicts++;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < num_threads; i++)
+        threads.emplace_back(worker);
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(conflicts.load(), 0);
+    EXPECT_GT(acquired.load(), 0);
+    EXPECT_EQ(bits.count(), 0u);
+}
+
+TEST(atomic_bitset, concurrent_test_and_set) {
+    const std::size_t num_threads =
+        std::max(4u, std::thread::hardware_concurrency());
+    constexpr std::size_t size = 10000;
+
+    atomic_bitset bits(size);
+    std::atomic<std::size_t> winners(0);
+
+    /* Every thread races for every bit; exactly one may win each */
+    auto worker = [&]() {
+        std::size_t won = 0;
+        for (std::size_t i = 0; i < size; i++) {
+            if (!bits.test_and_set(i)) won++;
+        }
+        winners += won;
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < num_threads; i++)
+        threads.emplace_back(worker);
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(winners.load(), size);
+    EXPECT_EQ(bits.count(), size);
+}
+
+}  // namespace
@@ -0,0 +1,119 @@
+/**
+ *  \file   attacks_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstdint>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "bitops/attacks.h"
+
+namespace {
+
+/* Slide one square at a time from \a square in each of the given steps */
+std::uint64_t slide(int square, std::uint64_t occupied,
+                    const int (&file_step)[4], const int (&rank_step)[4]) {
+    std::uint64_t attacks = 0;
+
+    for (int dir = 0; dir < 4; dir++) {
+        int file = square % 8 + file_step[dir];
+        int rank = square / 8 + rank_step[dir];
+
+        while (file >= 0 && file < 8 && rank >= 0 && rank < 8) {
+            const std::uint64_t bit = std::uint64_t(1) << (8 * rank + file);
+            attacks |= bit;
+            if (occupied & bit) break;
+
+            file += file_step[dir];
+            rank += rank_step[dir];
+        }
+    }
+
+    return attacks;
+}
+
+std::uint64_t slow_rook(int square, std::uint64_t occupied) {
+    return slide(square, occupied, {0, 0, 1, -1}, {1, -1, 0, 0});
+}
+
+std::uint64_t slow_bishop(int square, std::uint64_t occupied) {
+    return slide(square, occupied, {1, 1, -1, -1}, {1, -1, 1, -1});
+}
+
+/* Check a set of tables against the square-by-square slide */
+template <typename Indexing>
+void check_tables(const jfern::bitops::basic_slider_attacks<Indexing>& tables) {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 2000; i++) {
+        /* Vary the density of the board */
+        std::uint64_t occupied = distribution(generator);
+        if (i % 2) occupied &= distribution(generator);
+        if (i % 3) occupied &= distribution(generator);
+
+        for (int square = 0; square < 64; square++) {
+            ASSERT_EQ(tables.rook(square, occupied),
+                      slow_rook(square, occupied));
+            ASSERT_EQ(tables.bishop(square, occupied),
+                      slow_bishop(square, occupied));
+            ASSERT_EQ(tables.queen(square, occupied),
+                      slow_rook(square, occupied) |
+                      slow_bishop(square, occupied));
+        }
+    }
+}
+
+TEST(attacks, ray_attacks) {
+    using jfern::bitops::direction;
+
+    /* From a1, north to a8 with a blocker on a4 */
+    const std::uint64_t a4 = std::uint64_t(1) << 24;
+    EXPECT_EQ(jfern::bitops::ray_attacks(direction::north, 0, a4),
+              0x0000000001010100ull);
+    EXPECT_EQ(jfern::bitops::ray_attacks(direction::north, 0, 0),
+              0x0101010101010100ull);
+    EXPECT_EQ(jfern::bitops::ray_attacks(direction::south, 0, 0), 0u);
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t occupied = distribution(generator);
+        for (int square = 0; square < 64; square++) {
+            ASSERT_EQ(jfern::bitops::rook_rays(square, occupied),
+                      slow_rook(square, occupied));
+            ASSERT_EQ(jfern::bitops::bishop_rays(square, occupied),
+                      slow_bishop(square, occupied));
+        }
+    }
+}
+
+TEST(attacks, pext_tables) {
+    check_tables(jfern::bitops::basic_slider_attacks<
+                    jfern::bitops::pext_indexing>());
+}
+
+TEST(attacks, magic_tables) {
+    check_tables(jfern::bitops::basic_slider_attacks<
+                    jfern::bitops::magic_indexing>());
+}
+
+TEST(attacks, default_tables) {
+    const auto& tables = jfern::bitops::slider_attack_tables();
+    EXPECT_EQ(&tables, &jfern::bitops::slider_attack_tables());
+
+    /* 102400 rook + 5248 bishop entries */
+    EXPECT_GE(tables.table_bytes(), (102400u + 5248u) * 8u);
+
+    EXPECT_EQ(tables.rook(0, 0),   0x01010101010101feull);
+    EXPECT_EQ(tables.bishop(0, 0), 0x8040201008040200ull);
+}
+
+}  // namespace
@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <random>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "bitops/bitops.h"
@@ -39,6 +40,77 @@ int find_msb(const std::bitset<N>& set) {
     return -1;  // no bits set
 }
 
+/*
+ * Check that the dispatched and portable versions of count(), lsb() and msb()
+ * agree with std::bitset on random words of type T
+ */
+template <typename T>
+void check_word_primitives() {
+    namespace detail = jfern::bitops::detail;
+    constexpr std::size_t bits = 8 * sizeof(T);
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        /* Thin out the bits now and then to exercise sparse words */
+        std::uint64_t rand = distribution(generator);
+        if (i % 3 == 0) rand &= distribution(generator);
+        if (i % 5 == 0) rand &= distribution(generator);
+
+        const T word = static_cast<T>(rand);
+        const auto set = std::bitset<bits>(rand);
+
+        ASSERT_EQ(set.count(), jfern::bitops::count(word))
+            << "Failed on value 0x" << std::hex << rand;
+        ASSERT_EQ(set.count(), detail::count_portable(word))
+            << "Failed on value 0x" << std::hex << rand;
+
+        ASSERT_EQ(find_lsb<bits>(set), jfern::bitops::lsb(word))
+            << "Failed on value 0x" << std::hex << rand;
+        ASSERT_EQ(find_lsb<bits>(set), detail::lsb_portable(word))
+            << "Failed on value 0x" << std::hex << rand;
+
+        ASSERT_EQ(find_msb<bits>(set), jfern::bitops::msb(word))
+            << "Failed on value 0x" << std::hex << rand;
+        ASSERT_EQ(find_msb<bits>(set), detail::msb_portable(word))
+            << "Failed on value 0x" << std::hex << rand;
+    }
+
+    const T top = T(1) << (bits - 1);
+
+    EXPECT_EQ(jfern::bitops::count(T(~T(0))), bits);
+    EXPECT_EQ(jfern::bitops::lsb(top), static_cast<int>(bits - 1));
+    EXPECT_EQ(jfern::bitops::msb(top), static_cast<int>(bits - 1));
+    EXPECT_EQ(jfern::bitops::lsb(T(0)), -1);
+    EXPECT_EQ(jfern::bitops::msb(T(0)), -1);
+}
+
+TEST(bitops, constexpr_primitives) {
+    static_assert(jfern::bitops::count(std::uint8_t(0xff))     == 8,  "");
+    static_assert(jfern::bitops::count(std::uint64_t(~0ull))   == 64, "");
+    static_assert(jfern::bitops::count(std::int32_t(-1))       == 32, "");
+    static_assert(jfern::bitops::lsb(std::uint16_t(0x8000))    == 15, "");
+    static_assert(jfern::bitops::lsb(std::uint64_t(0))         == -1, "");
+    static_assert(jfern::bitops::msb(std::uint8_t(1))          == 0,  "");
+    static_assert(jfern::bitops::msb(std::int64_t(-1))         == 63, "");
+    static_assert(jfern::bitops::msb(std::uint32_t(0))         == -1, "");
+
+    static_assert(jfern::bitops::detail::count_portable(0xf0f0u) == 8,  "");
+    static_assert(jfern::bitops::detail::lsb_portable(0xf0f0u)   == 4,  "");
+    static_assert(jfern::bitops::detail::msb_portable(0xf0f0u)   == 15, "");
+}
+
+TEST(bitops, word_primitives) {
+    check_word_primitives<std::uint8_t>();
+    check_word_primitives<std::uint16_t>();
+    check_word_primitives<std::uint32_t>();
+    check_word_primitives<std::uint64_t>();
+
+    check_word_primitives<std::int8_t>();
+    check_word_primitives<std::int64_t>();
+}
+
 TEST(bitops, count) {
     EXPECT_EQ(jfern::bitops::count(0), 0);
     EXPECT_EQ(jfern::bitops::count(1), 1u);
@@ -235,6 +307,209 @@ TEST(bitops, get_1bits) {
     }
 }
 
+TEST(bitops, pdep_pext) {
+    static_assert(jfern::bitops::pext(0xf0f0u, 0xff00u) == 0xf0u, "");
+    static_assert(jfern::bitops::pdep(0xf0u, 0xff00u) == 0xf000u, "");
+    static_assert(jfern::bitops::pext(std::uint8_t(0xa5),
+                                      std::uint8_t(0x0f)) == 0x5, "");
+
+    EXPECT_EQ(jfern::bitops::pext(std::uint64_t(~0ull), std::uint64_t(0)),
+              0u);
+    EXPECT_EQ(jfern::bitops::pdep(std::uint64_t(~0ull), std::uint64_t(0)),
+              0u);
+
+    namespace detail = jfern::bitops::detail;
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t word = distribution(generator);
+        const std::uint64_t mask = distribution(generator);
+
+        /* Reference: walk the mask one bit at a time */
+        std::uint64_t extracted = 0, deposited = 0;
+        for (int bit = 0, k = 0; bit < 64; bit++) {
+            if ((mask >> bit) & 1) {
+                extracted |= ((word >> bit) & 1) << k;
+                deposited |= ((word >> k) & 1) << bit;
+                k++;
+            }
+        }
+
+        ASSERT_EQ(jfern::bitops::pext(word, mask), extracted);
+        ASSERT_EQ(jfern::bitops::pdep(word, mask), deposited);
+        ASSERT_EQ(detail::pext_portable(word, mask), extracted);
+        ASSERT_EQ(detail::pdep_portable(word, mask), deposited);
+
+        const auto word16 = static_cast<std::uint16_t>(word);
+        const auto mask16 = static_cast<std::uint16_t>(mask);
+        ASSERT_EQ(jfern::bitops::pext(word16, mask16),
+                  detail::pext_portable(word16, mask16));
+        ASSERT_EQ(jfern::bitops::pdep(word16, mask16),
+                  detail::pdep_portable(word16, mask16));
+
+        /* PDEP undoes PEXT on the masked bits */
+        ASSERT_EQ(jfern::bitops::pdep(extracted, mask), word & mask);
+    }
+}
+
+TEST(bitops, byte_swap) {
+    static_assert(jfern::bitops::byte_swap(std::uint8_t(0x12))  == 0x12, "");
+    static_assert(jfern::bitops::byte_swap(std::uint16_t(0x1234))
+                  == 0x3412, "");
+    static_assert(jfern::bitops::byte_swap(0x12345678u) == 0x78563412u, "");
+    static_assert(jfern::bitops::byte_swap(std::uint64_t(0x0102030405060708))
+                  == 0x0807060504030201u, "");
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t word = distribution(generator);
+
+        std::uint64_t expected = 0;
+        for (int byte = 0; byte < 8; byte++)
+            expected |= ((word >> (8 * byte)) & 0xff) << (56 - 8 * byte);
+
+        ASSERT_EQ(jfern::bitops::byte_swap(word), expected);
+        ASSERT_EQ(jfern::bitops::detail::byte_swap_portable(word), expected);
+        ASSERT_EQ(jfern::bitops::byte_swap(std::uint32_t(word)),
+                  std::uint32_t(expected >> 32));
+        ASSERT_EQ(jfern::bitops::byte_swap(std::int16_t(word)),
+                  std::int16_t(expected >> 48));
+    }
+}
+
+TEST(bitops, reverse_bits) {
+    static_assert(jfern::bitops::reverse_bits(std::uint8_t(0x01))  == 0x80, "");
+    static_assert(jfern::bitops::reverse_bits(std::uint16_t(0x0003))
+                  == 0xc000, "");
+    static_assert(jfern::bitops::reverse_bits(std::uint64_t(1))
+                  == 0x8000000000000000u, "");
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t word = distribution(generator);
+
+        std::uint64_t expected = 0;
+        for (int bit = 0; bit < 64; bit++)
+            expected |= ((word >> bit) & 1) << (63 - bit);
+
+        ASSERT_EQ(jfern::bitops::reverse_bits(word), expected);
+        ASSERT_EQ(jfern::bitops::reverse_bits(std::uint32_t(word)),
+                  std::uint32_t(expected >> 32));
+        ASSERT_EQ(jfern::bitops::reverse_bits(
+                      jfern::bitops::reverse_bits(word)), word);
+    }
+
+    EXPECT_EQ(jfern::bitops::reverse_bits(std::int8_t(1)), std::int8_t(-128));
+}
+
+TEST(bitops, prefix_xor) {
+    static_assert(jfern::bitops::prefix_xor(std::uint8_t(0x01)) == 0xff, "");
+    static_assert(jfern::bitops::prefix_xor(std::uint16_t(0x0110))
+                  == 0x00f0, "");
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t word = distribution(generator);
+
+        std::uint64_t expected = 0, parity = 0;
+        for (int bit = 0; bit < 64; bit++) {
+            parity ^= (word >> bit) & 1;
+            expected |= parity << bit;
+        }
+
+        ASSERT_EQ(jfern::bitops::prefix_xor(word), expected);
+        ASSERT_EQ(jfern::bitops::prefix_xor(std::uint32_t(word)),
+                  std::uint32_t(expected));
+    }
+}
+
+/* Sum the indexes of the bits set in a word at compile time */
+constexpr int sum_set_bits(std::uint32_t word) {
+    int sum = 0;
+    for (int index : jfern::bitops::set_bits(word)) sum += index;
+    return sum;
+}
+
+TEST(bitops, set_bits) {
+    static_assert(sum_set_bits(0) == 0, "");
+    static_assert(sum_set_bits(0x80000001u) == 31, "");
+    static_assert(jfern::bitops::set_bits(0xf0u).size() == 4, "");
+
+    EXPECT_TRUE(jfern::bitops::set_bits(0).empty());
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t random64 = distribution(generator);
+        const auto set = std::bitset<64>(random64);
+
+        std::vector<int> expected;
+        for (int bit = 0; bit < 64; bit++) {
+            if (set[bit]) expected.push_back(bit);
+        }
+
+        std::vector<int> actual;
+        for (int index : jfern::bitops::set_bits(random64))
+            actual.push_back(index);
+
+        ASSERT_EQ(actual, expected);
+
+        /* Signed and narrow types visit the same low bits */
+        const auto narrow = static_cast<std::int8_t>(random64);
+        std::vector<int> narrow_bits;
+        for (int index : jfern::bitops::set_bits(narrow))
+            narrow_bits.push_back(index);
+
+        ASSERT_EQ(narrow_bits.size(), std::bitset<8>(random64).count());
+    }
+}
+
+TEST(bitops, set_bits_array) {
+    const std::array<std::uint64_t, 0> none = {};
+    EXPECT_EQ(jfern::bitops::set_bits(none.data(), none.size()).begin(),
+              jfern::bitops::set_bits(none.data(), none.size()).end());
+
+    std::array<std::uint16_t, 5> words = { 0, 0x8001, 0, 0, 0x0100 };
+
+    std::vector<std::size_t> actual;
+    for (std::size_t index : jfern::bitops::set_bits(words.data(),
+                                                     words.size())) {
+        actual.push_back(index);
+    }
+
+    EXPECT_EQ(actual, std::vector<std::size_t>({16, 31, 72}));
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    std::array<std::uint64_t, 16> random_words;
+    for (auto& word : random_words)
+        word = distribution(generator) & distribution(generator);
+    random_words[3] = 0;
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < 64 * random_words.size(); i++) {
+        if ((random_words[i / 64] >> (i % 64)) & 1) expected.push_back(i);
+    }
+
+    actual.clear();
+    for (std::size_t index : jfern::bitops::set_bits(random_words.data(),
+                                                     random_words.size())) {
+        actual.push_back(index);
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
 TEST(bitops, set) {
     const std::array<int, 3> indexes = { 0, 20, 63 };
 
@@ -0,0 +1,226 @@
+/**
+ *  \file   bitvector_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/bitvector.h"
+
+namespace {
+
+using jfern::bitops::bitvector;
+
+/* Build a random bitvector along with an equivalent std::vector<bool> */
+bitvector make_random(std::size_t size, std::default_random_engine* generator,
+                      std::vector<bool>* reference, int density = 2) {
+    std::uniform_int_distribution<int> distribution(0, density - 1);
+
+    bitvector bits(size);
+    reference->assign(size, false);
+
+    for (std::size_t i = 0; i < size; i++) {
+        if (distribution(*generator) == 0) {
+            bits.set(i);
+            (*reference)[i] = true;
+        }
+    }
+
+    return bits;
+}
+
+/* Check that a bitvector matches a std::vector<bool> bit for bit */
+void expect_equal(const bitvector& bits, const std::vector<bool>& reference) {
+    ASSERT_EQ(bits.size(), reference.size());
+    for (std::size_t i = 0; i < reference.size(); i++) {
+        ASSERT_EQ(bits[i], reference[i]) << "Mismatch at bit " << i;
+    }
+}
+
+TEST(bitvector, construct) {
+    const bitvector empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.num_words(), 0u);
+    EXPECT_EQ(empty.count(), 0u);
+
+    const bitvector zeros(130);
+    EXPECT_EQ(zeros.size(), 130u);
+    EXPECT_EQ(zeros.num_words(), 3u);
+    EXPECT_TRUE(zeros.none());
+
+    const bitvector ones(130, true);
+    EXPECT_EQ(ones.count(), 130u);
+    EXPECT_EQ(ones.data()[2], 0x3u);  // unused bits stay zero
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ones.data()) % 64, 0u);
+}
+
+TEST(bitvector, set_reset_flip) {
+    bitvector bits(100);
+
+    bits.set(0).set(63).set(64).set(99);
+    EXPECT_TRUE(bits.test(0));
+    EXPECT_TRUE(bits.test(63));
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_TRUE(bits.test(99));
+    EXPECT_EQ(bits.count(), 4u);
+
+    bits.reset(63);
+    EXPECT_FALSE(bits[63]);
+    EXPECT_EQ(bits.count(), 3u);
+
+    bits.flip(63).flip(0);
+    EXPECT_TRUE(bits[63]);
+    EXPECT_FALSE(bits[0]);
+
+    bits.flip();
+    EXPECT_EQ(bits.count(), 97u);
+
+    bits.set();
+    EXPECT_EQ(bits.count(), 100u);
+
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+}
+
+TEST(bitvector, resize) {
+    bitvector bits(70, true);
+
+    bits.resize(200, true);
+    EXPECT_EQ(bits.count(), 200u);
+
+    bits.resize(65);
+    EXPECT_EQ(bits.count(), 65u);
+
+    bits.resize(300);
+    EXPECT_EQ(bits.count(), 65u);
+    EXPECT_EQ(bits.find_last(), 64u);
+}
+
+TEST(bitvector, count) {
+    std::default_random_engine generator;
+    std::vector<bool> reference;
+
+    /* Sizes on either side of the 16-register Harley-Seal block */
+    for (std::size_t size : {0, 1, 64, 1000, 4095, 4096, 4097, 100000}) {
+        const bitvector bits = make_random(size, &generator, &reference);
+
+        std::size_t expected = 0;
+        for (bool bit : reference) expected += bit;
+
+        EXPECT_EQ(bits.count(), expected) << "size = " << size;
+    }
+}
+
+TEST(bitvector, find) {
+    bitvector bits(1000);
+    EXPECT_EQ(bits.find_first(), jfern::bitops::npos);
+    EXPECT_EQ(bits.find_last(),  jfern::bitops::npos);
+    EXPECT_EQ(bits.find_next(0), jfern::bitops::npos);
+
+    std::default_random_engine generator;
+    std::vector<bool> reference;
+
+    for (int density : {2, 50, 500}) {
+        bits = make_random(1000, &generator, &reference, density);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < reference.size(); i++) {
+            if (reference[i]) expected.push_back(i);
+        }
+
+        std::vector<std::size_t> actual;
+        for (std::size_t i = bits.find_first(); i != jfern::bitops::npos;
+             i = bits.find_next(i)) {
+            actual.push_back(i);
+        }
+
+        EXPECT_EQ(actual, expected);
+
+        if (!expected.empty()) {
+            EXPECT_EQ(bits.find_last(), expected.back());
+        }
+    }
+
+    EXPECT_EQ(bits.find_next(999), jfern::bitops::npos);
+    EXPECT_EQ(bits.find_next(jfern::bitops::npos), jfern::bitops::npos);
+}
+
+TEST(bitvector, bulk_ops) {
+    std::default_random_engine generator;
+
+    for (std::size_t size : {1, 63, 129, 777, 10000}) {
+        std::vector<bool> a_ref, b_ref;
+        const bitvector a = make_random(size, &generator, &a_ref);
+        const bitvector b = make_random(size, &generator, &b_ref);
+
+        std::vector<bool> and_ref(size), or_ref(size),
+                          xor_ref(size), andnot_ref(size);
+        for (std::size_t i = 0; i < size; i++) {
+            and_ref[i]    = a_ref[i] && b_ref[i];
+            or_ref[i]     = a_ref[i] || b_ref[i];
+            xor_ref[i]    = a_ref[i] != b_ref[i];
+            andnot_ref[i] = a_ref[i] && !b_ref[i];
+        }
+
+        expect_equal(a & b, and_ref);
+        expect_equal(a | b, or_ref);
+        expect_equal(a ^ b, xor_ref);
+        expect_equal(bitvector(a).and_not(b), andnot_ref);
+    }
+
+    bitvector a(10), b(11);
+    EXPECT_THROW(a &= b, std::invalid_argument);
+    EXPECT_THROW(a.and_not(b), std::invalid_argument);
+}
+
+TEST(bitvector, shift) {
+    std::default_random_engine generator;
+    std::vector<bool> reference;
+
+    const std::size_t size = 300;
+    const bitvector original = make_random(size, &generator, &reference);
+
+    for (std::size_t shift : {0, 1, 5, 63, 64, 65, 128, 200, 299, 300, 1000}) {
+        std::vector<bool> left(size, false), right(size, false);
+        for (std::size_t i = 0; i < size; i++) {
+            if (i + shift < size) {
+                left[i + shift] = reference[i];
+                right[i] = reference[i + shift];
+            }
+        }
+
+        bitvector bits = original;
+        bits <<= shift;
+        expect_equal(bits, left);
+        EXPECT_EQ(bits.data()[bits.num_words() - 1] >> (size % 64), 0u);
+
+        bits = original;
+        bits >>= shift;
+        expect_equal(bits, right);
+    }
+}
+
+TEST(bitvector, equality) {
+    bitvector a(100), b(100), c(101);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+
+    a.set(42);
+    EXPECT_NE(a, b);
+
+    b.set(42);
+    EXPECT_EQ(a, b);
+}
+
+}  // namespace
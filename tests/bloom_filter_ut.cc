@@ -0,0 +1,130 @@
+/**
+ *  \file   bloom_filter_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/bloom_filter.h"
+
+namespace {
+
+using jfern::bitops::blocked_bloom_filter;
+using jfern::bitops::counting_bloom_filter;
+using jfern::bitops::split_block_bloom_filter;
+
+/* A well mixed hash of a counter (SplitMix64) */
+std::uint64_t mix(std::uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+/* Hashes of keys [first, first + n) */
+std::vector<std::uint64_t> make_hashes(std::uint64_t first, std::size_t n) {
+    std::vector<std::uint64_t> hashes(n);
+    for (std::size_t i = 0; i < n; i++) hashes[i] = mix(first + i);
+    return hashes;
+}
+
+/*
+ * Insert keys in a batch, then check that none are lost and that the false
+ * positive rate on other keys is near what the sizing promises
+ */
+template <typename Filter>
+void check_filter(double max_false_positive_rate) {
+    constexpr std::size_t items = 100000;
+
+    Filter filter(items, 10.0);
+
+    const std::vector<std::uint64_t> present = make_hashes(0, items);
+    const std::vector<std::uint64_t> absent  = make_hashes(1u << 30, items);
+
+    filter.insert(present.data(), present.size());
+
+    std::unique_ptr<bool[]> results(new bool[items]);
+
+    EXPECT_EQ(filter.contains(present.data(), items, results.get()), items);
+    for (std::size_t i = 0; i < items; i++) {
+        ASSERT_TRUE(results[i]);
+        ASSERT_TRUE(filter.contains(present[i]));
+    }
+
+    const std::size_t false_positives =
+        filter.contains(absent.data(), items, results.get());
+    for (std::size_t i = 0; i < items; i++) {
+        ASSERT_EQ(results[i], filter.contains(absent[i]));
+    }
+
+    EXPECT_LT(false_positives, max_false_positive_rate * items);
+
+    filter.clear();
+    EXPECT_EQ(filter.contains(present.data(), items, results.get()), 0u);
+}
+
+TEST(bloom_filter, blocked) {
+    check_filter<blocked_bloom_filter>(0.02);
+
+    const blocked_bloom_filter filter(1000, 10.0);
+    EXPECT_EQ(filter.num_probes(), 7);
+    EXPECT_EQ(filter.memory_bytes(), 20 * 64u);
+
+    EXPECT_THROW(blocked_bloom_filter(10, 0.0), std::invalid_argument);
+}
+
+TEST(bloom_filter, split_block) {
+    check_filter<split_block_bloom_filter>(0.02);
+
+    const split_block_bloom_filter filter(1000, 10.0);
+    EXPECT_EQ(filter.memory_bytes(), 40 * 32u);
+
+    EXPECT_THROW(split_block_bloom_filter(10, -1.0), std::invalid_argument);
+}
+
+TEST(bloom_filter, counting) {
+    check_filter<counting_bloom_filter>(0.03);
+
+    constexpr std::size_t items = 20000;
+    counting_bloom_filter filter(2 * items, 10.0);
+
+    const std::vector<std::uint64_t> kept    = make_hashes(0, items);
+    const std::vector<std::uint64_t> removed = make_hashes(1u << 30, items);
+
+    filter.insert(kept.data(), items);
+    filter.insert(removed.data(), items);
+
+    std::size_t removals = 0;
+    for (std::uint64_t hash : removed) removals += filter.remove(hash);
+    EXPECT_EQ(removals, items);
+
+    /* Removing must never take out a key that is still present */
+    for (std::uint64_t hash : kept) {
+        ASSERT_TRUE(filter.contains(hash));
+    }
+
+    std::size_t lingering = 0;
+    for (std::uint64_t hash : removed) lingering += filter.contains(hash);
+    EXPECT_LT(lingering, items / 50);
+
+    /* Saturated counters stay put */
+    counting_bloom_filter tiny(1, 1.0);
+    for (int i = 0; i < 20; i++) tiny.insert(42);
+    for (int i = 0; i < 20; i++) tiny.remove(42);
+    EXPECT_TRUE(tiny.contains(42));
+
+    counting_bloom_filter empty(10);
+    EXPECT_FALSE(empty.remove(42));
+}
+
+}  // namespace
@@ -0,0 +1,97 @@
+/**
+ *  \file   case_map_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cctype>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/case_map.h"
+#include "superstring/search.h"
+
+namespace {
+
+namespace search = jfern::search;
+
+/* Every kernel level this CPU can run */
+std::vector<search::level> levels() {
+    std::vector<search::level> out = {search::level::scalar};
+    if (search::supported_level() >= search::level::sse2)
+        out.push_back(search::level::sse2);
+    if (search::supported_level() >= search::level::avx2)
+        out.push_back(search::level::avx2);
+    return out;
+}
+
+/* The locale-aware conversion the kernels must agree with */
+std::string reference(std::string str, bool upper) {
+    for (char& c : str) {
+        const auto byte = static_cast<unsigned char>(c);
+        c = static_cast<char>(upper ? std::toupper(byte)
+                                    : std::tolower(byte));
+    }
+    return str;
+}
+
+TEST(case_map, all_bytes) {
+    const search::level saved = search::active_level();
+
+    std::string all;
+    for (int c = 0; c < 256; c++) all.push_back(static_cast<char>(c));
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        SCOPED_TRACE(static_cast<int>(isa));
+
+        std::string lower = all;
+        jfern::case_map::lower(&lower[0], lower.size());
+        EXPECT_EQ(lower, reference(all, false));
+
+        std::string upper = all;
+        jfern::case_map::upper(&upper[0], upper.size());
+        EXPECT_EQ(upper, reference(all, true));
+    }
+
+    search::set_active_level(saved);
+}
+
+TEST(case_map, lengths) {
+    const search::level saved = search::active_level();
+    std::default_random_engine engine;
+
+    /* Mostly ASCII letters, with the odd non-ASCII byte to force fallbacks */
+    std::uniform_int_distribution<int> pick(0, 63);
+    const std::string alphabet =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz @[`{\xc0\xdf\xe9";
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        SCOPED_TRACE(static_cast<int>(isa));
+
+        for (std::size_t size = 0; size < 150; size++) {
+            std::string text(size, '\0');
+            for (char& c : text) c = alphabet[pick(engine) % alphabet.size()];
+
+            std::string lower = text;
+            jfern::case_map::lower(&lower[0], lower.size());
+            ASSERT_EQ(lower, reference(text, false)) << size;
+
+            std::string upper = text;
+            jfern::case_map::upper(&upper[0], upper.size());
+            ASSERT_EQ(upper, reference(text, true)) << size;
+        }
+    }
+
+    search::set_active_level(saved);
+}
+
+}  // namespace
@@ -0,0 +1,213 @@
+/**
+ *  \file   csv_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/csv.h"
+#include "superstring/search.h"
+
+namespace {
+
+namespace search = jfern::search;
+
+using table = std::vector<std::vector<std::string>>;
+
+/* Every kernel level this CPU can run */
+std::vector<search::level> levels() {
+    std::vector<search::level> out = {search::level::scalar};
+    if (search::supported_level() >= search::level::sse2)
+        out.push_back(search::level::sse2);
+    if (search::supported_level() >= search::level::avx2)
+        out.push_back(search::level::avx2);
+    return out;
+}
+
+/* Restores the default kernels when a test finishes */
+class level_guard final {
+ public:
+    level_guard() : m_saved(search::active_level()) {}
+    ~level_guard() { search::set_active_level(m_saved); }
+
+ private:
+    search::level m_saved;
+};
+
+/* Read every record, unescaping each field */
+table read_all(jfern::csv_reader* reader) {
+    table records;
+
+    jfern::csv_record record;
+    while (reader->next(&record)) {
+        records.emplace_back();
+        for (const jfern::csv_field& field : record)
+            records.back().push_back(field.str());
+    }
+
+    return records;
+}
+
+table read_all(const std::string& text, char delimiter = ',',
+               char quote = '"') {
+    jfern::csv_reader reader(text, delimiter, quote);
+    return read_all(&reader);
+}
+
+/* Write records in CSV form, quoting fields that need it */
+std::string write_all(const table& records, const char* newline) {
+    std::string text;
+
+    for (const std::vector<std::string>& record : records) {
+        for (std::size_t i = 0; i < record.size(); i++) {
+            if (i > 0) text += ',';
+
+            const std::string& field = record[i];
+            if (field.find_first_of(",\"\r\n") == std::string::npos) {
+                text += field;
+                continue;
+            }
+
+            text += '"';
+            for (char c : field) {
+                if (c == '"') text += '"';
+                text += c;
+            }
+            text += '"';
+        }
+        text += newline;
+    }
+
+    return text;
+}
+
+/* Records with quotes, delimiters and line breaks in their fields */
+table make_table(std::size_t rows, std::default_random_engine* engine) {
+    const char alphabet[] = {'a', 'b', ',', '"', '\n', ' ', '\r', 'z'};
+    std::uniform_int_distribution<int> pick(0, sizeof(alphabet) - 1);
+    std::uniform_int_distribution<int> columns(1, 6);
+    std::uniform_int_distribution<int> length(0, 12);
+
+    table records(rows);
+    for (std::vector<std::string>& record : records) {
+        record.resize(columns(*engine));
+        for (std::string& field : record) {
+            for (int i = length(*engine); i > 0; i--)
+                field += alphabet[pick(*engine)];
+        }
+
+        /* A lone empty field would be written as a blank line */
+        if (record.size() == 1 && record[0].empty()) record[0] = "x";
+    }
+
+    return records;
+}
+
+TEST(csv, simple) {
+    const table expected = {{"a", "b", "c"}, {"1", "", "3"}, {""}, {"x"}};
+
+    EXPECT_EQ(read_all("a,b,c\n1,,3\n\nx\n"), expected);
+    EXPECT_EQ(read_all("a,b,c\r\n1,,3\r\n\r\nx"), expected);
+
+    EXPECT_TRUE(read_all("").empty());
+    EXPECT_EQ(read_all("\n"), table({{""}}));
+    EXPECT_EQ(read_all(","), table({{"", ""}}));
+    EXPECT_EQ(read_all("a,\n"), table({{"a", ""}}));
+
+    /* A carriage return that doesn't end a line is kept */
+    EXPECT_EQ(read_all("a\rb,c\r,d\n"), table({{"a\rb", "c\r", "d"}}));
+}
+
+TEST(csv, quoted) {
+    EXPECT_EQ(read_all("\"a,b\",\"c\nd\",\"e\"\"f\"\n"),
+              table({{"a,b", "c\nd", "e\"f"}}));
+
+    EXPECT_EQ(read_all("\"\",\"\"\"\"\r\n\"x\r\ny\""),
+              table({{"", "\""}, {"x\r\ny"}}));
+
+    /* Views keep escaped quotes doubled */
+    jfern::csv_reader reader("\"a\"\"b\",\"c\",d");
+    jfern::csv_record record;
+    ASSERT_TRUE(reader.next(&record));
+    ASSERT_EQ(record.size(), 3u);
+
+    EXPECT_EQ(record[0].view(), "a\"\"b");
+    EXPECT_TRUE(record[0].escaped());
+    EXPECT_EQ(record[1].view(), "c");
+    EXPECT_FALSE(record[1].escaped());
+    EXPECT_EQ(record.at(2).view(), "d");
+    EXPECT_THROW(record.at(3), std::out_of_range);
+
+    EXPECT_FALSE(reader.next(&record));
+    EXPECT_EQ(reader.records(), 1u);
+}
+
+TEST(csv, malformed) {
+    /* Stray quotes in unquoted fields are kept as they are */
+    EXPECT_EQ(read_all("a\"b\"c,d\n"), table({{"a\"b\"c", "d"}}));
+
+    EXPECT_THROW(read_all("a,\"b\nc"), std::invalid_argument);
+}
+
+TEST(csv, tsv) {
+    EXPECT_EQ(read_all("a\t\"b\tc\n", '\t', '\0'),
+              table({{"a", "\"b", "c"}}));
+    EXPECT_EQ(read_all("a\t\"b\tc\"\n", '\t'), table({{"a", "b\tc"}}));
+}
+
+TEST(csv, levels) {
+    level_guard guard;
+    std::default_random_engine engine(7);
+
+    const table expected = make_table(5000, &engine);
+    const std::string text = write_all(expected, "\r\n");
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        EXPECT_EQ(read_all(text), expected)
+            << "level " << static_cast<int>(isa);
+    }
+}
+
+TEST(csv, long_records) {
+    /* Fields that span many blocks and several index windows */
+    const table expected = {
+        {std::string(100000, 'a'), std::string(70000, ','), "b"},
+        {std::string(3 * jfern::csv_reader::window_size, '\n')},
+        {"c"}};
+
+    EXPECT_EQ(read_all(write_all(expected, "\n")), expected);
+}
+
+TEST(csv, stream) {
+    std::default_random_engine engine(9);
+
+    const table expected = make_table(2000, &engine);
+    const std::string text = write_all(expected, "\n");
+
+    /* Buffers smaller than a record make it grow */
+    for (std::size_t size : {std::size_t(1), std::size_t(7),
+                             std::size_t(64), std::size_t(1000),
+                             jfern::csv_reader::default_buffer_size}) {
+        std::istringstream stream(text);
+        jfern::csv_reader reader(stream, ',', '"', size);
+
+        EXPECT_EQ(read_all(&reader), expected) << "buffer size " << size;
+    }
+
+    std::istringstream unterminated("a,b\n\"c,d\n");
+    jfern::csv_reader reader(unterminated, ',', '"', 4);
+    EXPECT_THROW(read_all(&reader), std::invalid_argument);
+}
+
+}  // namespace
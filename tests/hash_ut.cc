@@ -0,0 +1,284 @@
+/**
+ *  \file   hash_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/hash.h"
+#include "superstring/search.h"
+
+namespace {
+
+namespace search = jfern::search;
+
+using jfern::hash64;
+using jfern::hashed_string;
+using jfern::hashed_view;
+using jfern::superstring_view;
+
+/* Every kernel level this CPU can run */
+std::vector<search::level> levels() {
+    std::vector<search::level> out = {search::level::scalar};
+    if (search::supported_level() >= search::level::sse2)
+        out.push_back(search::level::sse2);
+    if (search::supported_level() >= search::level::avx2)
+        out.push_back(search::level::avx2);
+    return out;
+}
+
+/* Restores the default kernels when a test finishes */
+class level_guard final {
+ public:
+    level_guard() : m_saved(search::active_level()) {}
+    ~level_guard() { search::set_active_level(m_saved); }
+
+ private:
+    search::level m_saved;
+};
+
+std::string random_bytes(std::size_t size, std::mt19937_64* engine) {
+    std::string bytes(size, '\0');
+    for (char& c : bytes) c = static_cast<char>((*engine)());
+    return bytes;
+}
+
+/* The number of bits that differ between two hashes */
+int distance(std::uint64_t a, std::uint64_t b) {
+    int bits = 0;
+    for (std::uint64_t x = a ^ b; x != 0; x &= x - 1) bits++;
+    return bits;
+}
+
+TEST(hash, levels) {
+    level_guard guard;
+    std::mt19937_64 engine(11);
+
+    /* Sizes around every boundary between the paths and blocks */
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = 0; size <= 1200; size++) sizes.push_back(size);
+    for (std::size_t size : {2047, 2048, 2049, 3000, 4096, 65537})
+        sizes.push_back(size);
+
+    for (std::size_t size : sizes) {
+        const std::string key = random_bytes(size, &engine);
+        const std::uint64_t seed = size % 3 == 0 ? 0 : engine();
+
+        search::set_active_level(search::level::scalar);
+        const std::uint64_t expected = hash64(key, seed);
+
+        for (search::level isa : levels()) {
+            search::set_active_level(isa);
+            ASSERT_EQ(hash64(key, seed), expected)
+                << "level " << static_cast<int>(isa) << ", size " << size;
+            ASSERT_EQ(hash64(key.data(), key.size(), seed), expected);
+        }
+    }
+}
+
+TEST(hash, inputs) {
+    std::mt19937_64 engine(13);
+    const std::string key = random_bytes(5000, &engine);
+
+    /* Every byte, the length and the seed must count */
+    for (std::size_t size : {1, 3, 4, 7, 8, 16, 17, 48, 49, 1024, 1025,
+                             5000}) {
+        const std::string text = key.substr(0, size);
+        const std::uint64_t hash = hash64(text);
+
+        EXPECT_NE(hash64(text, 1), hash) << size;
+        EXPECT_NE(hash64(text + '\0'), hash) << size;
+        EXPECT_NE(hash64(text.substr(0, size - 1)), hash) << size;
+
+        for (std::size_t i = 0; i < size; i += (size / 16) + 1) {
+            std::string changed = text;
+            changed[i] ^= 1;
+            EXPECT_NE(hash64(changed), hash) << size << ", " << i;
+        }
+    }
+
+    EXPECT_NE(hash64(""), hash64("", 1));
+    EXPECT_EQ(hash64(superstring_view("abc")), hash64("abcd", 3));
+}
+
+TEST(hash, avalanche) {
+    std::mt19937_64 engine(17);
+
+    /*
+     * Flipping any input bit should flip each output bit half the time.
+     * Check each output bit over all flips, and the average number of bits
+     * flipped for each input bit
+     */
+    for (std::size_t size : {1, 3, 8, 12, 16, 24, 100, 1024, 2000}) {
+        const std::size_t bits = std::min<std::size_t>(size * 8, 256);
+        const int keys = static_cast<int>(std::max<std::size_t>(
+            64, 16384 / bits));
+
+        std::vector<int> output_flips(64, 0);
+        std::vector<int> input_flips(bits, 0);
+
+        for (int k = 0; k < keys; k++) {
+            std::string key = random_bytes(size, &engine);
+            const std::uint64_t hash = hash64(key);
+
+            for (std::size_t b = 0; b < bits; b++) {
+                /* Spread the bits tested over the whole key */
+                const std::size_t bit = b * (size * 8) / bits;
+
+                key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                const std::uint64_t flipped = hash64(key) ^ hash;
+                key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+
+                input_flips[b] += distance(flipped, 0);
+                for (int out = 0; out < 64; out++)
+                    output_flips[out] += (flipped >> out) & 1;
+            }
+        }
+
+        const double trials = static_cast<double>(keys * bits);
+        for (int out = 0; out < 64; out++) {
+            const double rate = output_flips[out] / trials;
+            EXPECT_GT(rate, 0.44) << "size " << size << ", bit " << out;
+            EXPECT_LT(rate, 0.56) << "size " << size << ", bit " << out;
+        }
+
+        for (std::size_t b = 0; b < bits; b++) {
+            const double mean = input_flips[b] / static_cast<double>(keys);
+            EXPECT_GT(mean, 28.0) << "size " << size << ", bit " << b;
+            EXPECT_LT(mean, 36.0) << "size " << size << ", bit " << b;
+        }
+    }
+}
+
+TEST(hash, collisions) {
+    /* Keys that differ in few bits: numbers, and prefixes with a suffix */
+    std::vector<std::string> keys;
+    for (int i = 0; i < 100000; i++) keys.push_back(std::to_string(i));
+    for (int i = 0; i < 100000; i++) {
+        keys.push_back(std::string(40, 'x') + std::to_string(i));
+        keys.push_back("key_" + std::to_string(i) + std::string(1100, 'y'));
+    }
+
+    std::unordered_set<std::uint64_t> hashes;
+    std::unordered_set<std::uint64_t> low_bits;
+    for (const std::string& key : keys) {
+        const std::uint64_t hash = hash64(key);
+        hashes.insert(hash);
+        low_bits.insert(hash & 0xFFFF);
+    }
+
+    EXPECT_EQ(hashes.size(), keys.size());
+
+    /*
+     * Nor should the low 16 bits, as a table would use them, collide more
+     * than chance: 300,000 keys leave 65536 * e^(-300000/65536), or about
+     * 670, of the values untaken
+     */
+    EXPECT_GT(low_bits.size(), 65536u - 800);
+    EXPECT_LT(low_bits.size(), 65536u - 540);
+}
+
+TEST(hash, hashed_keys) {
+    const std::string text = "identifier";
+
+    const hashed_view view(text);
+    EXPECT_EQ(view.hash(), hash64(text));
+    EXPECT_EQ(view.view(), text);
+    EXPECT_EQ(view.size(), text.size());
+    EXPECT_EQ(view.data(), text.data());
+    EXPECT_EQ(hashed_view().hash(), hash64(""));
+
+    const hashed_string str(text);
+    EXPECT_EQ(str.hash(), view.hash());
+    EXPECT_EQ(str.str(), text);
+    EXPECT_NE(str.data(), text.data());
+
+    EXPECT_TRUE(str == view);
+    EXPECT_TRUE(view == "identifier");
+    EXPECT_TRUE(hashed_string("a") != hashed_string("b"));
+
+    /* A hash passed in is trusted, so a wrong one compares unequal */
+    EXPECT_FALSE(hashed_view(text, 1) == view);
+
+    hashed_string copy(view);
+    EXPECT_EQ(copy.hash(), view.hash());
+    copy.assign(superstring_view("other"));
+    EXPECT_EQ(copy.hash(), hash64("other"));
+    EXPECT_EQ(copy.str(), "other");
+
+    EXPECT_EQ(std::hash<hashed_string>()(str), std::size_t(str.hash()));
+    EXPECT_EQ(std::hash<hashed_view>()(view), std::size_t(view.hash()));
+}
+
+TEST(hash, string_hash) {
+    const std::string text = "key";
+    const jfern::string_hash hash;
+    const jfern::string_equal equal;
+
+    const std::size_t expected = hash(text);
+    EXPECT_EQ(hash("key"), expected);
+    EXPECT_EQ(hash(superstring_view(text)), expected);
+    EXPECT_EQ(hash(hashed_view(text)), expected);
+    EXPECT_EQ(hash(hashed_string(text)), expected);
+
+    EXPECT_TRUE(equal(text, "key"));
+    EXPECT_TRUE(equal(hashed_string("key"), superstring_view(text)));
+    EXPECT_TRUE(equal("key", hashed_view(text)));
+    EXPECT_FALSE(equal(hashed_string("key"), hashed_view("kez")));
+    EXPECT_FALSE(equal(text, "ke"));
+}
+
+TEST(hash, find_key) {
+    std::unordered_map<std::string, int, jfern::string_hash,
+                       jfern::string_equal> strings;
+    std::unordered_map<hashed_string, int, jfern::string_hash,
+                       jfern::string_equal> hashed;
+    std::unordered_map<superstring_view, int, jfern::string_hash,
+                       jfern::string_equal> views;
+    std::set<std::string> ordered;
+
+    const std::vector<std::string> words = {"alpha", "beta", "gamma",
+                                            std::string(2000, 'd')};
+    for (std::size_t i = 0; i < words.size(); i++) {
+        strings[words[i]] = static_cast<int>(i);
+        hashed[words[i]] = static_cast<int>(i);
+        views[words[i]] = static_cast<int>(i);
+        ordered.insert(words[i]);
+    }
+
+    const std::string text = "alpha beta gamma delta";
+    const superstring_view gamma(text.data() + 11, 5);
+
+    EXPECT_EQ(jfern::find_key(strings, gamma)->second, 2);
+    EXPECT_EQ(jfern::find_key(hashed, gamma)->second, 2);
+    EXPECT_EQ(jfern::find_key(views, gamma)->second, 2);
+    EXPECT_EQ(*jfern::find_key(ordered, gamma), "gamma");
+
+    EXPECT_EQ(jfern::find_key(strings, "alpha")->second, 0);
+    EXPECT_EQ(jfern::find_key(hashed, hashed_view("beta"))->second, 1);
+    EXPECT_EQ(jfern::find_key(hashed, words[3])->second, 3);
+    EXPECT_EQ(jfern::find_key(views, hashed_string("alpha"))->second, 0);
+
+    const auto& const_strings = strings;
+    EXPECT_EQ(jfern::find_key(const_strings, words[3])->second, 3);
+
+    EXPECT_EQ(jfern::find_key(strings, "delta"), strings.end());
+    EXPECT_EQ(jfern::find_key(hashed, superstring_view(text.data(), 4)),
+              hashed.end());
+    EXPECT_EQ(jfern::find_key(ordered, "alph"), ordered.end());
+}
+
+}  // namespace
@@ -0,0 +1,139 @@
+/**
+ *  \file   intern_pool_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/intern_pool.h"
+#include "superstring/superstring.h"
+
+namespace {
+
+using jfern::intern_pool;
+
+TEST(intern_pool, intern) {
+    intern_pool pool;
+    EXPECT_EQ(pool.size(), 0u);
+
+    const intern_pool::id_type get  = pool.intern("GET");
+    const intern_pool::id_type post = pool.intern("POST");
+    const intern_pool::id_type none = pool.intern("");
+
+    EXPECT_NE(get, post);
+    EXPECT_NE(get, none);
+    EXPECT_EQ(pool.intern(std::string("GET")), get);
+    EXPECT_EQ(pool.intern("POST"), post);
+    EXPECT_EQ(pool.intern(""), none);
+
+    EXPECT_EQ(pool.view(get), "GET");
+    EXPECT_EQ(pool.view(post), "POST");
+    EXPECT_EQ(pool.view(none), "");
+
+    EXPECT_EQ(pool.size(), 3u);
+    EXPECT_EQ(pool.bytes(), 7u);
+
+    /* The pool keeps its own copy */
+    std::string temporary = "hostname.example.com";
+    const intern_pool::id_type host = pool.intern(temporary);
+    temporary.assign(temporary.size(), 'x');
+    EXPECT_EQ(pool.view(host), "hostname.example.com");
+}
+
+TEST(intern_pool, find) {
+    intern_pool pool(1);
+
+    EXPECT_EQ(pool.find("absent"), intern_pool::npos);
+
+    const intern_pool::id_type id = pool.intern("present");
+    EXPECT_EQ(pool.find("present"), id);
+    EXPECT_EQ(pool.find("absent"), intern_pool::npos);
+    EXPECT_EQ(pool.size(), 1u);
+
+    EXPECT_THROW(pool.view(intern_pool::npos), std::out_of_range);
+    EXPECT_THROW(pool.view(id + 1), std::out_of_range);
+
+    EXPECT_THROW(intern_pool(0), std::invalid_argument);
+    EXPECT_THROW(intern_pool(257), std::invalid_argument);
+}
+
+TEST(intern_pool, many) {
+    intern_pool pool(4);
+
+    /* Enough strings to fill several segments in each shard */
+    std::vector<intern_pool::id_type> ids;
+    for (int i = 0; i < 20000; i++)
+        ids.push_back(pool.intern("token-" + std::to_string(i)));
+
+    EXPECT_EQ(pool.size(), 20000u);
+    EXPECT_EQ(std::set<intern_pool::id_type>(ids.begin(), ids.end()).size(),
+              20000u);
+
+    for (int i = 0; i < 20000; i++) {
+        EXPECT_EQ(pool.view(ids[i]), "token-" + std::to_string(i));
+        EXPECT_EQ(pool.intern("token-" + std::to_string(i)), ids[i]);
+    }
+}
+
+TEST(intern_pool, concurrent) {
+    intern_pool pool;
+
+    /* Every thread interns the same strings, in a different order */
+    constexpr int strings = 5000;
+    std::vector<std::vector<intern_pool::id_type>> ids(4);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < ids.size(); t++) {
+        threads.emplace_back([&pool, &ids, t]() {
+            ids[t].resize(strings);
+            for (int n = 0; n < strings; n++) {
+                const int i = (n * 7919 + static_cast<int>(t) * 1237)
+                              % strings;
+                ids[t][i] = pool.intern("field" + std::to_string(i));
+
+                /* Views are read without locking while others insert */
+                if (pool.view(ids[t][i]) != "field" + std::to_string(i))
+                    ids[t][i] = intern_pool::npos;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(pool.size(), static_cast<std::size_t>(strings));
+    for (std::size_t t = 1; t < ids.size(); t++) EXPECT_EQ(ids[t], ids[0]);
+    for (intern_pool::id_type id : ids[0]) EXPECT_NE(id, intern_pool::npos);
+}
+
+TEST(intern_pool, split_interned) {
+    intern_pool pool;
+
+    const jfern::superstring record("GET /index.html GET  /about.html");
+    const auto ids = record.split_interned(pool);
+
+    ASSERT_EQ(ids.size(), 4u);
+    EXPECT_EQ(ids[0], ids[2]);
+    EXPECT_NE(ids[1], ids[3]);
+    EXPECT_EQ(pool.view(ids[1]), "/index.html");
+    EXPECT_EQ(pool.size(), 3u);
+
+    const auto fields = jfern::superstring("a,b,,a").split_interned(pool,
+                                                                    ",");
+    ASSERT_EQ(fields.size(), 3u);
+    EXPECT_EQ(fields[0], fields[2]);
+
+    const auto whole = jfern::superstring("a b").split_interned(pool, "");
+    ASSERT_EQ(whole.size(), 1u);
+    EXPECT_EQ(pool.view(whole[0]), "a b");
+}
+
+}  // namespace
@@ -0,0 +1,160 @@
+/**
+ *  \file   join_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstdio>
+#include <forward_list>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/join.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace {
+
+/* Counts reserve() calls and records what is written */
+class recording_sink final {
+ public:
+    void reserve(std::size_t size) {
+        reserved += size;
+        reserve_calls++;
+    }
+
+    void write(const char* data, std::size_t size) {
+        out.append(data, size);
+        write_calls++;
+    }
+
+    std::string out;
+    std::size_t reserved = 0;
+    std::size_t reserve_calls = 0;
+    std::size_t write_calls = 0;
+};
+
+TEST(join, string) {
+    const std::vector<std::string> fields = {"a", "bb", "", "ccc"};
+
+    EXPECT_EQ(jfern::join(",", fields.begin(), fields.end()), "a,bb,,ccc");
+    EXPECT_EQ(jfern::join("", fields.begin(), fields.end()), "abbccc");
+    EXPECT_EQ(jfern::join(" - ", fields.begin(), fields.begin() + 1), "a");
+    EXPECT_EQ(jfern::join(",", fields.begin(), fields.begin()), "");
+
+    const char* words[] = {"hello", "big", "world"};
+    EXPECT_EQ(jfern::join(" ", std::begin(words), std::end(words)),
+              "hello big world");
+}
+
+TEST(join, sizing_pass) {
+    const std::forward_list<std::string> fields = {"one", "two", "three"};
+
+    recording_sink sink;
+    const std::size_t written =
+        jfern::join(sink, ", ", fields.begin(), fields.end());
+
+    EXPECT_EQ(sink.out, "one, two, three");
+    EXPECT_EQ(written, sink.out.size());
+    EXPECT_EQ(sink.reserve_calls, 1u);
+    EXPECT_EQ(sink.reserved, sink.out.size());
+
+    /* The result string is allocated exactly once */
+    std::vector<std::string> many(10000, "field");
+    const std::string joined = jfern::join(",", many.begin(), many.end());
+    EXPECT_EQ(joined.size(), 10000 * 6 - 1);
+    EXPECT_LT(joined.capacity(), joined.size() + 32);
+}
+
+TEST(join, single_pass) {
+    std::istringstream input("alpha beta gamma");
+    std::istream_iterator<std::string> first(input), last;
+
+    recording_sink sink;
+    jfern::join(sink, "|", first, last);
+
+    EXPECT_EQ(sink.out, "alpha|beta|gamma");
+    EXPECT_EQ(sink.reserve_calls, 0u);
+
+    std::istringstream again("x y z");
+    EXPECT_EQ(jfern::join(
+                  "+", std::istream_iterator<std::string>(again),
+                  std::istream_iterator<std::string>()),
+              "x+y+z");
+}
+
+TEST(join, buffer_sink) {
+    const std::vector<std::string> fields = {"key", "value"};
+
+    char buffer[16];
+    jfern::buffer_sink sink(buffer, sizeof(buffer));
+
+    EXPECT_EQ(jfern::join(sink, "=", fields.begin(), fields.end()), 9u);
+    EXPECT_EQ(sink.size(), 9u);
+    EXPECT_EQ(sink.view(), "key=value");
+
+    /* The sizing pass catches overflow before anything is written */
+    EXPECT_THROW(jfern::join(sink, "=", fields.begin(), fields.end()),
+                 std::length_error);
+    EXPECT_EQ(sink.view(), "key=value");
+
+    sink.write("1234567", 7);
+    EXPECT_EQ(sink.size(), 16u);
+    EXPECT_THROW(sink.write("x", 1), std::length_error);
+    sink.write("", 0);
+}
+
+TEST(join, ostream_sink) {
+    const std::vector<std::string> fields = {"1", "2", "3"};
+
+    std::ostringstream stream;
+    jfern::ostream_sink sink(stream);
+    jfern::join(sink, "\n", fields.begin(), fields.end());
+
+    EXPECT_EQ(stream.str(), "1\n2\n3");
+}
+
+#ifndef _WIN32
+TEST(join, fd_sink) {
+    EXPECT_THROW(jfern::fd_sink(1, 0), std::invalid_argument);
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    std::vector<std::string> fields;
+    for (int i = 0; i < 1000; i++) fields.push_back(std::to_string(i));
+    fields.push_back(std::string(100, 'x'));
+
+    const std::string expected = jfern::join(",", fields.begin(),
+                                             fields.end());
+    {
+        /* Small chunks, so pieces are both gathered and written directly */
+        jfern::fd_sink sink(::fileno(file), 32);
+        jfern::join(sink, ",", fields.begin(), fields.end());
+    }
+
+    std::rewind(file);
+    std::string actual(expected.size() + 1, '\0');
+    actual.resize(std::fread(&actual[0], 1, actual.size(), file));
+    std::fclose(file);
+
+    EXPECT_EQ(actual, expected);
+
+    jfern::fd_sink bad(-1, 8);
+    bad.write("abc", 3);
+    EXPECT_THROW(bad.flush(), std::system_error);
+}
+#endif
+
+}  // namespace
@@ -0,0 +1,178 @@
+/**
+ *  \file   matcher_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/matcher.h"
+
+namespace {
+
+using jfern::match;
+using jfern::matcher;
+using jfern::prefilter;
+using jfern::superstring_view;
+
+/* Every match, found by trying each pattern at each position */
+std::vector<match> naive_find_all(const std::vector<std::string>& patterns,
+                                  const std::string& text) {
+    std::vector<match> matches;
+
+    for (std::size_t end = 0; end < text.size(); end++) {
+        for (std::size_t i = 0; i < patterns.size(); i++) {
+            const std::size_t length = patterns[i].size();
+            if (length == 0 || length > end + 1) continue;
+
+            const std::size_t position = end + 1 - length;
+            if (text.compare(position, length, patterns[i]) == 0)
+                matches.push_back({i, position, length});
+        }
+    }
+
+    return matches;
+}
+
+std::string random_string(std::size_t size, const std::string& alphabet,
+                          std::default_random_engine* engine) {
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+
+    std::string out(size, '\0');
+    for (char& c : out) c = alphabet[pick(*engine)];
+    return out;
+}
+
+TEST(matcher, basic) {
+    const matcher keywords({"he", "she", "his", "hers"});
+
+    EXPECT_EQ(keywords.size(), 4u);
+    EXPECT_EQ(keywords.pattern(3), "hers");
+    EXPECT_THROW(keywords.pattern(4), std::out_of_range);
+
+    const std::vector<match> expected = {
+        {0, 2, 2}, {1, 1, 3}, {3, 2, 4}
+    };
+    EXPECT_EQ(keywords.find_all("ushers"), expected);
+
+    /* "she" and "he" both end at 3; "he" was given first */
+    EXPECT_EQ(keywords.find_first("ushers"), (match{0, 2, 2}));
+    EXPECT_TRUE(keywords.contains("this"));
+    EXPECT_FALSE(keywords.contains("tree"));
+    EXPECT_FALSE(keywords.contains(""));
+    EXPECT_EQ(keywords.find_first("nothing").pattern, match::npos);
+}
+
+TEST(matcher, edge_cases) {
+    const std::vector<std::string> patterns = {"", "aa", "aa", "a"};
+    const matcher m(patterns.begin(), patterns.end());
+
+    /* Empty patterns never match; duplicates are reported separately */
+    const std::vector<match> expected = {
+        {3, 0, 1}, {1, 0, 2}, {2, 0, 2}, {3, 1, 1}
+    };
+    EXPECT_EQ(m.find_all("aa"), expected);
+
+    const matcher none({});
+    EXPECT_EQ(none.size(), 0u);
+    EXPECT_FALSE(none.contains("anything"));
+
+    /* Every byte value, including NUL and those above 0x7f */
+    std::string all;
+    for (int c = 0; c < 256; c++) all.push_back(static_cast<char>(c));
+
+    const std::vector<std::string> bytes = {all, std::string(1, '\0'),
+                                            std::string(1, '\xff')};
+    const matcher binary(bytes.begin(), bytes.end());
+    EXPECT_EQ(binary.find_all(all + all), naive_find_all(bytes, all + all));
+}
+
+TEST(matcher, prefilter_modes) {
+    EXPECT_EQ(matcher({"ERROR"}).mode(), prefilter::automatic);
+    EXPECT_EQ(matcher({"ERROR"}, prefilter::off).mode(), prefilter::off);
+
+    /*
+     * Candidates everywhere, so the automatic mode gives up on the prefilter
+     * part way through. The results must not change when it does
+     */
+    std::string text;
+    for (int i = 0; i < 200; i++) text += "ab" + std::to_string(i) + "ba";
+
+    const std::vector<std::string> patterns = {"a1", "99b", "ba"};
+    const std::vector<match> expected = naive_find_all(patterns, text);
+
+    for (prefilter mode : {prefilter::off, prefilter::on,
+                           prefilter::automatic}) {
+        const matcher m(patterns.begin(), patterns.end(), mode);
+        EXPECT_EQ(m.find_all(text), expected);
+    }
+}
+
+TEST(matcher, randomized) {
+    std::default_random_engine engine;
+    std::uniform_int_distribution<std::size_t> count(1, 30);
+    std::uniform_int_distribution<std::size_t> length(1, 6);
+
+    const std::string alphabets[] = {"ab", "abcd", "xyz \xe9\x80"};
+
+    for (int trial = 0; trial < 200; trial++) {
+        const std::string& alphabet = alphabets[trial % 3];
+
+        std::vector<std::string> patterns(count(engine));
+        for (std::string& pattern : patterns)
+            pattern = random_string(length(engine), alphabet, &engine);
+
+        const std::string text = random_string(300, alphabet + "qr",
+                                               &engine);
+        const std::vector<match> expected = naive_find_all(patterns, text);
+
+        for (prefilter mode : {prefilter::off, prefilter::on,
+                               prefilter::automatic}) {
+            const matcher m(patterns.begin(), patterns.end(), mode);
+
+            EXPECT_EQ(m.find_all(text), expected);
+
+            const match first = m.find_first(text);
+            if (expected.empty()) {
+                EXPECT_EQ(first.pattern, match::npos);
+            } else {
+                EXPECT_EQ(first, expected.front());
+            }
+        }
+    }
+}
+
+TEST(matcher, shared) {
+    const matcher m({"timeout", "refused", "reset by peer"});
+
+    std::string text;
+    for (int i = 0; i < 1000; i++) text += "ok ok ok connection reset by peer ";
+
+    const std::vector<match> expected = m.find_all(text);
+    ASSERT_EQ(expected.size(), 1000u);
+
+    /* Concurrent scans of one matcher need no synchronization */
+    std::vector<std::thread> threads;
+    std::vector<int> results(4, 0);
+    for (std::size_t t = 0; t < results.size(); t++) {
+        threads.emplace_back([&m, &text, &expected, &results, t]() {
+            for (int rep = 0; rep < 20; rep++)
+                results[t] += (m.find_all(text) == expected);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (int result : results) EXPECT_EQ(result, 20);
+}
+
+}  // namespace
@@ -0,0 +1,131 @@
+/**
+ *  \file   morton_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/morton.h"
+
+namespace {
+
+using jfern::bitops::morton_decode;
+using jfern::bitops::morton_encode;
+
+/* Interleave coordinates one bit at a time */
+template <typename T>
+T naive_encode(const std::vector<T>& coordinates) {
+    const std::size_t dims = coordinates.size();
+    const std::size_t bits = 8 * sizeof(T) / dims;
+
+    std::uint64_t code = 0;
+    for (std::size_t b = 0; b < bits; b++) {
+        for (std::size_t d = 0; d < dims; d++) {
+            const std::uint64_t bit = (std::uint64_t(coordinates[d]) >> b) & 1;
+            code |= bit << (b * dims + d);
+        }
+    }
+
+    return T(code);
+}
+
+constexpr std::uint32_t constexpr_decode_x(std::uint32_t code) {
+    std::uint32_t x = 0, y = 0;
+    morton_decode(code, &x, &y);
+    return x;
+}
+
+template <typename T>
+void check_type() {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution;
+
+    constexpr std::size_t n = 1000;
+    std::vector<T> xs(n), ys(n), zs(n), codes(n), out_x(n), out_y(n),
+                   out_z(n);
+
+    constexpr int bits2 = 8 * sizeof(T) / 2;
+    constexpr int bits3 = 8 * sizeof(T) / 3;
+
+    const std::uint64_t mask2 = (std::uint64_t(1) << bits2) - 1;
+    const std::uint64_t mask3 = (std::uint64_t(1) << bits3) - 1;
+
+    for (std::size_t i = 0; i < n; i++) {
+        xs[i] = T(distribution(generator));
+        ys[i] = T(distribution(generator));
+        zs[i] = T(distribution(generator));
+    }
+
+    /* 2D: out-of-range coordinate bits are ignored */
+    morton_encode(xs.data(), ys.data(), n, codes.data());
+    morton_decode(codes.data(), n, out_x.data(), out_y.data());
+
+    for (std::size_t i = 0; i < n; i++) {
+        const T x = T(xs[i] & mask2), y = T(ys[i] & mask2);
+
+        ASSERT_EQ(codes[i], naive_encode<T>({x, y}));
+        ASSERT_EQ(codes[i], morton_encode(xs[i], ys[i]));
+        ASSERT_EQ(out_x[i], x);
+        ASSERT_EQ(out_y[i], y);
+    }
+
+    /* 3D */
+    morton_encode(xs.data(), ys.data(), zs.data(), n, codes.data());
+    morton_decode(codes.data(), n, out_x.data(), out_y.data(),
+                  out_z.data());
+
+    for (std::size_t i = 0; i < n; i++) {
+        const T x = T(xs[i] & mask3), y = T(ys[i] & mask3),
+                z = T(zs[i] & mask3);
+
+        ASSERT_EQ(codes[i], naive_encode<T>({x, y, z}));
+        ASSERT_EQ(codes[i], morton_encode(xs[i], ys[i], zs[i]));
+        ASSERT_EQ(out_x[i], x);
+        ASSERT_EQ(out_y[i], y);
+        ASSERT_EQ(out_z[i], z);
+    }
+}
+
+TEST(morton, constexpr_encode) {
+    static_assert(morton_encode<std::uint32_t>(0xffff, 0) == 0x55555555u, "");
+    static_assert(morton_encode<std::uint32_t>(0, 0xffff) == 0xaaaaaaaau, "");
+    static_assert(morton_encode<std::uint16_t>(3, 5)      == 0x27,        "");
+    static_assert(morton_encode<std::uint64_t>(1, 1, 1)   == 7,           "");
+    static_assert(constexpr_decode_x(0x27)                == 3,           "");
+}
+
+TEST(morton, encode_decode_16) {
+    check_type<std::uint16_t>();
+}
+
+TEST(morton, encode_decode_32) {
+    check_type<std::uint32_t>();
+}
+
+TEST(morton, encode_decode_64) {
+    check_type<std::uint64_t>();
+}
+
+TEST(morton, extremes) {
+    constexpr std::uint64_t all = ~std::uint64_t(0);
+
+    EXPECT_EQ(morton_encode(all, all), all);
+    EXPECT_EQ(morton_encode(all, all, all), all >> 1);
+
+    std::uint64_t x = 0, y = 0, z = 0;
+    morton_decode(all, &x, &y, &z);
+    EXPECT_EQ(x, 0x1fffffu);
+    EXPECT_EQ(y, 0x1fffffu);
+    EXPECT_EQ(z, 0x1fffffu);
+}
+
+}  // namespace
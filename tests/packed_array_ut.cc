@@ -0,0 +1,171 @@
+/**
+ *  \file   packed_array_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/packed_array.h"
+
+namespace {
+
+using jfern::bitops::delta_packed_array;
+using jfern::bitops::for_packed_array;
+using jfern::bitops::packed_array;
+
+/* Random values that fit in Bits bits */
+template <int Bits>
+std::vector<std::uint32_t> make_values(std::size_t n) {
+    std::default_random_engine generator(Bits);
+    std::uniform_int_distribution<std::uint32_t> distribution(
+        0, packed_array<Bits>::max_value);
+
+    std::vector<std::uint32_t> values(n);
+    for (auto& value : values) value = distribution(generator);
+    return values;
+}
+
+template <int Bits>
+void check_width() {
+    SCOPED_TRACE(Bits);
+
+    const std::size_t n = 1000;
+    const std::vector<std::uint32_t> values = make_values<Bits>(n);
+
+    packed_array<Bits> packed(values.data(), n);
+    ASSERT_EQ(packed.size(), n);
+
+    for (std::size_t i = 0; i < n; i++) {
+        ASSERT_EQ(packed[i], values[i]) << i;
+    }
+
+    /* Unpack runs starting and ending off any alignment */
+    std::vector<std::uint32_t> out(n);
+    for (std::size_t first : {0, 1, 7, 8, 13, 64, 500}) {
+        for (std::size_t length : {0, 1, 8, 9, 100, 437}) {
+            std::fill(out.begin(), out.end(), 0xdeadbeef);
+            packed.unpack(first, length, out.data());
+
+            ASSERT_TRUE(std::equal(out.begin(), out.begin() + length,
+                                   values.begin() + first));
+            ASSERT_EQ(out[length], 0xdeadbeef);
+        }
+    }
+
+    /* Writes must not disturb the neighbors */
+    packed_array<Bits> written(n);
+    for (std::size_t i = 0; i < n; i += 2) written.set(i, values[i]);
+    for (std::size_t i = 1; i < n; i += 2) written.set(i, values[i]);
+    for (std::size_t i = 0; i < n; i++) {
+        ASSERT_EQ(written[i], values[i]) << i;
+    }
+
+    written.set(3, ~0u);
+    EXPECT_EQ(written[3], packed_array<Bits>::max_value);
+    EXPECT_EQ(written[2], values[2]);
+    EXPECT_EQ(written[4], values[4]);
+}
+
+TEST(packed_array, widths) {
+    check_width<1>();
+    check_width<3>();
+    check_width<5>();
+    check_width<7>();
+    check_width<8>();
+    check_width<12>();
+    check_width<17>();
+    check_width<20>();
+    check_width<25>();
+    check_width<26>();
+    check_width<31>();
+    check_width<32>();
+}
+
+TEST(packed_array, memory) {
+    const std::vector<std::uint32_t> values = make_values<4>(100000);
+    const packed_array<4> packed(values.data(), values.size());
+
+    EXPECT_LT(packed.memory_bytes(), 100000 * 4 / 7);
+    EXPECT_EQ(packed_array<4>::value_bits, 4);
+}
+
+TEST(packed_array, overflow) {
+    const std::uint32_t values[] = {1, 2, 8};
+    EXPECT_THROW(packed_array<3>(values, 3), std::invalid_argument);
+    EXPECT_NO_THROW(packed_array<4>(values, 3));
+}
+
+TEST(packed_array, frame_of_reference) {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint32_t> gap(0, 30);
+
+    std::vector<std::uint32_t> values(1000);
+    std::uint32_t value = 3000000000u;
+    for (auto& v : values) v = value += gap(generator);
+
+    /* Slightly unsorted data is fine as long as each block is narrow */
+    std::swap(values[10], values[20]);
+
+    const for_packed_array<12> encoded(values.data(), values.size());
+    ASSERT_EQ(encoded.size(), values.size());
+
+    for (std::size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(encoded.get(i), values[i]) << i;
+    }
+
+    std::vector<std::uint32_t> decoded(values.size());
+    encoded.decode(decoded.data());
+    EXPECT_EQ(decoded, values);
+
+    EXPECT_LT(encoded.memory_bytes(), values.size() * 4 / 2);
+
+    EXPECT_THROW(for_packed_array<4>(values.data(), values.size()),
+                 std::invalid_argument);
+}
+
+TEST(packed_array, delta) {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint32_t> gap(0, 15);
+
+    std::vector<std::uint32_t> values(1000);
+    std::uint32_t value = 12345;
+    for (auto& v : values) v = value += gap(generator);
+
+    const delta_packed_array<4> encoded(values.data(), values.size());
+    ASSERT_EQ(encoded.size(), values.size());
+
+    for (std::size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(encoded.get(i), values[i]) << i;
+    }
+
+    std::vector<std::uint32_t> decoded(values.size());
+    encoded.decode(decoded.data());
+    EXPECT_EQ(decoded, values);
+
+    EXPECT_LT(encoded.memory_bytes(), values.size() * 4 / 5);
+
+    EXPECT_THROW(delta_packed_array<3>(values.data(), values.size()),
+                 std::invalid_argument);
+
+    std::swap(values[5], values[6]);
+    if (values[5] != values[6]) {
+        EXPECT_THROW(delta_packed_array<4>(values.data(), values.size()),
+                     std::invalid_argument);
+    }
+
+    const delta_packed_array<4> empty(values.data(), 0);
+    EXPECT_EQ(empty.size(), 0u);
+}
+
+}  // namespace
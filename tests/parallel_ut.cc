@@ -0,0 +1,101 @@
+/**
+ *  \file   parallel_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/parallel.h"
+
+namespace {
+
+/* Text long enough to be split across threads, with runs of separators */
+std::string make_text(const std::string& separator, std::size_t size) {
+    std::mt19937 rng(11);
+    const std::string words[] = {"alpha", "Beta", "  gamma ", "DELTA", "",
+                                 "\t", "epsilon", "x"};
+
+    std::string text;
+    while (text.size() < size) {
+        text += words[rng() % 8];
+        text += separator;
+        if (rng() % 16 == 0) text += separator;
+    }
+
+    return text;
+}
+
+TEST(parallel, split) {
+    jfern::thread_pool pool(4);
+
+    for (const std::string separator : {" ", ",", "\r\n", "::", "aa", ""}) {
+        const jfern::superstring str(make_text(separator, 4 << 20));
+
+        const auto expected = str.split(separator);
+        EXPECT_EQ(jfern::parallel::split(pool, str, separator), expected)
+            << "separator \"" << separator << "\"";
+    }
+
+    /* Leading and trailing separators, and inputs too short to divide */
+    const std::string dense(1 << 20, ',');
+    for (const std::string& text : {"," + make_text(",", 1 << 20) + ",",
+                                   dense, std::string(), std::string("a,b")}) {
+        const jfern::superstring str(text);
+        EXPECT_EQ(jfern::parallel::split(pool, str, ","), str.split(","));
+    }
+}
+
+TEST(parallel, split_size) {
+    jfern::thread_pool pool(3);
+    const jfern::superstring str(make_text(" ", (1 << 20) + 17));
+
+    for (std::size_t size : {std::size_t(1), std::size_t(7),
+                             std::size_t(4096), std::size_t(1 << 19),
+                             std::size_t(0), std::string::npos}) {
+        EXPECT_EQ(jfern::parallel::split(pool, str, size), str.split(size))
+            << "size " << size;
+    }
+
+    const jfern::superstring empty(std::string{});
+    EXPECT_EQ(jfern::parallel::split(pool, empty, 3), empty.split(3));
+}
+
+TEST(parallel, split_trimmed) {
+    jfern::thread_pool pool(4);
+    const jfern::superstring str(make_text(",", 2 << 20));
+
+    std::vector<std::string> expected;
+    for (const std::string& token : str.split(","))
+        expected.push_back(jfern::superstring(token).trim());
+
+    EXPECT_EQ(jfern::parallel::split_trimmed(pool, str, ","), expected);
+    EXPECT_EQ(jfern::parallel::split_trimmed(pool, str, ""),
+              std::vector<std::string>{str.trim()});
+}
+
+TEST(parallel, case_mapping) {
+    jfern::thread_pool pool(4);
+
+    for (std::size_t size : {std::size_t(100), std::size_t((3 << 20) + 5)}) {
+        const jfern::superstring str(make_text("-Z-", size));
+
+        EXPECT_EQ(jfern::parallel::to_lower(pool, str).get(),
+                  str.to_lower().get());
+        EXPECT_EQ(jfern::parallel::to_upper(pool, str).get(),
+                  str.to_upper().get());
+
+        jfern::superstring copy(str);
+        EXPECT_EQ(jfern::parallel::to_upper(pool, std::move(copy)).get(),
+                  str.to_upper().get());
+    }
+}
+
+}  // namespace
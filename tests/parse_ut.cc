@@ -0,0 +1,281 @@
+/**
+ *  \file   parse_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/parse.h"
+
+namespace {
+
+using jfern::parse_status;
+
+template <class Integer>
+void check_limits() {
+    const Integer min = std::numeric_limits<Integer>::min();
+    const Integer max = std::numeric_limits<Integer>::max();
+
+    Integer value = 1;
+    EXPECT_EQ(jfern::parse(std::to_string(max), &value), parse_status::ok);
+    EXPECT_EQ(value, max);
+
+    EXPECT_EQ(jfern::parse(std::to_string(min), &value), parse_status::ok);
+    EXPECT_EQ(value, min);
+
+    /* One past each end */
+    std::string above = std::to_string(max);
+    above.back()++;
+    if (above.back() > '9') above = std::to_string(max) + "0";
+    EXPECT_EQ(jfern::parse(above, &value), parse_status::out_of_range)
+        << above;
+    EXPECT_EQ(value, 0);
+
+    if (std::is_signed<Integer>::value) {
+        std::string below = std::to_string(min);
+        below.back()++;
+        EXPECT_EQ(jfern::parse(below, &value), parse_status::out_of_range)
+            << below;
+    } else {
+        EXPECT_EQ(jfern::parse("-1", &value), parse_status::invalid);
+        EXPECT_EQ(jfern::parse("-0", &value), parse_status::invalid);
+    }
+}
+
+/* Check a parse against strtod(), bit for bit */
+void check_double(const std::string& str) {
+    double value;
+    const parse_status status = jfern::parse(str, &value);
+    const double expected = std::strtod(str.c_str(), nullptr);
+
+    EXPECT_EQ(status, std::isinf(expected) ? parse_status::out_of_range
+                                           : parse_status::ok) << str;
+    EXPECT_EQ(std::memcmp(&value, &expected, sizeof(value)), 0)
+        << str << ": " << value << " != " << expected;
+}
+
+TEST(parse, integers) {
+    std::int32_t value = 5;
+
+    EXPECT_EQ(jfern::parse("0", &value), parse_status::ok);
+    EXPECT_EQ(value, 0);
+
+    EXPECT_EQ(jfern::parse("+123", &value), parse_status::ok);
+    EXPECT_EQ(value, 123);
+
+    EXPECT_EQ(jfern::parse("-98765", &value), parse_status::ok);
+    EXPECT_EQ(value, -98765);
+
+    EXPECT_EQ(jfern::parse("1234567890", &value), parse_status::ok);
+    EXPECT_EQ(value, 1234567890);
+
+    /* Leading zeros, including more than fit in the type */
+    EXPECT_EQ(jfern::parse("000000000000000000000000042", &value),
+              parse_status::ok);
+    EXPECT_EQ(value, 42);
+
+    std::uint64_t wide = 0;
+    EXPECT_EQ(jfern::parse("18446744073709551615", &wide), parse_status::ok);
+    EXPECT_EQ(wide, std::numeric_limits<std::uint64_t>::max());
+
+    EXPECT_EQ(jfern::parse("18446744073709551616", &wide),
+              parse_status::out_of_range);
+    EXPECT_EQ(jfern::parse("99999999999999999999", &wide),
+              parse_status::out_of_range);
+    EXPECT_EQ(jfern::parse("123456789012345678901234", &wide),
+              parse_status::out_of_range);
+    EXPECT_EQ(wide, 0u);
+
+    /* Every length, to cover the eight-digit blocks and what follows */
+    std::string digits;
+    std::uint64_t expected = 0;
+    for (int i = 1; i <= 19; i++) {
+        digits += static_cast<char>('0' + i % 10);
+        expected = expected * 10 + i % 10;
+
+        EXPECT_EQ(jfern::parse(digits, &wide), parse_status::ok) << digits;
+        EXPECT_EQ(wide, expected);
+    }
+}
+
+TEST(parse, integer_limits) {
+    check_limits<std::int8_t>();
+    check_limits<std::uint8_t>();
+    check_limits<std::int16_t>();
+    check_limits<std::uint16_t>();
+    check_limits<std::int32_t>();
+    check_limits<std::uint32_t>();
+    check_limits<std::int64_t>();
+    check_limits<std::uint64_t>();
+}
+
+TEST(parse, invalid_integers) {
+    std::int64_t value = 1;
+
+    for (const char* str : {"", "+", "-", " 1", "1 ", "1.0", "0x10", "1e3",
+                            "12345678a", "1234567a9", "--1", "+-1",
+                            "1234567890123456789012345x"}) {
+        EXPECT_EQ(jfern::parse(str, &value), parse_status::invalid) << str;
+        EXPECT_EQ(value, 0);
+    }
+
+    /* A non-digit at each position of the eight-digit blocks */
+    for (std::size_t i = 0; i < 18; i++) {
+        std::string str(18, '7');
+        for (char c : {'/', ':', ' ', '\0', '\xB7'}) {
+            str[i] = c;
+            EXPECT_EQ(jfern::parse(str, &value), parse_status::invalid);
+        }
+    }
+}
+
+TEST(parse, doubles) {
+    double value;
+
+    EXPECT_EQ(jfern::parse("0", &value), parse_status::ok);
+    EXPECT_EQ(value, 0.0);
+    EXPECT_FALSE(std::signbit(value));
+
+    EXPECT_EQ(jfern::parse("-0.0", &value), parse_status::ok);
+    EXPECT_EQ(value, 0.0);
+    EXPECT_TRUE(std::signbit(value));
+
+    EXPECT_EQ(jfern::parse("3.25", &value), parse_status::ok);
+    EXPECT_EQ(value, 3.25);
+
+    EXPECT_EQ(jfern::parse("-.5", &value), parse_status::ok);
+    EXPECT_EQ(value, -0.5);
+
+    EXPECT_EQ(jfern::parse("+7.", &value), parse_status::ok);
+    EXPECT_EQ(value, 7.0);
+
+    EXPECT_EQ(jfern::parse("1E3", &value), parse_status::ok);
+    EXPECT_EQ(value, 1000.0);
+
+    EXPECT_EQ(jfern::parse("25e-2", &value), parse_status::ok);
+    EXPECT_EQ(value, 0.25);
+
+    for (const char* str : {"0.1", "1e22", "1e23", "123456789012345678",
+                            "9007199254740993", "0.000001",
+                            "1.7976931348623157e308",
+                            "2.2250738585072014e-308", "4.9e-324",
+                            "2.4703282292062327e-324",
+                            "2.4703282292062328e-324",
+                            "1e-400", "-1e-400", "1.8e308", "-1e500",
+                            "0.00000000000000000000000000000000000000001",
+                            "100000000000000000000000000000000000000000",
+                            "3.141592653589793238462643383279502884197"}) {
+        check_double(str);
+    }
+}
+
+TEST(parse, special_doubles) {
+    double value;
+
+    EXPECT_EQ(jfern::parse("inf", &value), parse_status::ok);
+    EXPECT_TRUE(std::isinf(value) && value > 0);
+
+    EXPECT_EQ(jfern::parse("-Infinity", &value), parse_status::ok);
+    EXPECT_TRUE(std::isinf(value) && value < 0);
+
+    EXPECT_EQ(jfern::parse("NaN", &value), parse_status::ok);
+    EXPECT_TRUE(std::isnan(value));
+
+    for (const char* str : {"", "+", "-", ".", "e5", ".e5", "1e", "1e+",
+                            "1.2.3", "1 ", " 1", "0x1p3", "infin", "nanx",
+                            "1,5", "--1", "1e5x"}) {
+        EXPECT_EQ(jfern::parse(str, &value), parse_status::invalid) << str;
+        EXPECT_EQ(value, 0.0);
+    }
+}
+
+TEST(parse, halfway_doubles) {
+    /*
+     * Exactly halfway between two doubles, and just either side: these
+     * can't be settled from a truncated product
+     */
+    for (const char* str : {"9007199254740993", "9007199254740995",
+                            "9007199254740993.0000000001",
+                            "9007199254740992.9999999999",
+                            "1.00000000000000011102230246251565404236316680"
+                            "908203125",
+                            "1.00000000000000011102230246251565404236316680"
+                            "908203124",
+                            "1.00000000000000011102230246251565404236316680"
+                            "908203126",
+                            "7.2057594037927933e16", "8.98846567431158e307",
+                            "2.2250738585072011e-308"}) {
+        check_double(str);
+    }
+}
+
+TEST(parse, random_doubles) {
+    std::mt19937_64 rng(17);
+    char buffer[64];
+
+    for (int i = 0; i < 200000; i++) {
+        std::uint64_t bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+
+        /* Shortest-ish and full precision, and plain decimals */
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        check_double(buffer);
+
+        std::snprintf(buffer, sizeof(buffer), "%.*g",
+                      static_cast<int>(rng() % 17) + 1, value);
+        check_double(buffer);
+
+        std::snprintf(buffer, sizeof(buffer), "%" PRIu64 ".%" PRIu64 "e%d",
+                      rng() % 1000000, rng(),
+                      static_cast<int>(rng() % 80) - 40);
+        check_double(buffer);
+    }
+}
+
+TEST(parse, column) {
+    const std::vector<std::string> tokens = {"1", "-2", "x", "300", ""};
+
+    std::int16_t values[5];
+    parse_status statuses[5];
+
+    EXPECT_EQ(jfern::parse_column(tokens.begin(), tokens.end(), values,
+                                  statuses), 3u);
+
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], -2);
+    EXPECT_EQ(values[2], 0);
+    EXPECT_EQ(values[3], 300);
+    EXPECT_EQ(statuses[2], parse_status::invalid);
+    EXPECT_EQ(statuses[4], parse_status::invalid);
+
+    std::int8_t narrow[5];
+    EXPECT_EQ(jfern::parse_column(tokens.begin(), tokens.end(), narrow), 2u);
+
+    const std::vector<jfern::superstring_view> fields = {"0.5", "1e400",
+                                                         "-3"};
+    double doubles[3];
+    EXPECT_EQ(jfern::parse_column(fields.begin(), fields.end(), doubles,
+                                  statuses), 2u);
+    EXPECT_EQ(doubles[0], 0.5);
+    EXPECT_EQ(statuses[1], parse_status::out_of_range);
+    EXPECT_EQ(doubles[2], -3.0);
+}
+
+}  // namespace
@@ -0,0 +1,119 @@
+/**
+ *  \file   rank_select_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/rank_select.h"
+
+namespace {
+
+using jfern::bitops::bitvector;
+using jfern::bitops::rank_select;
+
+/* Fill a bitvector so that roughly one in every \a density bits is set */
+bitvector make_random(std::size_t size, int density) {
+    std::default_random_engine generator(static_cast<unsigned>(size));
+    std::uniform_int_distribution<int> distribution(0, density - 1);
+
+    bitvector bits(size);
+    for (std::size_t i = 0; i < size; i++) {
+        if (distribution(generator) == 0) bits.set(i);
+    }
+
+    return bits;
+}
+
+/* Check every rank and select query against a linear scan */
+void check_all(const bitvector& bits) {
+    const rank_select index(bits);
+
+    std::vector<std::size_t> positions;
+    std::size_t expected_rank = 0;
+
+    for (std::size_t i = 0; i < bits.size(); i++) {
+        ASSERT_EQ(index.rank(i), expected_rank) << "rank(" << i << ")";
+        ASSERT_EQ(index.rank0(i), i - expected_rank) << "rank0(" << i << ")";
+
+        if (bits[i]) {
+            positions.push_back(i);
+            expected_rank++;
+        }
+    }
+
+    ASSERT_EQ(index.rank(bits.size()), expected_rank);
+    ASSERT_EQ(index.count(), expected_rank);
+
+    for (std::size_t k = 0; k < positions.size(); k++)
+        ASSERT_EQ(index.select(k), positions[k]) << "select(" << k << ")";
+
+    EXPECT_EQ(index.select(positions.size()), jfern::bitops::npos);
+}
+
+TEST(rank_select, select_in_word) {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint64_t> distribution(0);
+
+    for (int i = 0; i < 1000; i++) {
+        const std::uint64_t word = distribution(generator);
+
+        unsigned int k = 0;
+        for (int bit = 0; bit < 64; bit++) {
+            if ((word >> bit) & 1) {
+                ASSERT_EQ(jfern::bitops::detail::select_in_word(word, k++),
+                          bit) << "word = 0x" << std::hex << word;
+            }
+        }
+    }
+
+    EXPECT_EQ(jfern::bitops::detail::select_in_word(~std::uint64_t(0), 63),
+              63);
+    EXPECT_EQ(jfern::bitops::detail::select_in_word(std::uint64_t(1) << 63,
+                                                    0), 63);
+}
+
+TEST(rank_select, empty) {
+    const bitvector bits;
+    const rank_select index(bits);
+
+    EXPECT_EQ(index.rank(0), 0u);
+    EXPECT_EQ(index.count(), 0u);
+    EXPECT_EQ(index.select(0), jfern::bitops::npos);
+}
+
+TEST(rank_select, dense) {
+    check_all(bitvector(5000, true));
+    check_all(make_random(100000, 2));
+}
+
+TEST(rank_select, sparse) {
+    check_all(bitvector(5000));
+    check_all(make_random(100000, 100));
+    check_all(make_random(300000, 5000));
+}
+
+TEST(rank_select, block_boundaries) {
+    for (std::size_t size : {1, 63, 64, 511, 512, 2047, 2048, 2049, 8193}) {
+        check_all(make_random(size, 3));
+    }
+}
+
+TEST(rank_select, space_overhead) {
+    const bitvector bits = make_random(1 << 22, 2);
+    const rank_select index(bits);
+
+    const double bits_bytes = bits.num_words() * sizeof(std::uint64_t);
+    EXPECT_LT(index.space_bytes() / bits_bytes, 0.06);
+}
+
+}  // namespace
@@ -0,0 +1,227 @@
+/**
+ *  \file   roaring_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "bitops/roaring.h"
+
+namespace {
+
+using jfern::bitops::roaring_bitmap;
+using jfern::bitops::roaring_view;
+
+/*
+ * Random values drawn so that some 64K chunks end up sparse (array
+ * containers), some dense (bitmaps) and some as long runs
+ */
+std::set<std::uint32_t> make_values(unsigned int seed) {
+    std::default_random_engine generator(seed);
+    std::uniform_int_distribution<std::uint32_t> any(0);
+    std::uniform_int_distribution<std::uint32_t> low(0, 65535);
+
+    std::set<std::uint32_t> values;
+
+    for (int i = 0; i < 2000; i++) values.insert(any(generator));
+
+    for (std::uint32_t chunk : {3u, 7u}) {
+        for (int i = 0; i < 20000; i++)
+            values.insert((chunk << 16) | low(generator));
+    }
+
+    const std::uint32_t start = (5u << 16) + low(generator);
+    for (std::uint32_t v = start; v < start + 30000; v++) values.insert(v);
+
+    return values;
+}
+
+std::vector<std::uint32_t> to_vector(const roaring_bitmap& bitmap) {
+    return std::vector<std::uint32_t>(bitmap.begin(), bitmap.end());
+}
+
+std::vector<std::uint32_t> to_vector(const std::set<std::uint32_t>& set) {
+    return std::vector<std::uint32_t>(set.begin(), set.end());
+}
+
+TEST(roaring, add_remove_contains) {
+    roaring_bitmap bitmap;
+    EXPECT_TRUE(bitmap.empty());
+    EXPECT_EQ(bitmap.begin(), bitmap.end());
+
+    EXPECT_TRUE(bitmap.add(5));
+    EXPECT_FALSE(bitmap.add(5));
+    EXPECT_TRUE(bitmap.add(0xffffffffu));
+    EXPECT_TRUE(bitmap.contains(5));
+    EXPECT_TRUE(bitmap.contains(0xffffffffu));
+    EXPECT_FALSE(bitmap.contains(6));
+    EXPECT_EQ(bitmap.cardinality(), 2u);
+
+    EXPECT_TRUE(bitmap.remove(5));
+    EXPECT_FALSE(bitmap.remove(5));
+    EXPECT_TRUE(bitmap.remove(0xffffffffu));
+    EXPECT_TRUE(bitmap.empty());
+
+    /* Cross the array -> bitmap -> array threshold */
+    for (std::uint32_t v = 0; v < 10000; v++) bitmap.add(2 * v);
+    EXPECT_EQ(bitmap.cardinality(), 10000u);
+    for (std::uint32_t v = 0; v < 10000; v++)
+        ASSERT_EQ(bitmap.contains(v), v % 2 == 0) << v;
+
+    for (std::uint32_t v = 0; v < 9000; v++) bitmap.remove(2 * v);
+    EXPECT_EQ(bitmap.cardinality(), 1000u);
+    EXPECT_EQ(*bitmap.begin(), 18000u);
+}
+
+TEST(roaring, matches_std_set) {
+    const std::set<std::uint32_t> values = make_values(1);
+    const roaring_bitmap bitmap(values.begin(), values.end());
+
+    EXPECT_EQ(bitmap.cardinality(), values.size());
+    EXPECT_EQ(to_vector(bitmap), to_vector(values));
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint32_t> low(0, 65535);
+    for (int i = 0; i < 10000; i++) {
+        const std::uint32_t v = (low(generator) % 8 << 16) | low(generator);
+        ASSERT_EQ(bitmap.contains(v), values.count(v) == 1) << v;
+    }
+}
+
+TEST(roaring, add_range) {
+    roaring_bitmap bitmap{1, 2, 3};
+    bitmap.add_range(65530, 3 * 65536 + 10);
+
+    EXPECT_EQ(bitmap.cardinality(), 3u + 3 * 65536 + 10 - 65530);
+    EXPECT_TRUE(bitmap.contains(65530));
+    EXPECT_TRUE(bitmap.contains(2 * 65536));
+    EXPECT_TRUE(bitmap.contains(3 * 65536 + 9));
+    EXPECT_FALSE(bitmap.contains(3 * 65536 + 10));
+    EXPECT_FALSE(bitmap.contains(65529));
+
+    roaring_bitmap all;
+    all.add_range(0, std::uint64_t(1) << 32);
+    EXPECT_EQ(all.cardinality(), std::uint64_t(1) << 32);
+    EXPECT_LT(all.memory_bytes(), 65536u * 64);
+}
+
+TEST(roaring, run_optimize) {
+    const std::set<std::uint32_t> values = make_values(2);
+    roaring_bitmap bitmap(values.begin(), values.end());
+
+    const std::size_t before = bitmap.memory_bytes();
+    EXPECT_TRUE(bitmap.run_optimize());
+    EXPECT_LT(bitmap.memory_bytes(), before);
+
+    EXPECT_EQ(to_vector(bitmap), to_vector(values));
+    for (std::uint32_t v : values) ASSERT_TRUE(bitmap.contains(v));
+
+    /* Modifying a run container must still work */
+    const std::uint32_t in_run = *values.lower_bound((5u << 16) + 40000);
+    EXPECT_TRUE(bitmap.remove(in_run));
+    EXPECT_FALSE(bitmap.contains(in_run));
+    EXPECT_EQ(bitmap.cardinality(), values.size() - 1);
+}
+
+TEST(roaring, set_operations) {
+    for (bool optimize : {false, true}) {
+        const std::set<std::uint32_t> a_values = make_values(3);
+        const std::set<std::uint32_t> b_values = make_values(4);
+
+        roaring_bitmap a(a_values.begin(), a_values.end());
+        roaring_bitmap b(b_values.begin(), b_values.end());
+        if (optimize) {
+            a.run_optimize();
+            b.run_optimize();
+        }
+
+        std::vector<std::uint32_t> expected;
+
+        std::set_union(a_values.begin(), a_values.end(),
+                       b_values.begin(), b_values.end(),
+                       std::back_inserter(expected));
+        EXPECT_EQ(to_vector(a | b), expected);
+
+        expected.clear();
+        std::set_intersection(a_values.begin(), a_values.end(),
+                              b_values.begin(), b_values.end(),
+                              std::back_inserter(expected));
+        EXPECT_EQ(to_vector(a & b), expected);
+        EXPECT_EQ((a & b).cardinality(), expected.size());
+
+        expected.clear();
+        std::set_difference(a_values.begin(), a_values.end(),
+                            b_values.begin(), b_values.end(),
+                            std::back_inserter(expected));
+        EXPECT_EQ(to_vector(a - b), expected);
+
+        EXPECT_TRUE((a - a).empty());
+        EXPECT_EQ(a | a, a);
+        EXPECT_EQ(a & a, a);
+        EXPECT_NE(a, b);
+    }
+}
+
+TEST(roaring, serialize) {
+    const std::set<std::uint32_t> values = make_values(5);
+    roaring_bitmap bitmap(values.begin(), values.end());
+    bitmap.run_optimize();
+
+    const std::vector<std::uint8_t> bytes = bitmap.serialize();
+    EXPECT_EQ(bytes.size(), bitmap.serialized_bytes());
+
+    const roaring_bitmap copy =
+        roaring_bitmap::deserialize(bytes.data(), bytes.size());
+    EXPECT_EQ(copy, bitmap);
+
+    const roaring_view view(bytes.data(), bytes.size());
+    EXPECT_EQ(view.cardinality(), values.size());
+
+    std::vector<std::uint32_t> visited;
+    view.for_each([&visited](std::uint32_t v) { visited.push_back(v); });
+    EXPECT_EQ(visited, to_vector(values));
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::uint32_t> low(0, 65535);
+    for (int i = 0; i < 10000; i++) {
+        const std::uint32_t v = (low(generator) % 8 << 16) | low(generator);
+        ASSERT_EQ(view.contains(v), values.count(v) == 1) << v;
+    }
+
+    const std::vector<std::uint8_t> empty = roaring_bitmap().serialize();
+    EXPECT_TRUE(roaring_bitmap::deserialize(empty.data(),
+                                            empty.size()).empty());
+}
+
+TEST(roaring, deserialize_rejects_bad_input) {
+    const std::vector<std::uint8_t> bytes = roaring_bitmap{1, 70000}
+                                                .serialize();
+
+    EXPECT_THROW(roaring_view(bytes.data(), 4), std::invalid_argument);
+    EXPECT_THROW(roaring_view(bytes.data(), bytes.size() - 1),
+                 std::invalid_argument);
+
+    std::vector<std::uint8_t> corrupt = bytes;
+    corrupt[0] ^= 0xff;
+    EXPECT_THROW(roaring_bitmap::deserialize(corrupt.data(), corrupt.size()),
+                 std::invalid_argument);
+
+    corrupt = bytes;
+    corrupt[10] = 9;  // container type
+    EXPECT_THROW(roaring_bitmap::deserialize(corrupt.data(), corrupt.size()),
+                 std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,292 @@
+/**
+ *  \file   rope_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "superstring/join.h"
+#include "superstring/rope.h"
+
+namespace {
+
+/* Reassemble a rope from its chunks */
+std::string from_chunks(const jfern::rope& text) {
+    std::string out;
+    for (jfern::superstring_view chunk : text.chunks()) {
+        EXPECT_FALSE(chunk.empty());
+        out.append(chunk.data(), chunk.size());
+    }
+
+    return out;
+}
+
+/* Count a rope's chunks */
+std::size_t chunk_count(const jfern::rope& text) {
+    std::size_t count = 0;
+    for (auto iter = text.chunks().begin(); iter != text.chunks().end();
+         ++iter) {
+        count++;
+    }
+
+    return count;
+}
+
+TEST(rope, construct) {
+    const jfern::rope empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_EQ(empty.str(), "");
+    EXPECT_EQ(chunk_count(empty), 0u);
+
+    const jfern::rope text("hello world");
+    EXPECT_EQ(text.size(), 11u);
+    EXPECT_EQ(text.str(), "hello world");
+    EXPECT_EQ(text.at(4), 'o');
+    EXPECT_THROW(text.at(11), std::out_of_range);
+
+    const jfern::superstring sstring(std::string("abc"));
+    EXPECT_EQ(jfern::rope(sstring), "abc");
+    EXPECT_EQ(jfern::rope(jfern::superstring(std::string("xyz"))), "xyz");
+
+    const jfern::superstring back(text);
+    EXPECT_EQ(back.get(), "hello world");
+}
+
+TEST(rope, append) {
+    std::string expected;
+    jfern::rope text;
+
+    for (int i = 0; i < 5000; i++) {
+        const std::string piece = std::to_string(i) + ",";
+        expected += piece;
+        text += piece;
+    }
+
+    const std::string big(3 * jfern::rope::flat_size, 'b');
+    expected += big;
+    text += big;
+
+    std::string moved(2 * jfern::rope::flat_size, 'm');
+    const char* data = moved.data();
+    expected += moved;
+    text.append(std::move(moved));
+
+    text += "tail";
+    expected += "tail";
+
+    EXPECT_EQ(text.size(), expected.size());
+    EXPECT_EQ(text.str(), expected);
+    EXPECT_EQ(from_chunks(text), expected);
+    EXPECT_EQ(text, expected);
+
+    /* Short appends are gathered into chunks of flat_size */
+    EXPECT_LT(chunk_count(text), expected.size() / 1000);
+
+    /* A long moved string becomes a chunk without being copied */
+    bool adopted = false;
+    for (jfern::superstring_view chunk : text.chunks())
+        adopted |= chunk.data() == data;
+    EXPECT_TRUE(adopted);
+
+    for (std::size_t i = 0; i < expected.size(); i += 997)
+        EXPECT_EQ(text.at(i), expected[i]);
+}
+
+TEST(rope, substr) {
+    std::string expected;
+    jfern::rope text;
+    for (int i = 0; i < 20000; i++) {
+        const std::string piece = std::to_string(i * 7) + " ";
+        expected += piece;
+        text += jfern::rope(piece);
+    }
+
+    std::mt19937 rng(7);
+    for (int i = 0; i < 500; i++) {
+        const std::size_t pos = rng() % (expected.size() + 1);
+        const std::size_t count = rng() % 10000;
+
+        EXPECT_EQ(text.substr(pos, count), expected.substr(pos, count));
+    }
+
+    EXPECT_EQ(text.substr(), expected);
+    EXPECT_EQ(text.substr(expected.size()), "");
+    EXPECT_THROW(text.substr(expected.size() + 1), std::out_of_range);
+
+    char buffer[64];
+    EXPECT_EQ(text.copy(buffer, sizeof(buffer), 100), sizeof(buffer));
+    EXPECT_EQ(std::string(buffer, sizeof(buffer)), expected.substr(100, 64));
+    EXPECT_EQ(text.copy(buffer, sizeof(buffer), expected.size() - 3), 3u);
+    EXPECT_THROW(text.copy(buffer, 1, expected.size() + 1),
+                 std::out_of_range);
+}
+
+TEST(rope, insert_erase) {
+    jfern::rope text("hello world");
+
+    text.insert(5, ",");
+    EXPECT_EQ(text, "hello, world");
+
+    text.insert(0, jfern::rope("> "));
+    EXPECT_EQ(text, "> hello, world");
+
+    text.insert(text.size(), "!");
+    EXPECT_EQ(text, "> hello, world!");
+
+    text.erase(0, 2);
+    EXPECT_EQ(text, "hello, world!");
+
+    text.erase(5, 1);
+    EXPECT_EQ(text, "hello world!");
+
+    text.erase(text.size() - 1);
+    EXPECT_EQ(text, "hello world");
+
+    text.erase(text.size());
+    EXPECT_EQ(text, "hello world");
+
+    EXPECT_THROW(text.insert(12, "x"), std::out_of_range);
+    EXPECT_THROW(text.erase(12), std::out_of_range);
+
+    text.clear();
+    EXPECT_TRUE(text.empty());
+}
+
+TEST(rope, self) {
+    jfern::rope text("abc");
+    text += text;
+    EXPECT_EQ(text, "abcabc");
+
+    text.insert(3, text);
+    EXPECT_EQ(text, "abcabcabcabc");
+
+    jfern::rope big(std::string(jfern::rope::flat_size, 'x'));
+    big += "y";
+    big.append(big);
+    EXPECT_EQ(big.size(), 2 * jfern::rope::flat_size + 2);
+    EXPECT_EQ(big.at(jfern::rope::flat_size), 'y');
+    EXPECT_EQ(big.at(big.size() - 1), 'y');
+}
+
+TEST(rope, copies) {
+    jfern::rope original("shared");
+    jfern::rope copy(original);
+    const jfern::rope part = original.substr(0, 3);
+
+    original += " original";
+    copy += " copy";
+
+    EXPECT_EQ(original, "shared original");
+    EXPECT_EQ(copy, "shared copy");
+    EXPECT_EQ(part, "sha");
+
+    copy.erase(0, 7);
+    EXPECT_EQ(copy, "copy");
+    EXPECT_EQ(original, "shared original");
+
+    EXPECT_NE(original, copy);
+    EXPECT_EQ(original + copy, "shared originalcopy");
+
+    /* Equal text split differently into chunks still compares equal */
+    jfern::rope pieces("original");
+    pieces.insert(0, "shared ");
+    EXPECT_EQ(pieces, original);
+    EXPECT_EQ(original, pieces);
+    EXPECT_NE(pieces, jfern::rope("shared_original"));
+}
+
+TEST(rope, random_edits) {
+    std::mt19937 rng(42);
+    std::string expected;
+    jfern::rope text;
+
+    for (int i = 0; i < 4000; i++) {
+        const std::size_t pos = rng() % (expected.size() + 1);
+
+        switch (rng() % 4) {
+          case 0: {
+            const std::string piece(1 + rng() % 300, 'a' + rng() % 26);
+            expected.insert(pos, piece);
+            text.insert(pos, piece);
+            break;
+          }
+          case 1: {
+            const std::size_t count = rng() % 200;
+            expected.erase(pos, count);
+            text.erase(pos, count);
+            break;
+          }
+          case 2: {
+            const std::string piece(rng() % 50, '0' + rng() % 10);
+            expected += piece;
+            text += piece;
+            break;
+          }
+          default: {
+            /* Copy a stretch of the rope to somewhere else in it */
+            const std::size_t count = rng() % 500;
+            const std::string piece = expected.substr(pos, count);
+            const std::size_t target = rng() % (expected.size() + 1);
+            expected.insert(target, piece);
+            text.insert(target, text.substr(pos, count));
+            break;
+          }
+        }
+
+        ASSERT_EQ(text.size(), expected.size());
+    }
+
+    EXPECT_EQ(text.str(), expected);
+    EXPECT_EQ(from_chunks(text), expected);
+
+    /* An AVL tree's height is under 1.45 log2(n + 2) */
+    const double chunks = static_cast<double>(chunk_count(text));
+    EXPECT_LE(text.depth(), 1.45 * std::log2(chunks + 2));
+}
+
+TEST(rope, write) {
+    jfern::rope text;
+    std::string expected;
+    for (int i = 0; i < 3000; i++) {
+        const std::string piece = "line " + std::to_string(i) + "\n";
+        expected += piece;
+        text += piece;
+    }
+    text.append(std::string(3 * jfern::rope::flat_size, 'w'));
+    expected.append(3 * jfern::rope::flat_size, 'w');
+
+    std::string out;
+    jfern::string_sink<> sink(&out);
+    text.write(sink);
+    EXPECT_EQ(out, expected);
+
+#ifndef _WIN32
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    text.writev(::fileno(file));
+
+    std::rewind(file);
+    std::string actual(expected.size() + 1, '\0');
+    actual.resize(std::fread(&actual[0], 1, actual.size(), file));
+    std::fclose(file);
+
+    EXPECT_EQ(actual, expected);
+    EXPECT_THROW(text.writev(-1), std::system_error);
+#endif
+}
+
+}  // namespace
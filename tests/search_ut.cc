@@ -0,0 +1,190 @@
+/**
+ *  \file   search_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/search.h"
+
+namespace {
+
+namespace search = jfern::search;
+using jfern::superstring_view;
+
+constexpr std::size_t npos = superstring_view::npos;
+
+/* Every kernel level this CPU can run */
+std::vector<search::level> levels() {
+    std::vector<search::level> out = {search::level::scalar};
+    if (search::supported_level() >= search::level::sse2)
+        out.push_back(search::level::sse2);
+    if (search::supported_level() >= search::level::avx2)
+        out.push_back(search::level::avx2);
+    return out;
+}
+
+/* Restores the default kernels when a test finishes */
+class level_guard final {
+ public:
+    level_guard() : m_saved(search::active_level()) {}
+    ~level_guard() { search::set_active_level(m_saved); }
+
+ private:
+    search::level m_saved;
+};
+
+/*
+ * Text drawn from a small alphabet so that needles and classes match often,
+ * with some bytes above 0x7f mixed in
+ */
+std::string make_text(std::size_t size, std::default_random_engine* engine) {
+    const char alphabet[] = {'a', 'b', ' ', '\t', ',', '\xe9', '\x80', 'z'};
+    std::uniform_int_distribution<int> pick(0, sizeof(alphabet) - 1);
+
+    std::string text(size, '\0');
+    for (char& c : text) c = alphabet[pick(*engine)];
+    return text;
+}
+
+TEST(search, char_class) {
+    search::char_class chars(" \t\xff");
+    EXPECT_EQ(chars.size(), 3u);
+    EXPECT_TRUE(chars.contains(' '));
+    EXPECT_TRUE(chars.contains('\xff'));
+    EXPECT_FALSE(chars.contains('a'));
+
+    chars.insert(' ');
+    EXPECT_EQ(chars.size(), 3u);
+
+    EXPECT_EQ(search::char_class().size(), 0u);
+}
+
+TEST(search, level) {
+    level_guard guard;
+
+    EXPECT_LE(search::active_level(), search::supported_level());
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        EXPECT_EQ(search::active_level(), isa);
+    }
+
+    if (search::supported_level() < search::level::avx2) {
+        EXPECT_THROW(search::set_active_level(search::level::avx2),
+                     std::invalid_argument);
+    }
+}
+
+TEST(search, find_byte) {
+    level_guard guard;
+    std::default_random_engine engine;
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        SCOPED_TRACE(static_cast<int>(isa));
+
+        for (std::size_t size = 0; size < 200; size++) {
+            const std::string text = make_text(size, &engine);
+
+            for (char c : {'a', ',', '\xe9', 'q'}) {
+                ASSERT_EQ(search::find(text, c), text.find(c)) << size;
+            }
+        }
+
+        /* A match in each position of a long run of misses */
+        std::string text(300, 'x');
+        for (std::size_t i = 0; i < text.size(); i++) {
+            text[i] = 'y';
+            ASSERT_EQ(search::find(text, 'y'), i);
+            text[i] = 'x';
+        }
+    }
+}
+
+TEST(search, find_substring) {
+    level_guard guard;
+    std::default_random_engine engine;
+
+    const std::vector<std::string> needles = {
+        "", "a", "ab", "a b", "ba,", "\xe9\x80", "aaa", "zzzzzzzz", "a\tb,z"};
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        SCOPED_TRACE(static_cast<int>(isa));
+
+        for (std::size_t size = 0; size < 200; size++) {
+            const std::string text = make_text(size, &engine);
+
+            for (const std::string& needle : needles) {
+                ASSERT_EQ(search::find(text, needle), text.find(needle))
+                    << size << " '" << needle << "'";
+            }
+        }
+
+        /* The last byte matches everywhere but the full needle only once */
+        std::string text(100, 'b');
+        text.replace(90, 3, "abb");
+        EXPECT_EQ(search::find(text, "abb"), 90u);
+        EXPECT_EQ(search::find(text, "abbb"), 90u);
+        EXPECT_EQ(search::find(text, "abbbbbbbbbbb"), npos);
+    }
+}
+
+TEST(search, find_class) {
+    level_guard guard;
+    std::default_random_engine engine;
+
+    /* Sizes on either side of the SSE2 compare limit */
+    const std::vector<std::string> sets = {
+        "", "a", " \t", " \t,z\xe9", "abcdefgh", "abcdefghi",
+        std::string("ab \t,\xe9\x80z", 8), "0123456789ABCDEFGHIJ \t"};
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+        SCOPED_TRACE(static_cast<int>(isa));
+
+        for (std::size_t size = 0; size < 200; size++) {
+            const std::string text = make_text(size, &engine);
+
+            for (const std::string& set : sets) {
+                const search::char_class chars(set);
+
+                ASSERT_EQ(search::find_first_of(text, chars),
+                          text.find_first_of(set)) << size << " " << set;
+                ASSERT_EQ(search::find_first_not_of(text, chars),
+                          text.find_first_not_of(set)) << size << " " << set;
+                ASSERT_EQ(search::find_last_not_of(text, chars),
+                          text.find_last_not_of(set)) << size << " " << set;
+            }
+        }
+
+        /* Every byte value, in and out of a class holding half of them */
+        std::string all;
+        for (int c = 0; c < 256; c++) all.push_back(static_cast<char>(c));
+
+        search::char_class odd;
+        for (int c = 1; c < 256; c += 2) odd.insert(static_cast<char>(c));
+
+        for (std::size_t i = 0; i + 1 < all.size(); i++) {
+            const superstring_view rest(all.data() + i, all.size() - i);
+            ASSERT_EQ(search::find_first_of(rest, odd), i % 2 == 0 ? 1u : 0u);
+            ASSERT_EQ(search::find_first_not_of(rest, odd), i % 2);
+        }
+
+        const superstring_view leading(all.data(), 200);
+        EXPECT_EQ(search::find_last_not_of(leading, odd), 198u);
+    }
+}
+
+}  // namespace
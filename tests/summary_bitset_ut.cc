@@ -0,0 +1,150 @@
+/**
+ *  \file   summary_bitset_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <set>
+
+#include "gtest/gtest.h"
+#include "bitops/bitvector.h"
+#include "bitops/summary_bitset.h"
+
+namespace {
+
+using jfern::bitops::npos;
+using jfern::bitops::summary_bitset;
+
+/* Check every query of a summary_bitset against an equivalent std::set */
+void expect_equal(const summary_bitset& bits,
+                  const std::set<std::size_t>& reference) {
+    ASSERT_EQ(bits.count(), reference.size());
+
+    EXPECT_EQ(bits.find_first(),
+              reference.empty() ? npos : *reference.begin());
+    EXPECT_EQ(bits.find_last(),
+              reference.empty() ? npos : *reference.rbegin());
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<std::size_t> distribution(
+        0, bits.size() - 1);
+
+    for (int i = 0; i < 2000; i++) {
+        const std::size_t index = distribution(generator);
+
+        const auto next = reference.upper_bound(index);
+        ASSERT_EQ(bits.find_next(index),
+                  next == reference.end() ? npos : *next) << index;
+
+        const auto prev = reference.lower_bound(index);
+        ASSERT_EQ(bits.find_prev(index),
+                  prev == reference.begin() ? npos : *std::prev(prev))
+            << index;
+
+        ASSERT_EQ(bits.contains(index), reference.count(index) != 0);
+    }
+}
+
+TEST(summary_bitset, depth) {
+    EXPECT_EQ(summary_bitset(0).depth(),         1u);
+    EXPECT_EQ(summary_bitset(64).depth(),        1u);
+    EXPECT_EQ(summary_bitset(65).depth(),        2u);
+    EXPECT_EQ(summary_bitset(4096).depth(),      2u);
+    EXPECT_EQ(summary_bitset(4097).depth(),      3u);
+    EXPECT_EQ(summary_bitset(1000000).depth(),   4u);
+}
+
+TEST(summary_bitset, empty) {
+    const summary_bitset none;
+    EXPECT_EQ(none.find_first(),  npos);
+    EXPECT_EQ(none.find_last(),   npos);
+    EXPECT_EQ(none.find_next(0),  npos);
+    EXPECT_EQ(none.find_prev(10), npos);
+
+    const summary_bitset bits(100000);
+    EXPECT_TRUE(bits.empty());
+    EXPECT_EQ(bits.find_first(),      npos);
+    EXPECT_EQ(bits.find_last(),       npos);
+    EXPECT_EQ(bits.find_next(5),      npos);
+    EXPECT_EQ(bits.find_prev(99999),  npos);
+}
+
+TEST(summary_bitset, insert_erase) {
+    summary_bitset bits(300000);
+
+    EXPECT_TRUE(bits.insert(0));
+    EXPECT_FALSE(bits.insert(0));
+    EXPECT_TRUE(bits.insert(299999));
+    EXPECT_TRUE(bits.insert(150000));
+
+    EXPECT_EQ(bits.find_first(), 0u);
+    EXPECT_EQ(bits.find_next(0), 150000u);
+    EXPECT_EQ(bits.find_next(150000), 299999u);
+    EXPECT_EQ(bits.find_next(299999), npos);
+    EXPECT_EQ(bits.find_prev(299999), 150000u);
+    EXPECT_EQ(bits.find_prev(npos), 299999u);
+
+    EXPECT_TRUE(bits.erase(150000));
+    EXPECT_FALSE(bits.erase(150000));
+    EXPECT_EQ(bits.find_next(0), 299999u);
+    EXPECT_EQ(bits.find_prev(299999), 0u);
+
+    bits.clear();
+    EXPECT_TRUE(bits.empty());
+    EXPECT_EQ(bits.find_first(), npos);
+}
+
+TEST(summary_bitset, random) {
+    std::default_random_engine generator;
+
+    for (std::size_t size : {1, 63, 64, 65, 4096, 4097, 300000}) {
+        summary_bitset bits(size);
+        std::set<std::size_t> reference;
+
+        std::uniform_int_distribution<std::size_t> distribution(0, size - 1);
+
+        /* Fill up, then drain, checking along the way */
+        for (int round = 0; round < 4; round++) {
+            const bool inserting = round % 2 == 0;
+
+            for (std::size_t i = 0; i < size / 2 + 10; i++) {
+                const std::size_t index = distribution(generator);
+                if (inserting) {
+                    EXPECT_EQ(bits.insert(index),
+                              reference.insert(index).second);
+                } else {
+                    EXPECT_EQ(bits.erase(index),
+                              reference.erase(index) != 0);
+                }
+            }
+
+            expect_equal(bits, reference);
+        }
+    }
+}
+
+TEST(summary_bitset, from_bitvector) {
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> distribution(0, 999);
+
+    jfern::bitops::bitvector source(500000);
+    std::set<std::size_t> reference;
+
+    for (std::size_t i = 0; i < source.size(); i++) {
+        if (distribution(generator) == 0) {
+            source.set(i);
+            reference.insert(i);
+        }
+    }
+
+    expect_equal(summary_bitset(source), reference);
+}
+
+}  // namespace
@@ -10,9 +10,11 @@
 
 #include <list>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "superstring/arena.h"
 #include "superstring/superstring.h"
 
 namespace {
@@ -229,6 +231,51 @@ TEST(superstring, type_conversion) {
     EXPECT_EQ(result, expected);
 }
 
+TEST(superstring, rvalue) {
+    std::string input = "  HeY tHeRe BuDdY \t";
+    const char* buffer = input.data();
+
+    /* The chain hands one buffer along instead of copying at each step */
+    std::string result =
+        jfern::superstring(std::move(input)).trim().to_upper().get();
+    EXPECT_EQ(result, "HEY THERE BUDDY");
+    EXPECT_EQ(result.data(), buffer);
+
+    jfern::superstring sstring("  MiXeD  ");
+    EXPECT_EQ(std::move(sstring).ltrim().get(), "MiXeD  ");
+
+    const std::string lower = jfern::superstring("ABC").to_lower();
+    EXPECT_EQ(lower, "abc");
+
+    /* Lvalues are still left alone */
+    const jfern::superstring original("  Keep  ");
+    EXPECT_EQ(original.rtrim().get(), "  Keep");
+    EXPECT_EQ(original.to_lower().get(), "  keep  ");
+    EXPECT_EQ(original.get(), "  Keep  ");
+}
+
+TEST(superstring, inplace) {
+    jfern::superstring sstring("\t Hello, World! \n");
+
+    sstring.trim_inplace().lower_inplace();
+    EXPECT_EQ(sstring.get(), "hello, world!");
+
+    sstring.upper_inplace();
+    EXPECT_EQ(sstring.get(), "HELLO, WORLD!");
+
+    jfern::superstring left("  left  ");
+    EXPECT_EQ(left.ltrim_inplace().get(), "left  ");
+
+    jfern::superstring right("  right  ");
+    EXPECT_EQ(right.rtrim_inplace().get(), "  right");
+
+    jfern::superstring blank(" \t\n ");
+    EXPECT_EQ(blank.trim_inplace().get(), "");
+
+    jfern::superstring empty("");
+    EXPECT_EQ(empty.lower_inplace().trim_inplace().get(), "");
+}
+
 TEST(superstring, build) {
     const std::string sep = "+";
     const std::list<std::string> strs = { "hello", "world" };
@@ -240,4 +287,39 @@ TEST(superstring, build) {
     EXPECT_EQ(expected, actual);
 }
 
+TEST(superstring, arena) {
+    jfern::arena pool(1024);
+    const jfern::arena_allocator<char> alloc(&pool);
+
+    const jfern::arena_superstring line("  GET /index.html HTTP/1.1 \r\n",
+                                        alloc);
+    EXPECT_EQ(line.get_allocator(), alloc);
+
+    const auto tokens = line.trim().split();
+    ASSERT_EQ(tokens.size(), 3u);
+    EXPECT_EQ(tokens[0], "GET");
+    EXPECT_EQ(tokens[1], "/index.html");
+    EXPECT_EQ(tokens[2], "HTTP/1.1");
+    EXPECT_EQ(tokens.get_allocator(), alloc);
+
+    for (const auto& token : tokens)
+        EXPECT_EQ(token.get_allocator(), alloc);
+
+    EXPECT_EQ(line.to_lower().trim().get(), "get /index.html http/1.1");
+
+    const auto chunks = line.trim().split(std::size_t(8));
+    ASSERT_EQ(chunks.size(), 3u);
+    EXPECT_EQ(chunks[2], "HTTP/1.1");
+
+    const auto joined = jfern::arena_superstring::build(
+        "|", tokens.begin(), tokens.end(), alloc);
+    EXPECT_EQ(joined, "GET|/index.html|HTTP/1.1");
+    EXPECT_EQ(joined.get_allocator(), alloc);
+
+    /* Long strings are placed in the arena rather than the global heap */
+    const std::size_t used = pool.bytes_used();
+    const jfern::arena_superstring big(std::string(200, 'x'), alloc);
+    EXPECT_GE(pool.bytes_used(), used + 200);
+}
+
 }  // namespace
@@ -0,0 +1,186 @@
+/**
+ *  \file   superstring_view_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/superstring.h"
+#include "superstring/superstring_view.h"
+
+namespace {
+
+using jfern::superstring_view;
+
+TEST(superstring_view, construct) {
+    constexpr superstring_view empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.size(), 0u);
+
+    const std::string str = "hello";
+    const superstring_view view(str);
+    EXPECT_EQ(view.data(), str.data());
+    EXPECT_EQ(view.size(), 5u);
+    EXPECT_EQ(view.front(), 'h');
+    EXPECT_EQ(view.back(), 'o');
+    EXPECT_EQ(view[1], 'e');
+
+    const superstring_view literal("hello");
+    EXPECT_EQ(literal, view);
+    EXPECT_EQ(std::string(literal.begin(), literal.end()), str);
+    EXPECT_EQ(static_cast<std::string>(literal), str);
+
+    superstring_view shrunk = view;
+    shrunk.remove_prefix(1);
+    shrunk.remove_suffix(1);
+    EXPECT_EQ(shrunk, "ell");
+}
+
+TEST(superstring_view, find) {
+    const superstring_view view("abcabcab");
+
+    EXPECT_EQ(view.find('c'), 2u);
+    EXPECT_EQ(view.find('c', 3), 5u);
+    EXPECT_EQ(view.find('z'), superstring_view::npos);
+    EXPECT_EQ(view.find('a', 100), superstring_view::npos);
+
+    EXPECT_EQ(view.find("cab"), 2u);
+    EXPECT_EQ(view.find("cab", 3), 5u);
+    EXPECT_EQ(view.find("cabc", 3), superstring_view::npos);
+    EXPECT_EQ(view.find(""), 0u);
+    EXPECT_EQ(view.find("abcabcabc"), superstring_view::npos);
+
+    EXPECT_EQ(view.rfind('a'), 6u);
+    EXPECT_EQ(view.rfind('a', 5), 3u);
+    EXPECT_EQ(view.rfind('z'), superstring_view::npos);
+
+    EXPECT_EQ(view.find_first_of("xc"), 2u);
+    EXPECT_EQ(view.find_first_not_of("ab"), 2u);
+    EXPECT_EQ(view.find_last_not_of("ab"), 5u);
+    EXPECT_EQ(view.find_first_not_of("abc"), superstring_view::npos);
+}
+
+TEST(superstring_view, substr) {
+    const superstring_view view("hello world");
+
+    EXPECT_EQ(view.substr(6), "world");
+    EXPECT_EQ(view.substr(0, 5), "hello");
+    EXPECT_EQ(view.substr(6, 100), "world");
+    EXPECT_TRUE(view.substr(11).empty());
+    EXPECT_EQ(view.substr(6).data(), view.data() + 6);
+
+    EXPECT_THROW(view.substr(12), std::out_of_range);
+}
+
+TEST(superstring_view, compare) {
+    EXPECT_EQ(superstring_view("abc").compare("abc"), 0);
+    EXPECT_LT(superstring_view("ab").compare("abc"), 0);
+    EXPECT_GT(superstring_view("abd").compare("abc"), 0);
+    EXPECT_EQ(superstring_view().compare(""), 0);
+
+    EXPECT_TRUE(superstring_view("ab") < superstring_view("abc"));
+    EXPECT_TRUE(superstring_view("ab") != superstring_view("abc"));
+    EXPECT_FALSE(superstring_view("abc") < superstring_view("abc"));
+}
+
+TEST(superstring_view, prefix_suffix) {
+    const superstring_view view("hello");
+
+    EXPECT_TRUE(view.starts_with("he"));
+    EXPECT_TRUE(view.starts_with("hello"));
+    EXPECT_FALSE(view.starts_with("helloWorld"));
+    EXPECT_FALSE(view.starts_with(""));
+
+    EXPECT_TRUE(view.ends_with("llo"));
+    EXPECT_FALSE(view.ends_with("ell"));
+    EXPECT_FALSE(view.ends_with(""));
+
+    EXPECT_FALSE(superstring_view().starts_with(""));
+    EXPECT_FALSE(superstring_view().ends_with("a"));
+}
+
+TEST(superstring_view, trim) {
+    const std::string str = "\t\n\v\f\r hello\t\n\v\f\r ";
+    const superstring_view view(str);
+
+    EXPECT_EQ(view.ltrim(), "hello\t\n\v\f\r ");
+    EXPECT_EQ(view.rtrim(), "\t\n\v\f\r hello");
+    EXPECT_EQ(view.trim(), "hello");
+
+    /* No copies: the result points into the original storage */
+    EXPECT_EQ(view.trim().data(), str.data() + 6);
+
+    EXPECT_TRUE(superstring_view(" \t ").trim().empty());
+    EXPECT_TRUE(superstring_view(" \t ").ltrim().empty());
+    EXPECT_TRUE(superstring_view(" \t ").rtrim().empty());
+    EXPECT_TRUE(superstring_view().trim().empty());
+}
+
+TEST(superstring_view, split) {
+    const std::string str = "  Hey there    buddy  ! ";
+    const superstring_view view(str);
+
+    auto tokens = view.split();
+    ASSERT_EQ(tokens.size(), 4u);
+    EXPECT_EQ(tokens[0], "Hey");
+    EXPECT_EQ(tokens[1], "there");
+    EXPECT_EQ(tokens[2], "buddy");
+    EXPECT_EQ(tokens[3], "!");
+    EXPECT_EQ(tokens[0].data(), str.data() + 2);
+
+    tokens = superstring_view("a::b::::c").split("::");
+    ASSERT_EQ(tokens.size(), 3u);
+    EXPECT_EQ(tokens[0], "a");
+    EXPECT_EQ(tokens[1], "b");
+    EXPECT_EQ(tokens[2], "c");
+
+    EXPECT_EQ(superstring_view("").split().size(), 0u);
+    EXPECT_EQ(superstring_view(".....").split(".").size(), 0u);
+
+    tokens = superstring_view("hello").split(2);
+    ASSERT_EQ(tokens.size(), 3u);
+    EXPECT_EQ(tokens[0], "he");
+    EXPECT_EQ(tokens[1], "ll");
+    EXPECT_EQ(tokens[2], "o");
+
+    EXPECT_EQ(superstring_view("hello").split(0).size(), 0u);
+    EXPECT_EQ(superstring_view("hello").split(10).size(), 1u);
+}
+
+TEST(superstring_view, matches_superstring) {
+    const jfern::superstring owner("  one,two,,three  ");
+
+    EXPECT_EQ(owner.view(), "  one,two,,three  ");
+    EXPECT_EQ(owner.view().trim().to_string(), owner.trim().get());
+    EXPECT_EQ(owner.view().ltrim().to_string(), owner.ltrim().get());
+    EXPECT_EQ(owner.view().rtrim().to_string(), owner.rtrim().get());
+
+    const std::vector<superstring_view> views = owner.view().split(",");
+    const std::vector<std::string> strings = owner.split(",");
+    ASSERT_EQ(views.size(), strings.size());
+
+    for (std::size_t i = 0; i < views.size(); i++) {
+        EXPECT_EQ(views[i].to_string(), strings[i]);
+    }
+
+    const superstring_view prefix("  one");
+    EXPECT_TRUE(owner.starts_with(prefix));
+    EXPECT_TRUE(owner.ends_with(std::string("three  ")));
+}
+
+TEST(superstring_view, stream) {
+    std::ostringstream stream;
+    stream << superstring_view("hello world").substr(0, 5) << '!';
+    EXPECT_EQ(stream.str(), "hello!");
+}
+
+}  // namespace
@@ -0,0 +1,78 @@
+/**
+ *  \file   thread_pool_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/thread_pool.h"
+
+namespace {
+
+TEST(thread_pool, run) {
+    jfern::thread_pool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    std::vector<int> hits(1000, 0);
+    pool.run(hits.size(), [&](std::size_t i) { hits[i]++; });
+
+    for (int count : hits) EXPECT_EQ(count, 1);
+
+    /* Batches can be run back to back, and may be empty */
+    std::atomic<std::size_t> total(0);
+    for (std::size_t batch = 0; batch < 100; batch++)
+        pool.run(batch, [&](std::size_t i) { total += i + 1; });
+    pool.run(0, [](std::size_t) { FAIL(); });
+
+    EXPECT_EQ(total.load(), 166650u);
+
+    jfern::thread_pool single(0);
+    EXPECT_EQ(single.size(), 1u);
+    single.run(3, [&](std::size_t i) { hits[i]++; });
+    EXPECT_EQ(hits[2], 2);
+}
+
+TEST(thread_pool, exceptions) {
+    jfern::thread_pool pool(3);
+
+    std::atomic<std::size_t> finished(0);
+    EXPECT_THROW(pool.run(50, [&](std::size_t i) {
+        if (i == 7) throw std::runtime_error("task 7");
+        finished++;
+    }), std::runtime_error);
+
+    /* The other tasks still ran, and the pool is still usable */
+    EXPECT_EQ(finished.load(), 49u);
+
+    pool.run(10, [&](std::size_t) { finished++; });
+    EXPECT_EQ(finished.load(), 59u);
+}
+
+TEST(thread_pool, concurrent_callers) {
+    jfern::thread_pool pool(2);
+    std::atomic<std::size_t> total(0);
+
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 4; i++) {
+        callers.emplace_back([&] {
+            for (int batch = 0; batch < 50; batch++)
+                pool.run(8, [&](std::size_t) { total++; });
+        });
+    }
+
+    for (std::thread& caller : callers) caller.join();
+
+    EXPECT_EQ(total.load(), 4u * 50 * 8);
+}
+
+}  // namespace
@@ -0,0 +1,154 @@
+/**
+ *  \file   tokenizer_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/superstring.h"
+#include "superstring/tokenizer.h"
+
+namespace {
+
+using jfern::delimiter;
+using jfern::empty_tokens;
+using jfern::superstring_view;
+
+/* Drain a range into strings so the results are easy to compare */
+std::vector<std::string> collect(const jfern::tokenizer& range) {
+    std::vector<std::string> tokens;
+    for (superstring_view token : range) tokens.push_back(token.to_string());
+    return tokens;
+}
+
+using strings = std::vector<std::string>;
+
+TEST(tokenizer, character) {
+    EXPECT_EQ(collect(jfern::tokenize("This,is,a,sentence.", ',')),
+              strings({"This", "is", "a", "sentence."}));
+
+    EXPECT_EQ(collect(jfern::tokenize("  Hey there    buddy  ! ")),
+              strings({"Hey", "there", "buddy", "!"}));
+
+    EXPECT_EQ(collect(jfern::tokenize(",a,,b,", ',', empty_tokens::keep)),
+              strings({"", "a", "", "b", ""}));
+
+    EXPECT_EQ(collect(jfern::tokenize("", ',', empty_tokens::keep)),
+              strings({""}));
+    EXPECT_TRUE(collect(jfern::tokenize("", ',')).empty());
+    EXPECT_TRUE(collect(jfern::tokenize(",,,,", ',')).empty());
+
+    EXPECT_EQ(collect(jfern::tokenize("abc", ',')), strings({"abc"}));
+}
+
+TEST(tokenizer, substring) {
+    EXPECT_EQ(collect(jfern::tokenize("a::b::::c", "::")),
+              strings({"a", "b", "c"}));
+
+    EXPECT_EQ(collect(jfern::tokenize("a::b::::c::", "::",
+                                      empty_tokens::keep)),
+              strings({"a", "b", "", "c", ""}));
+
+    /* Overlapping candidates: "a:::b" splits at the first "::" */
+    EXPECT_EQ(collect(jfern::tokenize("a:::b", "::")), strings({"a", ":b"}));
+
+    const std::string delim = "<>";
+    EXPECT_EQ(collect(jfern::tokenize("1<>2<>3", delim)),
+              strings({"1", "2", "3"}));
+
+    /* An empty delimiter never matches */
+    EXPECT_EQ(collect(jfern::tokenize("a b", "")), strings({"a b"}));
+}
+
+TEST(tokenizer, any_of) {
+    const delimiter whitespace = delimiter::any_of(" \t\r\n");
+
+    EXPECT_EQ(collect(jfern::tokenize(" one\ttwo \r\nthree\n", whitespace)),
+              strings({"one", "two", "three"}));
+
+    EXPECT_EQ(collect(jfern::tokenize("a;b,c", delimiter::any_of(",;"),
+                                      empty_tokens::keep)),
+              strings({"a", "b", "c"}));
+
+    EXPECT_EQ(collect(jfern::tokenize("a,;b", delimiter::any_of(",;"),
+                                      empty_tokens::keep)),
+              strings({"a", "", "b"}));
+
+    /* Bytes above 0x7f are ordinary members of the set */
+    EXPECT_EQ(collect(jfern::tokenize("x\xffy", delimiter::any_of("\xff"))),
+              strings({"x", "y"}));
+
+    EXPECT_EQ(collect(jfern::tokenize("a b", delimiter::any_of(""))),
+              strings({"a b"}));
+}
+
+TEST(tokenizer, split_n) {
+    const superstring_view line("GET /index.html HTTP/1.1");
+
+    EXPECT_EQ(collect(jfern::split_n(line, 2)),
+              strings({"GET", "/index.html HTTP/1.1"}));
+    EXPECT_EQ(collect(jfern::split_n(line, 3)),
+              strings({"GET", "/index.html", "HTTP/1.1"}));
+    EXPECT_EQ(collect(jfern::split_n(line, 10)),
+              strings({"GET", "/index.html", "HTTP/1.1"}));
+    EXPECT_EQ(collect(jfern::split_n(line, 1)), strings({line.to_string()}));
+    EXPECT_TRUE(collect(jfern::split_n(line, 0)).empty());
+
+    /* Dropping empties skips the delimiters before the remainder */
+    EXPECT_EQ(collect(jfern::split_n("a   b  c", 2)), strings({"a", "b  c"}));
+    EXPECT_EQ(collect(jfern::split_n("a   ", 2)), strings({"a"}));
+
+    EXPECT_EQ(collect(jfern::split_n("a,,b,c", 2, ',', empty_tokens::keep)),
+              strings({"a", ",b,c"}));
+    EXPECT_EQ(collect(jfern::split_n("a,", 2, ',', empty_tokens::keep)),
+              strings({"a", ""}));
+
+    EXPECT_EQ(collect(jfern::split_n("k=v=w", 2, "=")),
+              strings({"k", "v=w"}));
+}
+
+TEST(tokenizer, lazy) {
+    const std::string text = "first second third";
+    const jfern::tokenizer range = jfern::tokenize(text);
+
+    auto iter = range.begin();
+    ASSERT_NE(iter, range.end());
+    EXPECT_EQ(*iter, "first");
+    EXPECT_EQ(iter->data(), text.data());
+
+    auto copy = iter++;
+    EXPECT_EQ(*copy, "first");
+    EXPECT_EQ(*iter, "second");
+    EXPECT_NE(copy, iter);
+    EXPECT_EQ(++copy, iter);
+
+    ++iter;
+    EXPECT_EQ(*iter, "third");
+    EXPECT_EQ(++iter, range.end());
+
+    /* Standard algorithms work on the range */
+    EXPECT_EQ(std::distance(range.begin(), range.end()), 3);
+}
+
+TEST(tokenizer, superstring) {
+    const jfern::superstring sstring("  one,two,,three  ");
+
+    const std::vector<std::string> expected = sstring.split(",");
+    EXPECT_EQ(collect(sstring.tokenize(',')), expected);
+
+    EXPECT_EQ(collect(sstring.tokenize(',', empty_tokens::keep)),
+              strings({"  one", "two", "", "three  "}));
+
+    EXPECT_EQ(collect(sstring.split_n(2, ',')),
+              strings({"  one", "two,,three  "}));
+}
+
+}  // namespace
@@ -0,0 +1,281 @@
+/**
+ *  \file   utf8_ut.cc
+ *  \author Jason Fernandez
+ *  \date   10/16/2026
+ *
+ *  Copyright 2026 Jason Fernandez
+ *
+ *  https://github.com/jfern2011/utility
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "superstring/search.h"
+#include "superstring/utf8.h"
+
+namespace {
+
+namespace search = jfern::search;
+namespace utf8 = jfern::utf8;
+
+constexpr std::size_t npos = jfern::superstring_view::npos;
+
+/* Every kernel level this CPU can run */
+std::vector<search::level> levels() {
+    std::vector<search::level> out = {search::level::scalar};
+    if (search::supported_level() >= search::level::sse2)
+        out.push_back(search::level::sse2);
+    if (search::supported_level() >= search::level::avx2)
+        out.push_back(search::level::avx2);
+    return out;
+}
+
+/* Restores the default kernels when a test finishes */
+class level_guard final {
+ public:
+    level_guard() : m_saved(search::active_level()) {}
+    ~level_guard() { search::set_active_level(m_saved); }
+
+ private:
+    search::level m_saved;
+};
+
+/*
+ * A reference validator: decode by the length the lead byte gives, then
+ * reject what decodes to an overlong form, a surrogate or too large a value
+ */
+std::size_t reference_find_invalid(const std::string& text) {
+    std::size_t i = 0;
+    while (i < text.size()) {
+        const auto lead = static_cast<unsigned char>(text[i]);
+
+        std::size_t length;
+        char32_t value, min;
+        if (lead < 0x80) {
+            i++;
+            continue;
+        } else if ((lead & 0xE0) == 0xC0) {
+            length = 2; value = lead & 0x1F; min = 0x80;
+        } else if ((lead & 0xF0) == 0xE0) {
+            length = 3; value = lead & 0x0F; min = 0x800;
+        } else if ((lead & 0xF8) == 0xF0) {
+            length = 4; value = lead & 0x07; min = 0x10000;
+        } else {
+            return i;
+        }
+
+        /* An ill-formed sequence is reported where it starts */
+        for (std::size_t j = 1; j < length; j++) {
+            if (i + j >= text.size() ||
+                (static_cast<unsigned char>(text[i + j]) & 0xC0) != 0x80)
+                return i;
+            value = (value << 6) | (text[i + j] & 0x3F);
+        }
+
+        if (value < min || value > 0x10FFFF ||
+            (value >= 0xD800 && value <= 0xDFFF))
+            return i;
+
+        i += length;
+    }
+
+    return npos;
+}
+
+/* Mostly ASCII, with sequences of every length and some bad bytes */
+std::string make_text(std::size_t size, bool errors,
+                      std::default_random_engine* engine) {
+    const std::vector<std::string> pieces = {
+        "a", "Z", " ", "\xC3\xA9", "\xCE\xA3", "\xE2\x82\xAC", "\xED\x9F\xBF",
+        "\xEF\xBF\xBD", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF"};
+    const std::vector<std::string> bad = {
+        "\x80", "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xED\xA0\x80",
+        "\xF0\x80\x80\x80", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF",
+        "\xC3", "\xE2\x82", "\xF0\x9F\x98"};
+
+    std::uniform_int_distribution<int> pick(0, 99);
+
+    std::string text;
+    while (text.size() < size) {
+        const int n = pick(*engine);
+        if (n < 80) {
+            text += static_cast<char>('a' + n % 26);
+        } else if (errors && n == 99) {
+            text += bad[(*engine)() % bad.size()];
+        } else {
+            text += pieces[(*engine)() % pieces.size()];
+        }
+    }
+
+    return text;
+}
+
+TEST(utf8, valid) {
+    level_guard guard;
+
+    const std::vector<std::string> good = {
+        "", "plain ASCII", "caf\xC3\xA9", "\xE2\x82\xAC" "100",
+        "\xF0\x9F\x98\x80", "\xEF\xBB\xBF", "\xED\x9F\xBF", "\xEE\x80\x80",
+        "\xF4\x8F\xBF\xBF", std::string(1, '\0')};
+
+    const std::vector<std::pair<std::string, std::size_t>> bad = {
+        {"\x80", 0}, {"a\xBF", 1}, {"\xC0\x80", 0}, {"\xC1\xBF", 0},
+        {"\xE0\x9F\xBF", 0}, {"\xED\xA0\x80", 0}, {"\xED\xBF\xBF", 0},
+        {"\xF0\x8F\xBF\xBF", 0}, {"\xF4\x90\x80\x80", 0}, {"\xF5", 0},
+        {"\xFF", 0}, {"ab\xC3", 2}, {"\xE2\x82", 0}, {"\xE2\x82" "a", 0},
+        {"\xF0\x9F\x98" "abc", 0}, {"\xC3\xA9\xA9", 2}};
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+
+        for (const std::string& text : good) {
+            EXPECT_TRUE(utf8::valid(text)) << static_cast<int>(isa);
+            EXPECT_EQ(utf8::find_invalid(text), npos);
+        }
+
+        for (const auto& test : bad) {
+            EXPECT_FALSE(utf8::valid(test.first)) << static_cast<int>(isa);
+            EXPECT_EQ(utf8::find_invalid(test.first), test.second)
+                << static_cast<int>(isa);
+        }
+    }
+}
+
+TEST(utf8, block_boundaries) {
+    level_guard guard;
+
+    /* Put each sequence, good and bad, across every offset of a block */
+    for (const std::string& sequence : {std::string("\xF0\x9F\x98\x80"),
+                                        std::string("\xE2\x82\xAC"),
+                                        std::string("\xF0\x9F\x98"),
+                                        std::string("\xED\xA0\x80"),
+                                        std::string("\xC3")}) {
+        for (std::size_t offset = 0; offset < 70; offset++) {
+            for (const char* after : {"", "x", "\xC3\xA9"}) {
+                const std::string text =
+                    std::string(offset, 'a') + sequence + after +
+                    std::string(offset % 3 == 0 ? 40 : 0, 'b');
+                const std::size_t expected = reference_find_invalid(text);
+
+                for (search::level isa : levels()) {
+                    search::set_active_level(isa);
+                    ASSERT_EQ(utf8::find_invalid(text), expected)
+                        << "level " << static_cast<int>(isa) << ", offset "
+                        << offset;
+                }
+            }
+        }
+    }
+}
+
+TEST(utf8, random) {
+    level_guard guard;
+    std::default_random_engine engine(3);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    for (int i = 0; i < 300; i++) {
+        std::string text = make_text(i * 7, i % 2 == 1, &engine);
+
+        /* Some with bytes that are entirely random */
+        if (i % 5 == 0) {
+            for (char& c : text) {
+                if (engine() % 8 == 0) c = static_cast<char>(byte(engine));
+            }
+        }
+
+        const std::size_t expected = reference_find_invalid(text);
+
+        for (search::level isa : levels()) {
+            search::set_active_level(isa);
+            ASSERT_EQ(utf8::find_invalid(text), expected)
+                << "level " << static_cast<int>(isa);
+        }
+    }
+}
+
+TEST(utf8, length) {
+    level_guard guard;
+    std::default_random_engine engine(5);
+
+    const std::string text = make_text(5000, false, &engine);
+
+    std::size_t expected = 0;
+    for (char c : text) expected += (static_cast<unsigned char>(c) & 0xC0)
+        != 0x80;
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+
+        EXPECT_EQ(utf8::length(""), 0u);
+        EXPECT_EQ(utf8::length("caf\xC3\xA9 \xF0\x9F\x98\x80"), 6u);
+        EXPECT_EQ(utf8::length(text), expected);
+    }
+}
+
+TEST(utf8, code_points) {
+    EXPECT_EQ(utf8::lower(U'A'), U'a');
+    EXPECT_EQ(utf8::lower(U'a'), U'a');
+    EXPECT_EQ(utf8::upper(U'z'), U'Z');
+    EXPECT_EQ(utf8::upper(U'@'), U'@');
+    EXPECT_EQ(utf8::fold(U'['), U'[');
+
+    EXPECT_EQ(utf8::lower(0xC9), 0xE9u);      // E with acute
+    EXPECT_EQ(utf8::upper(0xFF), 0x178u);     // y with diaeresis
+    EXPECT_EQ(utf8::lower(0x100), 0x101u);    // Latin Extended-A
+    EXPECT_EQ(utf8::lower(0x101), 0x101u);
+    EXPECT_EQ(utf8::upper(0x101), 0x100u);
+    EXPECT_EQ(utf8::lower(0x3A3), 0x3C3u);    // Sigma
+    EXPECT_EQ(utf8::lower(0x3C2), 0x3C2u);    // Final sigma
+    EXPECT_EQ(utf8::fold(0x3C2), 0x3C3u);
+    EXPECT_EQ(utf8::upper(0x3C2), 0x3A3u);
+    EXPECT_EQ(utf8::lower(0x410), 0x430u);    // Cyrillic A
+    EXPECT_EQ(utf8::lower(0x130), U'i');      // I with dot above
+    EXPECT_EQ(utf8::fold(0x130), 0x130u);     // ...which only folds fully
+    EXPECT_EQ(utf8::upper(0x131), U'I');      // Dotless i
+    EXPECT_EQ(utf8::upper(0xDF), 0xDFu);      // Sharp s
+    EXPECT_EQ(utf8::fold(0x1E9E), 0xDFu);     // Capital sharp s
+    EXPECT_EQ(utf8::fold(0x212A), U'k');      // Kelvin sign
+    EXPECT_EQ(utf8::fold(0x17F), U's');       // Long s
+    EXPECT_EQ(utf8::lower(0x1C5), 0x1C6u);    // Title case DZ with caron
+    EXPECT_EQ(utf8::upper(0x1C5), 0x1C4u);
+    EXPECT_EQ(utf8::lower(0x23A), 0x2C65u);   // Grows from 2 bytes to 3
+    EXPECT_EQ(utf8::fold(0xAB70), 0x13A0u);   // Cherokee folds to upper
+    EXPECT_EQ(utf8::lower(0x10400), 0x10428u);  // Deseret
+    EXPECT_EQ(utf8::upper(0x1E943), 0x1E921u);  // Adlam
+    EXPECT_EQ(utf8::lower(0x4E00), 0x4E00u);  // No case
+    EXPECT_EQ(utf8::lower(0x10FFFF), 0x10FFFFu);
+}
+
+TEST(utf8, strings) {
+    level_guard guard;
+
+    for (search::level isa : levels()) {
+        search::set_active_level(isa);
+
+        EXPECT_EQ(utf8::to_lower("Hello, \xCE\xA3\xCE\x9F\xCE\xA6\xCE\x99\xCE"
+                                 "\x91! \xC3\x89T\xC3\x89"),
+                  "hello, \xCF\x83\xCE\xBF\xCF\x86\xCE\xB9\xCE\xB1! "
+                  "\xC3\xA9t\xC3\xA9");
+
+        EXPECT_EQ(utf8::to_upper("stra\xC3\x9F" "e \xC3\xBF"),
+                  "STRA\xC3\x9F" "E \xC5\xB8");
+
+        EXPECT_EQ(utf8::fold_case("\xE2\x84\xAA" "ELVIN \xCF\x82"),
+                  "kelvin \xCF\x83");
+
+        /* Lengths change, and bad bytes pass through */
+        EXPECT_EQ(utf8::to_lower("\xC8\xBA" "A\xFF\xC3"),
+                  "\xE2\xB1\xA5" "a\xFF\xC3");
+
+        /* Long runs of ASCII */
+        const std::string ascii(100, 'Q');
+        EXPECT_EQ(utf8::to_lower(ascii + "\xC3\x80" + ascii),
+                  std::string(100, 'q') + "\xC3\xA0" + std::string(100, 'q'));
+        EXPECT_EQ(utf8::to_upper(""), "");
+    }
+}
+
+}  // namespace